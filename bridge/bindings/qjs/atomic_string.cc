@@ -107,7 +107,8 @@ AtomicString::AtomicString(JSContext* ctx, const std::unique_ptr<AutoFreeNativeS
 
 AtomicString::AtomicString(JSContext* ctx, JSValue value)
     : runtime_(JS_GetRuntime(ctx)), atom_(JS_ValueToAtom(ctx, value)) {
-  if (JS_IsString(value)) {
+  // Ropes are read back from the atom.
+  if (JS_VALUE_GET_TAG(value) == JS_TAG_STRING) {
     kind_ = GetStringKind(value);
     length_ = JS_VALUE_GET_STRING(value)->len;
   } else {
@@ -0,0 +1,375 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "code_cache.h"
+#include <quickjs/quickjs.h>
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+
+namespace webf {
+
+namespace {
+
+constexpr uint32_t kEntryMagic = 0x43425157;  // "WQBC"
+constexpr uint32_t kIndexMagic = 0x58495157;  // "WQIX"
+constexpr uint32_t kFormatVersion = 2;
+
+using Digest = std::array<uint8_t, 32>;
+
+struct EntryHeader {
+  uint32_t magic;
+  uint32_t format_version;
+  uint64_t engine_version;
+  uint64_t source_length;
+  uint64_t bytecode_length;
+  // SHA-256 of the engine version, the url and the source, the key is its first 8 bytes.
+  Digest source_digest;
+  // SHA-256 of the bytecode.
+  Digest bytecode_digest;
+};
+
+struct IndexHeader {
+  uint32_t magic;
+  uint32_t format_version;
+  uint64_t engine_version;
+  uint64_t count;
+};
+
+// SHA-256, see FIPS 180-4.
+class Sha256 {
+ public:
+  void Update(const void* data, size_t length) {
+    auto* bytes = static_cast<const uint8_t*>(data);
+    length_ += length;
+    while (length > 0) {
+      size_t count = std::min(length, sizeof(block_) - block_length_);
+      memcpy(block_ + block_length_, bytes, count);
+      block_length_ += count;
+      bytes += count;
+      length -= count;
+      if (block_length_ == sizeof(block_)) {
+        Transform();
+        block_length_ = 0;
+      }
+    }
+  }
+
+  Digest Finish() {
+    uint64_t bit_length = length_ * 8;
+    uint8_t padding = 0x80;
+    Update(&padding, 1);
+    padding = 0;
+    while (block_length_ != 56)
+      Update(&padding, 1);
+    uint8_t length_bytes[8];
+    for (int i = 0; i < 8; i++)
+      length_bytes[i] = static_cast<uint8_t>(bit_length >> (56 - i * 8));
+    Update(length_bytes, 8);
+
+    Digest digest;
+    for (int i = 0; i < 32; i++)
+      digest[i] = static_cast<uint8_t>(state_[i / 4] >> (24 - (i % 4) * 8));
+    return digest;
+  }
+
+ private:
+  static uint32_t Rotate(uint32_t value, int bits) { return (value >> bits) | (value << (32 - bits)); }
+
+  void Transform() {
+    static constexpr uint32_t k[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++) {
+      w[i] = static_cast<uint32_t>(block_[i * 4]) << 24 | static_cast<uint32_t>(block_[i * 4 + 1]) << 16 |
+             static_cast<uint32_t>(block_[i * 4 + 2]) << 8 | block_[i * 4 + 3];
+    }
+    for (int i = 16; i < 64; i++) {
+      uint32_t s0 = Rotate(w[i - 15], 7) ^ Rotate(w[i - 15], 18) ^ (w[i - 15] >> 3);
+      uint32_t s1 = Rotate(w[i - 2], 17) ^ Rotate(w[i - 2], 19) ^ (w[i - 2] >> 10);
+      w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = state_[0], b = state_[1], c = state_[2], d = state_[3];
+    uint32_t e = state_[4], f = state_[5], g = state_[6], h = state_[7];
+    for (int i = 0; i < 64; i++) {
+      uint32_t t1 = h + (Rotate(e, 6) ^ Rotate(e, 11) ^ Rotate(e, 25)) + ((e & f) ^ (~e & g)) + k[i] + w[i];
+      uint32_t t2 = (Rotate(a, 2) ^ Rotate(a, 13) ^ Rotate(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+      h = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = b;
+      b = a;
+      a = t1 + t2;
+    }
+    state_[0] += a;
+    state_[1] += b;
+    state_[2] += c;
+    state_[3] += d;
+    state_[4] += e;
+    state_[5] += f;
+    state_[6] += g;
+    state_[7] += h;
+  }
+
+  uint32_t state_[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+  uint8_t block_[64];
+  size_t block_length_{0};
+  uint64_t length_{0};
+};
+
+// Bytecode is only read back by the QuickJS build and pointer size which wrote it.
+uint64_t EngineVersion() {
+  return static_cast<uint64_t>(JS_GetBytecodeVersion()) << 32 | kFormatVersion << 8 | sizeof(void*);
+}
+
+Digest SourceDigest(const char* code, size_t code_length, const char* source_url) {
+  Sha256 sha256;
+  uint64_t engine_version = EngineVersion();
+  sha256.Update(&engine_version, sizeof(engine_version));
+  // The url is kept in the bytecode for stack traces.
+  uint64_t url_length = source_url != nullptr ? strlen(source_url) : 0;
+  sha256.Update(&url_length, sizeof(url_length));
+  sha256.Update(source_url, url_length);
+  sha256.Update(code, code_length);
+  return sha256.Finish();
+}
+
+Digest BytecodeDigest(const uint8_t* bytecode, size_t bytecode_length) {
+  Sha256 sha256;
+  sha256.Update(bytecode, bytecode_length);
+  return sha256.Finish();
+}
+
+uint64_t EntryKey(const Digest& source_digest) {
+  uint64_t key;
+  memcpy(&key, source_digest.data(), sizeof(key));
+  return key;
+}
+
+bool ReadFile(const std::string& path, std::vector<uint8_t>& contents) {
+  FILE* file = fopen(path.c_str(), "rb");
+  if (file == nullptr)
+    return false;
+
+  bool success = fseek(file, 0, SEEK_END) == 0;
+  long size = success ? ftell(file) : -1;
+  success = size >= 0 && fseek(file, 0, SEEK_SET) == 0;
+  if (success) {
+    contents.resize(size);
+    success = fread(contents.data(), 1, size, file) == static_cast<size_t>(size);
+  }
+  fclose(file);
+  return success;
+}
+
+// Writes to a temporary file first, so a crash never leaves a partial file behind under |path|.
+bool WriteFile(const std::string& path, const void* header, size_t header_length, const void* body, size_t length) {
+  std::string temp_path = path + ".tmp";
+  FILE* file = fopen(temp_path.c_str(), "wb");
+  if (file == nullptr)
+    return false;
+
+  bool success = fwrite(header, 1, header_length, file) == header_length;
+  success = success && (length == 0 || fwrite(body, 1, length, file) == length);
+  success = fclose(file) == 0 && success;
+
+  // rename() does not replace existing files on windows.
+  remove(path.c_str());
+  if (!success || rename(temp_path.c_str(), path.c_str()) != 0) {
+    remove(temp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+CodeCache* CodeCache::Shared() {
+  static auto* code_cache = new CodeCache();
+  return code_cache;
+}
+
+void CodeCache::Configure(const std::string& directory, int64_t max_bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (index_dirty_)
+    SaveIndex();
+  directory_ = directory;
+  max_bytes_ = max_bytes;
+  lru_.clear();
+  entries_.clear();
+  stats_ = Stats();
+
+  if (directory_.empty())
+    return;
+
+  LoadIndex();
+  Evict();
+  SaveIndex();
+}
+
+bool CodeCache::enabled() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return !directory_.empty();
+}
+
+bool CodeCache::Load(const char* code, size_t code_length, const char* source_url, std::vector<uint8_t>& bytecode) {
+  Digest source_digest = SourceDigest(code, code_length, source_url);
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (directory_.empty())
+    return false;
+
+  uint64_t key = EntryKey(source_digest);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    stats_.misses++;
+    return false;
+  }
+
+  std::vector<uint8_t> contents;
+  bool valid = ReadFile(EntryPath(key), contents) && contents.size() >= sizeof(EntryHeader);
+  if (valid) {
+    EntryHeader header;
+    memcpy(&header, contents.data(), sizeof(EntryHeader));
+    const uint8_t* body = contents.data() + sizeof(EntryHeader);
+    size_t body_length = contents.size() - sizeof(EntryHeader);
+    // Comparing the whole digest tells apart the sources whose keys collide.
+    valid = header.magic == kEntryMagic && header.format_version == kFormatVersion &&
+            header.engine_version == EngineVersion() && header.source_length == code_length &&
+            header.source_digest == source_digest && header.bytecode_length == body_length &&
+            header.bytecode_digest == BytecodeDigest(body, body_length);
+  }
+
+  if (!valid) {
+    stats_.rejected++;
+    stats_.misses++;
+    RemoveEntry(it->second);
+    index_dirty_ = true;
+    return false;
+  }
+
+  bytecode.assign(contents.begin() + sizeof(EntryHeader), contents.end());
+  // The new order is written along with the next store, or by Flush().
+  lru_.splice(lru_.end(), lru_, it->second);
+  index_dirty_ = true;
+  stats_.hits++;
+  return true;
+}
+
+void CodeCache::Store(const char* code,
+                      size_t code_length,
+                      const char* source_url,
+                      const uint8_t* bytecode,
+                      size_t bytecode_length) {
+  Digest source_digest = SourceDigest(code, code_length, source_url);
+  Digest bytecode_digest = BytecodeDigest(bytecode, bytecode_length);
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto size = static_cast<int64_t>(sizeof(EntryHeader) + bytecode_length);
+  if (directory_.empty() || size > max_bytes_)
+    return;
+
+  uint64_t key = EntryKey(source_digest);
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    stats_.total_bytes -= it->second->size;
+    lru_.erase(it->second);
+    entries_.erase(it);
+  }
+
+  EntryHeader header{kEntryMagic,     kFormatVersion, EngineVersion(), code_length,
+                     bytecode_length, source_digest, bytecode_digest};
+  if (!WriteFile(EntryPath(key), &header, sizeof(header), bytecode, bytecode_length)) {
+    SaveIndex();
+    return;
+  }
+
+  entries_[key] = lru_.insert(lru_.end(), Entry{key, size});
+  stats_.total_bytes += size;
+  stats_.stores++;
+  Evict();
+  SaveIndex();
+}
+
+void CodeCache::Flush() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (index_dirty_)
+    SaveIndex();
+}
+
+CodeCache::Stats CodeCache::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+std::string CodeCache::EntryPath(uint64_t key) const {
+  char name[32];
+  snprintf(name, sizeof(name), "/%016llx.qjsc", static_cast<unsigned long long>(key));
+  return directory_ + name;
+}
+
+void CodeCache::RemoveEntry(std::list<Entry>::iterator entry) {
+  remove(EntryPath(entry->key).c_str());
+  stats_.total_bytes -= entry->size;
+  entries_.erase(entry->key);
+  lru_.erase(entry);
+}
+
+void CodeCache::Evict() {
+  while (stats_.total_bytes > max_bytes_ && !lru_.empty()) {
+    RemoveEntry(lru_.begin());
+    stats_.evictions++;
+  }
+}
+
+void CodeCache::LoadIndex() {
+  std::vector<uint8_t> contents;
+  if (!ReadFile(directory_ + "/index", contents) || contents.size() < sizeof(IndexHeader))
+    return;
+
+  IndexHeader header;
+  memcpy(&header, contents.data(), sizeof(IndexHeader));
+  if (header.magic != kIndexMagic || header.format_version != kFormatVersion ||
+      header.count != (contents.size() - sizeof(IndexHeader)) / sizeof(Entry))
+    return;
+
+  // Entries written by another QuickJS build would never be hit again.
+  bool stale = header.engine_version != EngineVersion();
+  const uint8_t* data = contents.data() + sizeof(IndexHeader);
+  for (uint64_t i = 0; i < header.count; i++) {
+    Entry entry;
+    memcpy(&entry, data + i * sizeof(Entry), sizeof(Entry));
+    if (stale) {
+      remove(EntryPath(entry.key).c_str());
+      continue;
+    }
+    if (entry.size <= 0 || entries_.count(entry.key) > 0)
+      continue;
+    entries_[entry.key] = lru_.insert(lru_.end(), entry);
+    stats_.total_bytes += entry.size;
+  }
+}
+
+void CodeCache::SaveIndex() {
+  index_dirty_ = false;
+  if (directory_.empty())
+    return;
+
+  std::vector<Entry> entries(lru_.begin(), lru_.end());
+  IndexHeader header{kIndexMagic, kFormatVersion, EngineVersion(), entries.size()};
+  WriteFile(directory_ + "/index", &header, sizeof(header), entries.data(), entries.size() * sizeof(Entry));
+}
+
+}  // namespace webf
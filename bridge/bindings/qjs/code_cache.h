@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_BINDINGS_QJS_CODE_CACHE_H_
+#define BRIDGE_BINDINGS_QJS_CODE_CACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "foundation/macros.h"
+
+namespace webf {
+
+// Keeps the bytecode of evaluated scripts on disk, so loading the same script again, even in a later process, skips
+// parsing and compiling it.
+//
+// Entries are keyed by a SHA-256 digest of the source, the source url and the QuickJS bytecode version, each one is a
+// |directory|/<key>.qjsc file whose header records the whole digest and a digest of the bytecode. Files written for
+// another source, or truncated or stale ones, are rejected and removed instead of being read by QuickJS. The least
+// recently used entries are evicted once the files exceed the configured size, the order is kept in |directory|/index.
+// The order changed by hits is only written along with the next store, or by Flush().
+//
+// Shared by all pages of the process and safe to use from any JS thread.
+class CodeCache {
+ public:
+  struct Stats {
+    int64_t hits{0};
+    int64_t misses{0};
+    // Files which failed the integrity checks, also counted as misses.
+    int64_t rejected{0};
+    int64_t stores{0};
+    int64_t evictions{0};
+    int64_t total_bytes{0};
+  };
+
+  static CodeCache* Shared();
+
+  // Stores the bytecode under |directory|, which must exist, using at most |max_bytes| of disk. An empty directory
+  // disables the cache. Resets the stats.
+  void Configure(const std::string& directory, int64_t max_bytes);
+  bool enabled();
+
+  bool Load(const char* code, size_t code_length, const char* source_url, std::vector<uint8_t>& bytecode);
+  void Store(const char* code,
+             size_t code_length,
+             const char* source_url,
+             const uint8_t* bytecode,
+             size_t bytecode_length);
+
+  // Writes the order of the entries read since the last store to the index.
+  void Flush();
+
+  Stats stats();
+
+ private:
+  struct Entry {
+    uint64_t key;
+    int64_t size;
+  };
+
+  CodeCache() = default;
+  WEBF_DISALLOW_COPY_ASSIGN_AND_MOVE(CodeCache);
+
+  std::string EntryPath(uint64_t key) const;
+  void RemoveEntry(std::list<Entry>::iterator entry);
+  void Evict();
+  void LoadIndex();
+  void SaveIndex();
+
+  std::mutex mutex_;
+  std::string directory_;
+  int64_t max_bytes_{0};
+  // Least recently used first.
+  std::list<Entry> lru_;
+  std::unordered_map<uint64_t, std::list<Entry>::iterator> entries_;
+  bool index_dirty_{false};
+  Stats stats_;
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_BINDINGS_QJS_CODE_CACHE_H_
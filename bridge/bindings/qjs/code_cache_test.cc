@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "code_cache.h"
+#include <sys/stat.h>
+#include <cstdio>
+#include <cstring>
+#include "gtest/gtest.h"
+
+using namespace webf;
+
+namespace {
+
+std::string CacheDirectory(const char* name) {
+  std::string directory = testing::TempDir() + name;
+  mkdir(directory.c_str(), 0755);
+  // Evicts everything left by an earlier run.
+  CodeCache::Shared()->Configure(directory, 0);
+  return directory;
+}
+
+void Store(const char* code, const char* url, const std::vector<uint8_t>& bytecode) {
+  CodeCache::Shared()->Store(code, strlen(code), url, bytecode.data(), bytecode.size());
+}
+
+bool Load(const char* code, const char* url, std::vector<uint8_t>& bytecode) {
+  return CodeCache::Shared()->Load(code, strlen(code), url, bytecode);
+}
+
+// The keys listed by the index, least recently used first. They follow its 24 bytes header, each one with its size.
+std::vector<uint64_t> IndexKeys(const std::string& directory) {
+  std::vector<uint64_t> keys;
+  FILE* index = fopen((directory + "/index").c_str(), "rb");
+  if (index == nullptr)
+    return keys;
+  uint64_t entry[2];
+  fseek(index, 24, SEEK_SET);
+  while (fread(entry, sizeof(entry), 1, index) == 1)
+    keys.emplace_back(entry[0]);
+  fclose(index);
+  return keys;
+}
+
+std::string EntryPath(const std::string& directory, uint64_t key) {
+  char name[32];
+  snprintf(name, sizeof(name), "/%016llx.qjsc", static_cast<unsigned long long>(key));
+  return directory + name;
+}
+
+}  // namespace
+
+TEST(CodeCache, hitsSurviveReconfiguration) {
+  std::string directory = CacheDirectory("webf_code_cache_hits");
+  CodeCache* cache = CodeCache::Shared();
+  cache->Configure(directory, 1 << 20);
+
+  std::vector<uint8_t> bytecode;
+  EXPECT_FALSE(Load("var a = 1;", "a.js", bytecode));
+  Store("var a = 1;", "a.js", {1, 2, 3, 4});
+
+  // A new process reads the index left on disk.
+  cache->Configure(directory, 1 << 20);
+  EXPECT_TRUE(Load("var a = 1;", "a.js", bytecode));
+  EXPECT_EQ(bytecode, (std::vector<uint8_t>{1, 2, 3, 4}));
+  EXPECT_FALSE(Load("var a = 2;", "a.js", bytecode));
+  EXPECT_FALSE(Load("var a = 1;", "b.js", bytecode));
+
+  CodeCache::Stats stats = cache->stats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 2);
+  EXPECT_EQ(stats.rejected, 0);
+
+  cache->Configure("", 0);
+  EXPECT_FALSE(cache->enabled());
+  EXPECT_FALSE(Load("var a = 1;", "a.js", bytecode));
+}
+
+TEST(CodeCache, corruptedEntriesAreRejected) {
+  std::string directory = CacheDirectory("webf_code_cache_corrupted");
+  CodeCache* cache = CodeCache::Shared();
+  cache->Configure(directory, 1 << 20);
+  Store("var a = 1;", "a.js", {1, 2, 3, 4});
+
+  std::vector<uint64_t> keys = IndexKeys(directory);
+  ASSERT_EQ(keys.size(), 1u);
+  std::string entry_path = EntryPath(directory, keys[0]);
+
+  // Flip the last byte of the bytecode.
+  FILE* entry = fopen(entry_path.c_str(), "r+b");
+  ASSERT_NE(entry, nullptr);
+  fseek(entry, -1, SEEK_END);
+  fputc(0xff, entry);
+  fclose(entry);
+
+  std::vector<uint8_t> bytecode;
+  EXPECT_FALSE(Load("var a = 1;", "a.js", bytecode));
+  EXPECT_EQ(cache->stats().rejected, 1);
+  EXPECT_EQ(cache->stats().total_bytes, 0);
+  // The rejected file is removed.
+  EXPECT_EQ(fopen(entry_path.c_str(), "rb"), nullptr);
+
+  cache->Configure("", 0);
+}
+
+TEST(CodeCache, leastRecentlyUsedEntriesAreEvicted) {
+  std::string directory = CacheDirectory("webf_code_cache_eviction");
+  CodeCache* cache = CodeCache::Shared();
+  std::vector<uint8_t> body(1000, 1);
+  cache->Configure(directory, 1 << 20);
+  Store("a", "a.js", body);
+  int64_t entry_size = cache->stats().total_bytes;
+
+  // Room for two entries.
+  cache->Configure(directory, entry_size * 2);
+  Store("b", "b.js", body);
+  std::vector<uint8_t> bytecode;
+  EXPECT_TRUE(Load("a", "a.js", bytecode));
+  Store("c", "c.js", body);
+
+  EXPECT_TRUE(Load("a", "a.js", bytecode));
+  EXPECT_FALSE(Load("b", "b.js", bytecode));
+  EXPECT_TRUE(Load("c", "c.js", bytecode));
+  EXPECT_EQ(cache->stats().evictions, 1);
+  EXPECT_EQ(cache->stats().total_bytes, entry_size * 2);
+
+  // Entries larger than the whole cache are not stored.
+  Store("d", "d.js", std::vector<uint8_t>(entry_size * 2, 1));
+  EXPECT_FALSE(Load("d", "d.js", bytecode));
+  EXPECT_TRUE(Load("a", "a.js", bytecode));
+
+  cache->Configure("", 0);
+}
+
+TEST(CodeCache, entriesOfAnotherSourceAreRejected) {
+  std::string directory = CacheDirectory("webf_code_cache_collision");
+  CodeCache* cache = CodeCache::Shared();
+  cache->Configure(directory, 1 << 20);
+  Store("var a = 1;", "a.js", {1, 2, 3, 4});
+  Store("var b = 1;", "b.js", {5, 6, 7, 8});
+  std::vector<uint64_t> keys = IndexKeys(directory);
+  ASSERT_EQ(keys.size(), 2u);
+
+  // Same as if the keys of both sources collided: the file found for b.js was written for a.js.
+  std::vector<uint8_t> contents(4096);
+  FILE* entry = fopen(EntryPath(directory, keys[0]).c_str(), "rb");
+  ASSERT_NE(entry, nullptr);
+  contents.resize(fread(contents.data(), 1, contents.size(), entry));
+  fclose(entry);
+  entry = fopen(EntryPath(directory, keys[1]).c_str(), "wb");
+  ASSERT_NE(entry, nullptr);
+  fwrite(contents.data(), 1, contents.size(), entry);
+  fclose(entry);
+
+  std::vector<uint8_t> bytecode;
+  EXPECT_FALSE(Load("var b = 1;", "b.js", bytecode));
+  EXPECT_EQ(cache->stats().rejected, 1);
+  EXPECT_TRUE(Load("var a = 1;", "a.js", bytecode));
+  EXPECT_EQ(bytecode, (std::vector<uint8_t>{1, 2, 3, 4}));
+
+  cache->Configure("", 0);
+}
+
+TEST(CodeCache, hitsDoNotRewriteTheIndex) {
+  std::string directory = CacheDirectory("webf_code_cache_index");
+  CodeCache* cache = CodeCache::Shared();
+  cache->Configure(directory, 1 << 20);
+  Store("a", "a.js", {1});
+  Store("b", "b.js", {2});
+  std::vector<uint64_t> keys = IndexKeys(directory);
+  ASSERT_EQ(keys.size(), 2u);
+
+  std::vector<uint8_t> bytecode;
+  EXPECT_TRUE(Load("a", "a.js", bytecode));
+  EXPECT_EQ(IndexKeys(directory), keys);
+
+  cache->Flush();
+  EXPECT_EQ(IndexKeys(directory), (std::vector<uint64_t>{keys[1], keys[0]}));
+
+  cache->Configure("", 0);
+}
@@ -8,6 +8,7 @@
 
 #include <type_traits>
 #include "atomic_string.h"
+#include "bindings/qjs/dom_string.h"
 #include "bindings/qjs/union_base.h"
 #include "converter.h"
 #include "core/dom/events/event.h"
@@ -275,6 +276,44 @@ struct Converter<IDLLegacyDOMString> : public ConverterBase<IDLLegacyDOMString>
   static JSValue ToValue(JSContext* ctx, const AtomicString& value) { return value.ToQuickJS(ctx); }
 };
 
+template <>
+struct Converter<IDLNonAtomicString> : public ConverterBase<IDLNonAtomicString> {
+  static ImplType FromValue(JSContext* ctx, JSValue value, ExceptionState& exception_state) {
+    assert(!JS_IsException(value));
+    return String(ctx, value);
+  }
+
+  static JSValue ToValue(JSContext* ctx, const String& value) { return value.ToQuickJS(ctx); }
+  static JSValue ToValue(JSContext* ctx, const std::string& str) { return JS_NewString(ctx, str.c_str()); }
+};
+
+template <>
+struct Converter<IDLOptional<IDLNonAtomicString>> : public ConverterBase<IDLNonAtomicString> {
+  static ImplType FromValue(JSContext* ctx, JSValue value, ExceptionState& exception_state) {
+    if (JS_IsUndefined(value))
+      return String(ctx, AtomicString::Empty());
+    return Converter<IDLNonAtomicString>::FromValue(ctx, value, exception_state);
+  }
+
+  static JSValue ToValue(JSContext* ctx, const String& value) {
+    if (value.IsNull()) {
+      return JS_UNDEFINED;
+    }
+    return value.ToQuickJS(ctx);
+  }
+};
+
+template <>
+struct Converter<IDLNullable<IDLNonAtomicString>> : public ConverterBase<IDLNonAtomicString> {
+  static ImplType FromValue(JSContext* ctx, JSValue value, ExceptionState& exception_state) {
+    if (JS_IsNull(value) || JS_IsUndefined(value))
+      return String::Null();
+    return Converter<IDLNonAtomicString>::FromValue(ctx, value, exception_state);
+  }
+
+  static JSValue ToValue(JSContext* ctx, const String& value) { return value.ToQuickJS(ctx); }
+};
+
 template <typename T>
 struct Converter<IDLSequence<T>> : public ConverterBase<IDLSequence<T>> {
   using ImplType = typename IDLSequence<typename Converter<T>::ImplType>::ImplType;
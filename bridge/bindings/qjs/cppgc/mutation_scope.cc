@@ -10,7 +10,10 @@
 namespace webf {
 
 MemberMutationScope::MemberMutationScope(ExecutingContext* context)
-    : context_(context), runtime_(context->GetScriptState()->runtime()) {
+    : context_(context),
+      runtime_(context->GetScriptState()->runtime()),
+      mutation_records_(&context->mutationRecords()),
+      frame_begin_(mutation_records_->size()) {
   context->SetMutationScope(*this);
 }
 
@@ -28,19 +31,12 @@ MemberMutationScope* MemberMutationScope::Parent() const {
   return parent_scope_;
 }
 
-void MemberMutationScope::RecordFree(ScriptWrappable* wrappable) {
-  if (mutation_records_.count(wrappable) == 0) {
-    mutation_records_.insert(std::make_pair(wrappable, 0));
-  }
-  mutation_records_[wrappable]--;
-}
-
 void MemberMutationScope::ApplyRecord() {
-  for (auto& entry : mutation_records_) {
-    for (int i = 0; i < -entry.second; i++) {
-      JS_FreeValueRT(runtime_, entry.first->ToQuickJSUnsafe());
-    }
+  // Finalizers run by the frees may record more frees to this scope, they are applied as well.
+  for (size_t i = frame_begin_; i < mutation_records_->size(); i++) {
+    JS_FreeValueRT(runtime_, (*mutation_records_)[i]->ToQuickJSUnsafe());
   }
+  mutation_records_->resize(frame_begin_);
 }
 
 }  // namespace webf
@@ -7,7 +7,7 @@
 #define BRIDGE_BINDINGS_QJS_CPPGC_MUTATION_SCOPE_H_
 
 #include <quickjs/quickjs.h>
-#include <unordered_map>
+#include <vector>
 #include "foundation/macros.h"
 
 namespace webf {
@@ -17,6 +17,10 @@ class ScriptWrappable;
 
 /**
  * A stack-allocated class that record all members mutations in stack scope.
+ *
+ * The records of all scopes of a context are kept in one stack owned by the context, a scope only remembers where its
+ * frame begins. Nested scopes push their records above it and release them when they end, so opening a scope costs no
+ * allocation.
  */
 class MemberMutationScope {
   WEBF_DISALLOW_NEW();
@@ -29,7 +33,7 @@ class MemberMutationScope {
   void SetParent(MemberMutationScope* parent_scope);
   [[nodiscard]] MemberMutationScope* Parent() const;
 
-  void RecordFree(ScriptWrappable* wrappable);
+  FORCE_INLINE void RecordFree(ScriptWrappable* wrappable) { mutation_records_->emplace_back(wrappable); }
 
  private:
   void ApplyRecord();
@@ -37,7 +41,8 @@ class MemberMutationScope {
   MemberMutationScope* parent_scope_{nullptr};
   ExecutingContext* context_;
   JSRuntime* runtime_{nullptr};
-  std::unordered_map<ScriptWrappable*, int> mutation_records_;
+  std::vector<ScriptWrappable*>* mutation_records_;
+  size_t frame_begin_;
 };
 
 }  // namespace webf
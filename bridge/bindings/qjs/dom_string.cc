@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "dom_string.h"
+#include <cstring>
+
+namespace webf {
+
+String::String(JSContext* ctx, JSValueConst value) {
+  // Ropes and non string values are flattened into a new string.
+  Adopt(ctx, JS_ToString(ctx, value));
+}
+
+String::String(JSContext* ctx, const AtomicString& string) {
+  if (string.IsNull())
+    return;
+  // Shares the string of the atom, the atom table is not touched.
+  Adopt(ctx, JS_AtomToString(ctx, string.Impl()));
+}
+
+String::String(JSContext* ctx, const std::string& string) : String(ctx, string.c_str(), string.size()) {}
+
+String::String(JSContext* ctx, const char* str, size_t length) {
+  Adopt(ctx, JS_NewStringLen(ctx, str, length));
+}
+
+String::String(JSContext* ctx, const uint16_t* str, size_t length) {
+  Adopt(ctx, JS_NewUnicodeString(ctx, str, static_cast<uint32_t>(length)));
+}
+
+String::~String() {
+  Release();
+}
+
+String::String(const String& other) : runtime_(other.runtime_), impl_(other.impl_) {
+  if (impl_ != nullptr)
+    JS_DupValueRT(runtime_, JS_MKPTR(JS_TAG_STRING, impl_));
+}
+
+String& String::operator=(const String& other) {
+  if (&other != this) {
+    if (other.impl_ != nullptr)
+      JS_DupValueRT(other.runtime_, JS_MKPTR(JS_TAG_STRING, other.impl_));
+    Release();
+    runtime_ = other.runtime_;
+    impl_ = other.impl_;
+  }
+  return *this;
+}
+
+String::String(String&& other) noexcept : runtime_(other.runtime_), impl_(other.impl_) {
+  other.impl_ = nullptr;
+}
+
+String& String::operator=(String&& other) noexcept {
+  if (&other != this) {
+    Release();
+    runtime_ = other.runtime_;
+    impl_ = other.impl_;
+    other.impl_ = nullptr;
+  }
+  return *this;
+}
+
+JSValue String::ToQuickJS(JSContext* ctx) const {
+  if (impl_ == nullptr)
+    return JS_NULL;
+  return JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, impl_));
+}
+
+StringView String::ToStringView() const {
+  if (impl_ == nullptr)
+    return StringView(const_cast<char*>(""), 0, false);
+  return StringView(impl_->u.str8, impl_->len, impl_->is_wide_char);
+}
+
+std::string String::ToStdString(JSContext* ctx) const {
+  if (IsEmpty())
+    return "";
+
+  size_t len;
+  const char* buf = JS_ToCStringLen(ctx, &len, JS_MKPTR(JS_TAG_STRING, impl_));
+  std::string result = std::string(buf, len);
+  JS_FreeCString(ctx, buf);
+  return result;
+}
+
+std::unique_ptr<SharedNativeString> String::ToNativeString(JSContext* ctx) const {
+  if (impl_ == nullptr) {
+    // Null string is same like empty string
+    return AtomicString::Empty().ToNativeString(ctx);
+  }
+  uint32_t length;
+  uint16_t* bytes = JS_ToUnicode(ctx, JS_MKPTR(JS_TAG_STRING, impl_), &length);
+  return std::make_unique<SharedNativeString>(bytes, length);
+}
+
+AtomicString String::ToAtomicString(JSContext* ctx) const {
+  if (impl_ == nullptr)
+    return AtomicString::Null();
+  return AtomicString(ctx, JS_MKPTR(JS_TAG_STRING, impl_));
+}
+
+bool String::operator==(const String& other) const {
+  if (impl_ == other.impl_)
+    return true;
+  if (impl_ == nullptr || other.impl_ == nullptr || impl_->len != other.impl_->len)
+    return false;
+
+  uint32_t length = impl_->len;
+  if (impl_->is_wide_char == other.impl_->is_wide_char) {
+    return memcmp(impl_->u.str8, other.impl_->u.str8, impl_->is_wide_char ? length * 2 : length) == 0;
+  }
+
+  const uint8_t* narrow = impl_->is_wide_char ? other.impl_->u.str8 : impl_->u.str8;
+  const uint16_t* wide = impl_->is_wide_char ? impl_->u.str16 : other.impl_->u.str16;
+  for (uint32_t i = 0; i < length; i++) {
+    if (narrow[i] != wide[i])
+      return false;
+  }
+  return true;
+}
+
+void String::Adopt(JSContext* ctx, JSValue value) {
+  runtime_ = JS_GetRuntime(ctx);
+  if (JS_VALUE_GET_TAG(value) != JS_TAG_STRING) {
+    JS_FreeValue(ctx, value);
+    return;
+  }
+  impl_ = JS_VALUE_GET_STRING(value);
+}
+
+void String::Release() {
+  if (impl_ != nullptr)
+    JS_FreeValueRT(runtime_, JS_MKPTR(JS_TAG_STRING, impl_));
+  impl_ = nullptr;
+}
+
+}  // namespace webf
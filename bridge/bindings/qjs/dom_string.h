@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_BINDINGS_QJS_DOM_STRING_H_
+#define BRIDGE_BINDINGS_QJS_DOM_STRING_H_
+
+#include <quickjs/quickjs.h>
+#include <memory>
+#include <string>
+#include "atomic_string.h"
+#include "foundation/macros.h"
+#include "foundation/native_string.h"
+#include "foundation/string_view.h"
+#include "qjs_engine_patch.h"
+
+namespace webf {
+
+// A String holds a reference to a flat QuickJS string without interning it into the atom table of the runtime.
+//
+// Use it for payloads which are never compared by identity, such as the data of text nodes, where every new value
+// would otherwise be hashed and kept in the atom table until its last AtomicString is released. Tag, attribute and
+// property names stay AtomicString.
+class String {
+  WEBF_DISALLOW_NEW();
+
+ public:
+  static String Null() { return String(); }
+
+  String() = default;
+  String(JSContext* ctx, JSValueConst value);
+  String(JSContext* ctx, const AtomicString& string);
+  String(JSContext* ctx, const std::string& string);
+  String(JSContext* ctx, const char* str, size_t length);
+  String(JSContext* ctx, const uint16_t* str, size_t length);
+  ~String();
+
+  String(const String& other);
+  String& operator=(const String& other);
+  String(String&& other) noexcept;
+  String& operator=(String&& other) noexcept;
+
+  // Returns a new reference to the string value, or null for the null string.
+  JSValue ToQuickJS(JSContext* ctx) const;
+
+  bool IsNull() const { return impl_ == nullptr; }
+  bool IsEmpty() const { return impl_ == nullptr || impl_->len == 0; }
+  int64_t length() const { return impl_ == nullptr ? 0 : impl_->len; }
+
+  StringView ToStringView() const;
+
+  [[nodiscard]] std::string ToStdString(JSContext* ctx) const;
+  [[nodiscard]] std::unique_ptr<SharedNativeString> ToNativeString(JSContext* ctx) const;
+  // Interns the string. Only call this where an identifier is required.
+  [[nodiscard]] AtomicString ToAtomicString(JSContext* ctx) const;
+
+  // Compares the characters of both strings.
+  bool operator==(const String& other) const;
+  bool operator!=(const String& other) const { return !(*this == other); }
+
+ private:
+  void Adopt(JSContext* ctx, JSValue value);
+  void Release();
+
+  JSRuntime* runtime_{nullptr};
+  JSString* impl_{nullptr};
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_BINDINGS_QJS_DOM_STRING_H_
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "dom_string.h"
+#include <quickjs/quickjs.h>
+#include "built_in_string.h"
+#include "gtest/gtest.h"
+#include "qjs_engine_patch.h"
+
+using namespace webf;
+
+using TestCallback = void (*)(JSContext* ctx);
+
+static void TestString(TestCallback callback) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+
+  built_in_string::Init(ctx);
+
+  callback(ctx);
+
+  JS_FreeContext(ctx);
+
+  built_in_string::Dispose();
+  JS_FreeRuntime(runtime);
+}
+
+static int64_t AtomCount(JSContext* ctx) {
+  JSMemoryUsage usage;
+  JS_ComputeMemoryUsage(JS_GetRuntime(ctx), &usage);
+  return usage.atom_count;
+}
+
+TEST(String, Null) {
+  TestString([](JSContext* ctx) {
+    String string = String::Null();
+    EXPECT_TRUE(string.IsNull());
+    EXPECT_TRUE(string.IsEmpty());
+    EXPECT_EQ(string.length(), 0);
+    EXPECT_EQ(string.ToStdString(ctx), "");
+    EXPECT_TRUE(JS_IsNull(string.ToQuickJS(ctx)));
+    EXPECT_TRUE(string.ToAtomicString(ctx).IsNull());
+  });
+}
+
+TEST(String, DoesNotAddAtoms) {
+  TestString([](JSContext* ctx) {
+    int64_t atom_count = AtomCount(ctx);
+    {
+      String string = String(ctx, "a text payload which is not an identifier");
+      String copy = string;
+      EXPECT_EQ(copy.ToStdString(ctx), "a text payload which is not an identifier");
+      EXPECT_EQ(AtomCount(ctx), atom_count);
+
+      AtomicString atomic_string = copy.ToAtomicString(ctx);
+      EXPECT_EQ(AtomCount(ctx), atom_count + 1);
+    }
+    EXPECT_EQ(AtomCount(ctx), atom_count);
+  });
+}
+
+TEST(String, SharesAtomicStringStorage) {
+  TestString([](JSContext* ctx) {
+    AtomicString atomic_string = AtomicString(ctx, "helloworld");
+    String string = String(ctx, atomic_string);
+    EXPECT_EQ(string.length(), 10);
+    EXPECT_EQ(string.ToStringView().Characters8(), atomic_string.ToStringView().Characters8());
+    EXPECT_EQ(string.ToAtomicString(ctx), atomic_string);
+  });
+}
+
+TEST(String, CompareAcrossWidths) {
+  TestString([](JSContext* ctx) {
+    uint16_t wide[] = {'t', 'e', 'x', 't'};
+    String narrow_string = String(ctx, "text");
+    String wide_string = String(ctx, wide, 4);
+    EXPECT_TRUE(narrow_string.ToStringView().Is8Bit());
+    EXPECT_FALSE(wide_string.ToStringView().Is8Bit());
+    EXPECT_TRUE(narrow_string == wide_string);
+    EXPECT_TRUE(narrow_string != String(ctx, "texts"));
+    EXPECT_TRUE(narrow_string != String::Null());
+  });
+}
+
+TEST(String, FlattensConcatenatedValues) {
+  TestString([](JSContext* ctx) {
+    const char* code = "let s = ''; for (let i = 0; i < 100; i++) s += 'ab'; s";
+    JSValue value = JS_Eval(ctx, code, strlen(code), "vm://", JS_EVAL_TYPE_GLOBAL);
+    String string = String(ctx, value);
+    JS_FreeValue(ctx, value);
+    EXPECT_EQ(string.length(), 200);
+    EXPECT_EQ(string.ToStdString(ctx).substr(0, 4), "abab");
+
+    JSValue result = string.ToQuickJS(ctx);
+    EXPECT_EQ(JS_VALUE_GET_TAG(result), JS_TAG_STRING);
+    JS_FreeValue(ctx, result);
+  });
+}
+
+TEST(String, ToNativeString) {
+  TestString([](JSContext* ctx) {
+    String string = String(ctx, "caf\xC3\xA9");
+    auto native_string = string.ToNativeString(ctx);
+    EXPECT_EQ(native_string->length(), 4);
+    EXPECT_EQ(native_string->string()[3], 0xe9);
+  });
+}
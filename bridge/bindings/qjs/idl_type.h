@@ -53,6 +53,10 @@ struct IDLDOMString final : public IDLTypeBaseHelper<AtomicString> {};
 // https://webidl.spec.whatwg.org/#LegacyNullToEmptyString
 struct IDLLegacyDOMString final : public IDLTypeBaseHelper<AtomicString> {};
 
+// DOMString which is stored without being added to the atom table, see dom_string.h.
+class String;
+struct IDLNonAtomicString final : public IDLTypeBaseHelper<String> {};
+
 // https://developer.mozilla.org/en-US/docs/Web/API/USVString
 struct IDLUSVString final : public IDLTypeBaseHelper<AtomicString> {};
 
@@ -64,85 +64,6 @@ struct JSShape {
   JSShapeProperty prop[0]; /* prop_size elements */
 };
 
-struct JSClass {
-  uint32_t class_id; /* 0 means free entry */
-  JSAtom class_name;
-  JSClassFinalizer* finalizer;
-  JSClassGCMark* gc_mark;
-  JSClassCall* call;
-  /* pointers for exotic behavior, can be NULL if none are present */
-  const JSClassExoticMethods* exotic;
-};
-
-struct JSRuntime {
-  JSMallocFunctions mf;
-  JSMallocState malloc_state;
-  const char* rt_info;
-
-  int atom_hash_size; /* power of two */
-  int atom_count;
-  int atom_size;
-  int atom_count_resize; /* resize hash table at this count */
-  uint32_t* atom_hash;
-  JSString** atom_array;
-  int atom_free_index; /* 0 = none */
-
-  int class_count; /* size of class_array */
-  JSClass* class_array;
-
-  struct list_head context_list; /* list of JSContext.link */
-  /* list of JSGCObjectHeader.link. List of allocated GC objects (used
-     by the garbage collector) */
-  struct list_head gc_obj_list;
-  /* list of JSGCObjectHeader.link. Used during JS_FreeValueRT() */
-  struct list_head gc_zero_ref_count_list;
-  struct list_head tmp_obj_list; /* used during GC */
-  JSGCPhaseEnum gc_phase : 8;
-  size_t malloc_gc_threshold;
-#ifdef DUMP_LEAKS
-  struct list_head string_list; /* list of JSString.link */
-#endif
-  /* stack limitation */
-  const uint8_t* stack_top;
-  size_t stack_size; /* in bytes */
-
-  JSValue current_exception;
-  /* true if inside an out of memory error, to avoid recursing */
-  BOOL in_out_of_memory : 8;
-
-  struct JSStackFrame* current_stack_frame;
-
-  JSInterruptHandler* interrupt_handler;
-  void* interrupt_opaque;
-
-  JSHostPromiseRejectionTracker* host_promise_rejection_tracker;
-  void* host_promise_rejection_tracker_opaque;
-
-  struct list_head job_list; /* list of JSJobEntry.link */
-
-  JSModuleNormalizeFunc* module_normalize_func;
-  JSModuleLoaderFunc* module_loader_func;
-  void* module_loader_opaque;
-
-  BOOL can_block : 8; /* TRUE if Atomics.wait can block */
-  /* used to allocate, free and clone SharedArrayBuffers */
-  JSSharedArrayBufferFunctions sab_funcs;
-
-  /* Shape hash table */
-  int shape_hash_bits;
-  int shape_hash_size;
-  int shape_hash_count; /* number of hashed shapes */
-  JSShape** shape_hash;
-#ifdef CONFIG_BIGNUM
-  bf_context_t bf_ctx;
-  JSNumericOperations bigint_ops;
-  JSNumericOperations bigfloat_ops;
-  JSNumericOperations bigdecimal_ops;
-  uint32_t operator_count;
-#endif
-  void* user_opaque;
-};
-
 typedef struct JSRegExp {
   JSString* pattern;
   JSString* bytecode; /* also contains the flags */
@@ -290,54 +211,12 @@ uint16_t* JS_ToUnicode(JSContext* ctx, JSValueConst value, uint32_t* length) {
   return buffer;
 }
 
-static JSString* js_alloc_string_rt(JSRuntime* rt, int max_len, int is_wide_char) {
-  JSString* str;
-  str = static_cast<JSString*>(js_malloc_rt(rt, sizeof(JSString) + (max_len << is_wide_char) + 1 - is_wide_char));
-  if (unlikely(!str))
-    return NULL;
-  str->header.ref_count = 1;
-  str->is_wide_char = is_wide_char;
-  str->len = max_len;
-  str->atom_type = 0;
-  str->hash = 0;      /* optional but costless */
-  str->hash_next = 0; /* optional */
-#ifdef DUMP_LEAKS
-  list_add_tail(&str->link, &rt->string_list);
-#endif
-  return str;
-}
-
-static JSString* js_alloc_string(JSRuntime* runtime, JSContext* ctx, int max_len, int is_wide_char) {
-  JSString* p;
-  p = js_alloc_string_rt(runtime, max_len, is_wide_char);
-  if (unlikely(!p)) {
-    JS_ThrowOutOfMemory(ctx);
-    return NULL;
-  }
-  return p;
-}
-
 JSValue JS_NewUnicodeString(JSContext* ctx, const uint16_t* code, uint32_t length) {
-  JSString* str;
-  str = js_alloc_string(JS_GetRuntime(ctx), ctx, length, 1);
-  if (!str)
-    return JS_EXCEPTION;
-  memcpy(str->u.str16, code, length * 2);
-  return JS_MKPTR(JS_TAG_STRING, str);
+  return JS_NewTwoByteString(ctx, code, length);
 }
 
 JSValue JS_NewRawUTF8String(JSContext* ctx, const uint8_t* buf, uint32_t len) {
-  JSString* str;
-
-  if (len <= 0) {
-    return JS_AtomToString(ctx, JS_ATOM_empty_string);
-  }
-  str = js_alloc_string(JS_GetRuntime(ctx), ctx, len, 0);
-  if (!str)
-    return JS_EXCEPTION;
-  memcpy(str->u.str8, buf, len);
-  str->u.str8[len] = '\0';
-  return JS_MKPTR(JS_TAG_STRING, str);
+  return JS_NewOneByteString(ctx, buf, len);
 }
 
 JSAtom JS_NewUnicodeAtom(JSContext* ctx, const uint16_t* code, uint32_t length) {
@@ -384,15 +263,13 @@ bool JS_IsArrayBufferView(JSValue value) {
 }
 
 bool JS_HasClassId(JSRuntime* runtime, JSClassID classId) {
-  if (runtime->class_count <= classId)
-    return false;
-  return runtime->class_array[classId].class_id == classId;
+  return JS_IsRegisteredClass(runtime, classId);
 }
 
 int JS_AtomIs8Bit(JSRuntime* runtime, JSAtom atom) {
   if (JS_AtomIsTaggedInt(atom))
     return true;
-  JSString* string = runtime->atom_array[atom];
+  JSString* string = JS_GetAtomString(runtime, atom);
   return string->is_wide_char == 0;
 }
 
@@ -403,7 +280,7 @@ const uint8_t* JS_AtomRawCharacter8(JSRuntime* runtime, JSAtom atom) {
     return reinterpret_cast<uint8_t*>(buf);
   }
 
-  JSString* string = runtime->atom_array[atom];
+  JSString* string = JS_GetAtomString(runtime, atom);
   return string->u.str8;
 }
 
@@ -414,12 +291,12 @@ const uint16_t* JS_AtomRawCharacter16(JSRuntime* runtime, JSAtom atom) {
     return reinterpret_cast<uint16_t*>(buf);
   }
 
-  JSString* string = runtime->atom_array[atom];
+  JSString* string = JS_GetAtomString(runtime, atom);
   return string->u.str16;
 }
 
 int JS_FindCharacterInAtom(JSRuntime* runtime, JSAtom atom, bool (*CharacterMatchFunction)(char)) {
-  JSString* string = runtime->atom_array[atom];
+  JSString* string = JS_GetAtomString(runtime, atom);
   for (int i = 0; i < string->len; i++) {
     if (CharacterMatchFunction(static_cast<char>(string->u.str8[i]))) {
       return i;
@@ -429,7 +306,7 @@ int JS_FindCharacterInAtom(JSRuntime* runtime, JSAtom atom, bool (*CharacterMatc
 }
 
 int JS_FindWCharacterInAtom(JSRuntime* runtime, JSAtom atom, bool (*CharacterMatchFunction)(uint16_t)) {
-  JSString* string = runtime->atom_array[atom];
+  JSString* string = JS_GetAtomString(runtime, atom);
   for (int i = 0; i < string->len; i++) {
     if (CharacterMatchFunction(string->u.str16[i])) {
       return i;
@@ -443,11 +320,7 @@ JSValue JS_GetProxyTarget(JSValue value) {
   return p->u.proxy_data->target;
 }
 
-JSGCPhaseEnum JS_GetEnginePhase(JSRuntime* runtime) {
-  return runtime->gc_phase;
-}
-
 webf::StringView JSAtomToStringView(JSRuntime* runtime, JSAtom atom) {
-  JSString* string = runtime->atom_array[atom];
+  JSString* string = JS_GetAtomString(runtime, atom);
   return webf::StringView(string->u.str8, string->len, string->is_wide_char);
 }
@@ -32,12 +32,6 @@ struct JSString {
   } u;
 };
 
-typedef enum {
-  JS_GC_PHASE_NONE,
-  JS_GC_PHASE_DECREF,
-  JS_GC_PHASE_REMOVE_CYCLES,
-} JSGCPhaseEnum;
-
 enum {
   /* classid tag        */ /* union usage   | properties */
   JS_CLASS_OBJECT = 1,     /* must be first */
@@ -133,7 +127,6 @@ const uint16_t* JS_AtomRawCharacter16(JSRuntime* runtime, JSAtom atom);
 int JS_FindCharacterInAtom(JSRuntime* runtime, JSAtom atom, bool (*CharacterMatchFunction)(char));
 int JS_FindWCharacterInAtom(JSRuntime* runtime, JSAtom atom, bool (*CharacterMatchFunction)(uint16_t));
 JSValue JS_GetProxyTarget(JSValue value);
-JSGCPhaseEnum JS_GetEnginePhase(JSRuntime* runtime);
 
 static inline bool JS_AtomIsTaggedInt(JSAtom v) {
   return (v & JS_ATOM_TAG_INT) != 0;
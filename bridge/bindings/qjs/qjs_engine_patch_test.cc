@@ -100,3 +100,220 @@ TEST(JS_NewUnicodeString, fromChieseCode) {
   JS_FreeContext(ctx);
   JS_FreeRuntime(runtime);
 }
+
+TEST(JS_ToUnicode, concatenatedString) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  // Long concatenations are built as ropes.
+  const char* code = "let s = ''; for (let i = 0; i < 300; i++) s += 'ab'; s";
+  JSValue value = JS_Eval(ctx, code, strlen(code), "internal://", JS_EVAL_TYPE_GLOBAL);
+  EXPECT_EQ(JS_IsString(value), true);
+
+  uint32_t length;
+  uint16_t* buffer = JS_ToUnicode(ctx, value, &length);
+  EXPECT_EQ(length, 600);
+  for (int i = 0; i < length; i++) {
+    EXPECT_EQ(buffer[i], i % 2 == 0 ? 'a' : 'b');
+  }
+
+  delete buffer;
+  JS_FreeValue(ctx, value);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(JS_RunGCSlice, collectsCycles) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  JS_SetGCIncremental(runtime, true, 64);
+  const char* code =
+      "globalThis.kept = [];"
+      "for (let i = 0; i < 1000; i++) { let a = {}; let b = { a }; a.b = b; if (i % 10 == 0) kept.push(a); }";
+  JS_FreeValue(ctx, JS_Eval(ctx, code, strlen(code), "internal://", JS_EVAL_TYPE_GLOBAL));
+
+  // The pass visits every object, however small the slices.
+  int slices = 1;
+  while (JS_RunGCSlice(runtime, 64))
+    slices++;
+  JSGCStats stats;
+  JS_GetGCStats(runtime, &stats);
+  EXPECT_GT(slices, 1);
+  EXPECT_EQ(stats.full_count, 0);
+  EXPECT_EQ(stats.pass_count, 1);
+  // The cycles are still young, freed before the first slice.
+  EXPECT_EQ(stats.young_count, 1);
+  EXPECT_EQ(stats.freed_count, 900 * 2);
+
+  // Nothing to do until the heap grows.
+  EXPECT_FALSE(JS_RunGCSlice(runtime, 64));
+  const char* check = "kept.every((a) => a.b.a === a) ? kept.length : -1";
+  JSValue result = JS_Eval(ctx, check, strlen(check), "internal://", JS_EVAL_TYPE_GLOBAL);
+  int32_t length;
+  JS_ToInt32(ctx, &length, result);
+  EXPECT_EQ(length, 100);
+
+  JS_FreeValue(ctx, result);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(JS_RunGC, youngCyclesAreCollectedWithoutFullCollection) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  const char* setup = "globalThis.old = []; for (let i = 0; i < 10000; i++) old.push({ i });";
+  JS_FreeValue(ctx, JS_Eval(ctx, setup, strlen(setup), "internal://", JS_EVAL_TYPE_GLOBAL));
+  JS_RunGC(runtime);
+  JSGCStats stats;
+  JS_GetGCStats(runtime, &stats);
+  int64_t full_count = stats.full_count;
+
+  // Allocates far more than the heap, in short lived cycles.
+  const char* code =
+      "for (let i = 0; i < 200000; i++) { let a = { i }; let b = { a }; a.b = b; }"
+      "old.every((o, i) => o.i === i)";
+  JSValue result = JS_Eval(ctx, code, strlen(code), "internal://", JS_EVAL_TYPE_GLOBAL);
+  EXPECT_TRUE(JS_ToBool(ctx, result));
+
+  JS_GetGCStats(runtime, &stats);
+  EXPECT_GT(stats.young_count, 0);
+  EXPECT_GT(stats.freed_count, 100000);
+  // The heap never doubled.
+  EXPECT_EQ(stats.full_count, full_count);
+
+  JS_FreeValue(ctx, result);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(JS_EnableSlabAllocator, exactAccounting) {
+  JSRuntime* runtime = JS_NewRuntime();
+  if (!JS_EnableSlabAllocator(runtime, true)) {
+    JS_FreeRuntime(runtime);
+    GTEST_SKIP() << "built without CONFIG_SLAB_ALLOC";
+  }
+  JSMemoryUsage before, usage;
+  JS_ComputeMemoryUsage(runtime, &before);
+
+  // Enough blocks for several pages of the 32 bytes class.
+  std::vector<void*> blocks;
+  for (int i = 0; i < 10000; i++) {
+    blocks.push_back(js_malloc_rt(runtime, 24));
+    memset(blocks.back(), i, 24);
+  }
+  JS_ComputeMemoryUsage(runtime, &usage);
+  EXPECT_EQ(usage.malloc_count - before.malloc_count, 10000);
+  EXPECT_EQ(usage.malloc_size - before.malloc_size, 10000 * 32);
+
+  // Growing out of the slab sizes keeps the content.
+  blocks[0] = js_realloc_rt(runtime, blocks[0], 1000);
+  EXPECT_EQ(static_cast<uint8_t*>(blocks[0])[23], 0);
+  EXPECT_EQ(static_cast<uint8_t*>(blocks[1])[23], 1);
+
+  // The blocks allocated before remain valid once disabled.
+  JS_EnableSlabAllocator(runtime, false);
+  for (void* block : blocks)
+    js_free_rt(runtime, block);
+  JS_ComputeMemoryUsage(runtime, &usage);
+  EXPECT_EQ(usage.malloc_count, before.malloc_count);
+
+  JS_FreeRuntime(runtime);
+}
+
+TEST(JS_DumpInlineCacheStats, megamorphicSite) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  // More receiver shapes than the inline cache of a site keeps, with the property in the prototype.
+  const char* code =
+      "class Base {} Base.prototype.kind = 1;"
+      "class Element extends Base {}"
+      "const elements = [];"
+      "for (let i = 0; i < 16; i++) { const e = new Element(); e['f' + i] = i; elements.push(e); }"
+      "function readKind(e) { return e.kind; }"
+      "let sum = 0; for (let r = 0; r < 100; r++) for (const e of elements) sum += readKind(e);"
+      "Base.prototype.kind = 2;"
+      "for (const e of elements) sum += readKind(e);"
+      "sum";
+  JSValue function = JS_Eval(ctx, code, strlen(code), "internal://", JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+  JSValue result = JS_EvalFunction(ctx, JS_DupValue(ctx, function));
+  int32_t sum;
+  JS_ToInt32(ctx, &sum, result);
+  EXPECT_EQ(sum, 1600 + 32);
+
+  char* buffer;
+  size_t size;
+  FILE* stream = open_memstream(&buffer, &size);
+  JS_DumpInlineCacheStats(stream, ctx, function);
+  fclose(stream);
+  std::string stats(buffer, size);
+  free(buffer);
+  size_t kind = stats.find("kind", stats.find("readKind ("));
+  ASSERT_NE(kind, std::string::npos) << stats;
+  std::string line = stats.substr(kind, stats.find('\n', kind) - kind);
+  EXPECT_NE(line.find("megamorphic"), std::string::npos) << stats;
+  unsigned hits, misses;
+  ASSERT_EQ(sscanf(line.c_str() + line.find("shapes"), "shapes %u hits %u misses", &hits, &misses), 2) << line;
+  // Only the first access of each shape misses, the very first one is not counted as it comes before the site uses
+  // its cache.
+  EXPECT_EQ(misses, 15u);
+  EXPECT_EQ(hits, 1600u);
+
+  JS_FreeValue(ctx, function);
+  JS_FreeValue(ctx, result);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(JS_DumpInlineCacheStats, megamorphicSetSite) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  // The set sites share the megamorphic cache with the get sites, which also cache read only properties.
+  const char* code =
+      "let calls = 0;"
+      "function make(i, descriptor) {"
+      "  const o = {}; o['f' + i] = i; Object.defineProperty(o, 'x', descriptor); return o;"
+      "}"
+      "const readOnly = [], accessors = [];"
+      "for (let i = 0; i < 8; i++) {"
+      "  readOnly.push(make(i, { value: 1, writable: false, configurable: true }));"
+      "  accessors.push(make(i, { get() { return 1; }, set(v) { calls++; }, configurable: true }));"
+      "}"
+      "function read(o) { return o.x; }"
+      "function write(o) { o.x = 2; }"
+      "for (let i = 0; i < 8; i++) { const o = {}; o['w' + i] = i; o.x = 0; write(o); write(o); }"
+      "for (let r = 0; r < 3; r++) for (const o of readOnly.concat(accessors)) read(o);"
+      "for (let r = 0; r < 3; r++) for (const o of readOnly.concat(accessors)) write(o);"
+      "readOnly.concat(accessors).map(read).join('') + calls";
+  JSValue result = JS_Eval(ctx, code, strlen(code), "internal://", JS_EVAL_TYPE_GLOBAL);
+  const char* string = JS_ToCString(ctx, result);
+  EXPECT_STREQ(string, "111111111111111124");
+
+  JS_FreeCString(ctx, string);
+  JS_FreeValue(ctx, result);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+static JSGCPhaseEnum finalizer_phase = JS_GC_PHASE_NONE;
+
+TEST(JS_GetEnginePhase, removeCyclesInFinalizers) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  JSClassID class_id = 0;
+  JS_NewClassID(&class_id);
+  JSClassDef class_def{"PhaseProbe", [](JSRuntime* rt, JSValue value) { finalizer_phase = JS_GetEnginePhase(rt); }};
+  JS_NewClass(runtime, class_id, &class_def);
+  EXPECT_TRUE(JS_HasClassId(runtime, class_id));
+  EXPECT_EQ(JS_GetEnginePhase(runtime), JS_GC_PHASE_NONE);
+
+  // Only the cycle collector frees the probe, referenced by a cycle.
+  JSValue cycle = JS_NewObject(ctx);
+  JS_SetPropertyStr(ctx, cycle, "self", JS_DupValue(ctx, cycle));
+  JS_SetPropertyStr(ctx, cycle, "probe", JS_NewObjectClass(ctx, class_id));
+  JS_FreeValue(ctx, cycle);
+  JS_RunGC(runtime);
+  EXPECT_EQ(finalizer_phase, JS_GC_PHASE_REMOVE_CYCLES);
+  EXPECT_EQ(JS_GetEnginePhase(runtime), JS_GC_PHASE_NONE);
+
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
@@ -301,6 +301,21 @@ void ScriptWrappable::InitializeQuickJSObject() {
   JS_SetPrototype(ctx_, jsObject_, prototype);
 }
 
+void ScriptWrappable::InitializeQuickJSObjectWithPrototype(JSClassID class_id,
+                                                           const char* class_name,
+                                                           JSValueConst prototype) {
+  if (!JS_HasClassId(runtime_, class_id)) {
+    JSClassDef def{};
+    def.class_name = class_name;
+    def.gc_mark = HandleJSObjectGCMark;
+    def.finalizer = HandleJSObjectFinalized;
+    JS_NewClass(runtime_, class_id, &def);
+  }
+
+  jsObject_ = JS_NewObjectProtoClass(ctx_, prototype, class_id);
+  JS_SetOpaque(jsObject_, this);
+}
+
 WebFValueStatus* ScriptWrappable::KeepAlive() {
   if (alive_count == 0) {
     context_->RegisterActiveScriptWrappers(this);
@@ -68,6 +68,11 @@ class ScriptWrappable : public GarbageCollected<ScriptWrappable> {
   WebFValueStatus* KeepAlive();
   void ReleaseAlive();
 
+ protected:
+  // Creates the JavaScript object of this wrapper from |class_id|, which has no exotic behavior, and |prototype|.
+  // Property lookups then only go through the object and its prototype chain, where the engine caches them.
+  void InitializeQuickJSObjectWithPrototype(JSClassID class_id, const char* class_name, JSValueConst prototype);
+
  private:
   uint32_t alive_count = 0;
   JSValue jsObject_{JS_NULL};
@@ -61,6 +61,8 @@ enum {
   JS_CLASS_HTML_COLLECTION,
   JS_CLASS_HTML_ELEMENT,
   JS_CLASS_WIDGET_ELEMENT,
+  // WidgetElements whose properties and methods are defined in a prototype per tag name.
+  JS_CLASS_WIDGET_ELEMENT_WITH_SHAPE,
   JS_CLASS_HTML_DIV_ELEMENT,
   JS_CLASS_HTML_BODY_ELEMENT,
   JS_CLASS_HTML_HEAD_ELEMENT,
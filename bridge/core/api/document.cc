@@ -110,8 +110,8 @@ WebFValue<Text, TextNodePublicMethods> DocumentPublicMethods::CreateTextNode(
     webf::SharedExceptionState* shared_exception_state) {
   auto* document = static_cast<webf::Document*>(ptr);
   MemberMutationScope scope{document->GetExecutingContext()};
-  webf::AtomicString data_atomic = webf::AtomicString(document->ctx(), data);
-  Text* text_node = document->createTextNode(data_atomic, shared_exception_state->exception_state);
+  webf::String data_string = webf::String(document->ctx(), data);
+  Text* text_node = document->createTextNode(data_string, shared_exception_state->exception_state);
 
   if (shared_exception_state->exception_state.HasException()) {
     return WebFValue<Text, TextNodePublicMethods>::Null();
@@ -145,8 +145,8 @@ WebFValue<Comment, CommentPublicMethods> DocumentPublicMethods::CreateComment(
     webf::SharedExceptionState* shared_exception_state) {
   auto* document = static_cast<webf::Document*>(ptr);
   MemberMutationScope scope{document->GetExecutingContext()};
-  webf::AtomicString data_atomic = webf::AtomicString(document->ctx(), data);
-  Comment* comment = document->createComment(data_atomic, shared_exception_state->exception_state);
+  webf::String data_string = webf::String(document->ctx(), data);
+  Comment* comment = document->createComment(data_string, shared_exception_state->exception_state);
 
   if (shared_exception_state->exception_state.HasException()) {
     return WebFValue<Comment, CommentPublicMethods>::Null();
@@ -3,9 +3,11 @@
  */
 
 #include "plugin_api/element.h"
+#include <cstring>
 #include "core/api/exception_state.h"
 #include "core/dom/container_node.h"
 #include "core/dom/element.h"
+#include "core/dom/markup_serializer.h"
 
 namespace webf {
 
@@ -35,4 +37,14 @@ void ElementPublicMethods::ToBlobWithDevicePixelRatio(Element* ptr,
   return element->toBlob(device_pixel_ratio, callback_impl, shared_exception_state->exception_state);
 }
 
+const char* ElementPublicMethods::OuterHTML(Element* ptr) {
+  auto* element = static_cast<webf::Element*>(ptr);
+  return strdup(MarkupSerializer::ForCurrentThread().SerializeElement(*element).c_str());
+}
+
+const char* ElementPublicMethods::InnerHTML(Element* ptr) {
+  auto* element = static_cast<webf::Element*>(ptr);
+  return strdup(MarkupSerializer::ForCurrentThread().SerializeChildren(*element).c_str());
+}
+
 }  // namespace webf
@@ -16,6 +16,12 @@
 
 namespace webf {
 
+// Binding methods which only read the layout from dart.
+static bool IsGeometryQueryMethod(const AtomicString& method) {
+  return method == binding_call_methods::kgetBoundingClientRect || method == binding_call_methods::kgetClientRects ||
+         method == binding_call_methods::k__prefetch_bounding_client_rects__;
+}
+
 static void ReturnEventResultToDart(Dart_Handle persistent_handle,
                                     NativeValue* result,
                                     DartInvokeResultCallback result_callback) {
@@ -60,6 +66,9 @@ void NativeBindingObject::HandleCallFromDartSide(const DartIsolateContext* dart_
 
   dart_isolate_context->profiler()->StartTrackEvaluation(profile_id);
 
+  // Events dispatched from dart (resize, scroll, load...) follow a layout, the geometry read before is stale.
+  binding_object->binding_target_->GetExecutingContext()->uiCommandBuffer()->BumpLayoutEpoch();
+
   const AtomicString method =
       AtomicString(binding_object->binding_target_->ctx(),
                    std::unique_ptr<AutoFreeNativeString>(static_cast<AutoFreeNativeString*>(native_method->u.ptr)));
@@ -161,6 +170,10 @@ NativeValue BindingObject::InvokeBindingMethod(const AtomicString& method,
       GetExecutingContext()->contextId(), profiler->link_id(), binding_object_, &return_value, &native_method, argc,
       argv);
 
+  if (!IsGeometryQueryMethod(method)) {
+    context->uiCommandBuffer()->BumpLayoutEpoch();
+  }
+
 #if ENABLE_LOG
   WEBF_LOG(INFO) << "[Dispatcher]: PostToDartSync method: InvokeBindingMethod; Call End";
 #endif
@@ -219,6 +232,11 @@ NativeValue BindingObject::InvokeBindingMethod(BindingMethodCallOperations bindi
       },
       context->contextId(), profiler->link_id(), binding_object_, &return_value, &native_method, argc, argv);
 
+  // Everything but reading a property may have changed the layout on the dart side.
+  if (binding_method_call_operation != BindingMethodCallOperations::kGetProperty) {
+    context->uiCommandBuffer()->BumpLayoutEpoch();
+  }
+
 #if ENABLE_LOG
   WEBF_LOG(INFO) << "[Dispatcher]: PostToDartSync method: InvokeBindingMethod; Call End";
 #endif
@@ -239,11 +257,23 @@ NativeValue BindingObject::GetBindingProperty(const AtomicString& prop,
     return Native_NewNull();
   }
 
+  // Layout dependent values stay valid until something which may affect layout happens.
+  GeometryCache* geometry_cache =
+      isUICommandReasonDependsOnLayout(reason) ? GetExecutingContext()->geometryCache() : nullptr;
+  NativeValue cached_result;
+  if (geometry_cache != nullptr && geometry_cache->GetProperty(binding_object_, prop, cached_result)) {
+    return cached_result;
+  }
+
   GetExecutingContext()->dartIsolateContext()->profiler()->StartTrackSteps("BindingObject::GetBindingProperty");
 
   const NativeValue argv[] = {Native_NewString(prop.ToNativeString(GetExecutingContext()->ctx()).release())};
   NativeValue result = InvokeBindingMethod(BindingMethodCallOperations::kGetProperty, 1, argv, reason, exception_state);
 
+  if (geometry_cache != nullptr && !exception_state.HasException()) {
+    geometry_cache->SetProperty(binding_object_, prop, result);
+  }
+
   GetExecutingContext()->dartIsolateContext()->profiler()->FinishTrackSteps();
 
   return result;
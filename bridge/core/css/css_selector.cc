@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "css_selector.h"
+
+namespace webf {
+
+bool CSSSelector::MatchNth(int count) const {
+  if (nth_a_ == 0)
+    return count == nth_b_;
+  if (nth_a_ > 0) {
+    if (count < nth_b_)
+      return false;
+    return (count - nth_b_) % nth_a_ == 0;
+  }
+  // a < 0, e.g. -n+3 matches the first three positions.
+  if (count > nth_b_)
+    return false;
+  return (nth_b_ - count) % (-nth_a_) == 0;
+}
+
+}  // namespace webf
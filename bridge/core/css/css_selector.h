@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef WEBF_CORE_CSS_CSS_SELECTOR_H_
+#define WEBF_CORE_CSS_CSS_SELECTOR_H_
+
+#include <memory>
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
+
+namespace webf {
+
+class CSSSelectorList;
+
+// A simple selector, see https://drafts.csswg.org/selectors/#simple.
+//
+// Complex selectors are stored as a flat vector of simple selectors, ordered from the rightmost compound selector to
+// the leftmost one. Simple selectors in the same compound selector have the kSubSelector relation, the last simple
+// selector of a compound selector holds the relation to the compound selector on its left.
+//
+//   "div > p.a"  =>  [p (kSubSelector), .a (kChild), div (kSubSelector)]
+class CSSSelector {
+ public:
+  enum MatchType {
+    kTag,
+    kUniversalTag,
+    kId,
+    kClass,
+    kAttributeSet,       // [attr]
+    kAttributeExact,     // [attr=value]
+    kAttributeList,      // [attr~=value]
+    kAttributeHyphen,    // [attr|=value]
+    kAttributeBegin,     // [attr^=value]
+    kAttributeEnd,       // [attr$=value]
+    kAttributeContain,   // [attr*=value]
+    kPseudoClass,
+  };
+
+  enum RelationType {
+    kSubSelector,
+    kDescendant,
+    kChild,
+    kDirectAdjacent,
+    kIndirectAdjacent,
+  };
+
+  enum PseudoType {
+    kPseudoUnknown,
+    kPseudoNot,
+    kPseudoNthChild,
+    kPseudoNthLastChild,
+    kPseudoNthOfType,
+    kPseudoNthLastOfType,
+    kPseudoFirstChild,
+    kPseudoLastChild,
+    kPseudoOnlyChild,
+    kPseudoFirstOfType,
+    kPseudoLastOfType,
+    kPseudoOnlyOfType,
+    kPseudoRoot,
+    kPseudoEmpty,
+  };
+
+  CSSSelector() = default;
+  CSSSelector(MatchType match, const AtomicString& value) : match_(match), value_(value) {}
+
+  MatchType Match() const { return match_; }
+  RelationType Relation() const { return relation_; }
+  void SetRelation(RelationType relation) { relation_ = relation; }
+
+  // Tag name, id, class name or attribute value.
+  const AtomicString& Value() const { return value_; }
+  const AtomicString& Attribute() const { return attribute_; }
+  void SetAttribute(const AtomicString& attribute, bool case_insensitive) {
+    attribute_ = attribute;
+    attribute_case_insensitive_ = case_insensitive;
+  }
+  bool IsAttributeCaseInsensitive() const { return attribute_case_insensitive_; }
+  bool IsAttributeSelector() const { return match_ >= kAttributeSet && match_ <= kAttributeContain; }
+
+  PseudoType GetPseudoType() const { return pseudo_type_; }
+  void SetPseudoType(PseudoType pseudo_type) { pseudo_type_ = pseudo_type; }
+
+  // The argument of :not().
+  const CSSSelectorList* SelectorList() const { return selector_list_.get(); }
+  void SetSelectorList(std::shared_ptr<CSSSelectorList> selector_list) { selector_list_ = std::move(selector_list); }
+
+  // The An+B argument of :nth-*() pseudo classes.
+  void SetNth(int a, int b) {
+    nth_a_ = a;
+    nth_b_ = b;
+  }
+  // Returns true if |count| (1-based) is a position matched by An+B.
+  bool MatchNth(int count) const;
+
+ private:
+  MatchType match_{kUniversalTag};
+  RelationType relation_{kSubSelector};
+  PseudoType pseudo_type_{kPseudoUnknown};
+  bool attribute_case_insensitive_{false};
+  int nth_a_{0};
+  int nth_b_{0};
+  AtomicString value_ = AtomicString::Null();
+  AtomicString attribute_ = AtomicString::Null();
+  std::shared_ptr<CSSSelectorList> selector_list_;
+};
+
+// A comma separated list of complex selectors.
+class CSSSelectorList {
+ public:
+  using ComplexSelector = std::vector<CSSSelector>;
+
+  void Append(ComplexSelector&& selector) { selectors_.emplace_back(std::move(selector)); }
+
+  const std::vector<ComplexSelector>& Selectors() const { return selectors_; }
+  bool IsEmpty() const { return selectors_.empty(); }
+
+ private:
+  std::vector<ComplexSelector> selectors_;
+};
+
+}  // namespace webf
+
+#endif  // WEBF_CORE_CSS_CSS_SELECTOR_H_
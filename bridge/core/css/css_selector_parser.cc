@@ -0,0 +1,418 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "css_selector_parser.h"
+#include <unordered_map>
+#include "foundation/ascii_types.h"
+
+namespace webf {
+
+namespace {
+
+constexpr int kMaximumNotDepth = 8;
+
+bool IsSelectorWhitespace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+bool IsNameStart(char c) {
+  return IsASCIIAlpha(c) || c == '_' || static_cast<unsigned char>(c) >= 0x80;
+}
+
+bool IsNameChar(char c) {
+  return IsNameStart(c) || IsASCIIDigit(c) || c == '-';
+}
+
+void LowerASCII(std::string& string) {
+  for (char& c : string) {
+    if (IsASCIIUpper(c))
+      c = static_cast<char>(c | 0x20);
+  }
+}
+
+bool ParseInteger(const std::string& string, size_t begin, size_t end, int& result) {
+  if (begin >= end)
+    return false;
+  int value = 0;
+  for (size_t i = begin; i < end; i++) {
+    if (!IsASCIIDigit(string[i]) || value > 100000000)
+      return false;
+    value = value * 10 + (string[i] - '0');
+  }
+  result = value;
+  return true;
+}
+
+CSSSelector::PseudoType NameToPseudoType(const std::string& name, bool has_arguments) {
+  static const std::unordered_map<std::string, CSSSelector::PseudoType> pseudo_classes = {
+      {"first-child", CSSSelector::kPseudoFirstChild}, {"last-child", CSSSelector::kPseudoLastChild},
+      {"only-child", CSSSelector::kPseudoOnlyChild},   {"first-of-type", CSSSelector::kPseudoFirstOfType},
+      {"last-of-type", CSSSelector::kPseudoLastOfType}, {"only-of-type", CSSSelector::kPseudoOnlyOfType},
+      {"root", CSSSelector::kPseudoRoot},               {"empty", CSSSelector::kPseudoEmpty},
+  };
+  static const std::unordered_map<std::string, CSSSelector::PseudoType> pseudo_functions = {
+      {"not", CSSSelector::kPseudoNot},
+      {"nth-child", CSSSelector::kPseudoNthChild},
+      {"nth-last-child", CSSSelector::kPseudoNthLastChild},
+      {"nth-of-type", CSSSelector::kPseudoNthOfType},
+      {"nth-last-of-type", CSSSelector::kPseudoNthLastOfType},
+  };
+
+  auto& map = has_arguments ? pseudo_functions : pseudo_classes;
+  auto it = map.find(name);
+  return it == map.end() ? CSSSelector::kPseudoUnknown : it->second;
+}
+
+}  // namespace
+
+std::shared_ptr<CSSSelectorList> CSSSelectorParser::ParseSelector(JSContext* ctx, const std::string& text) {
+  CSSSelectorParser parser(ctx, text);
+  auto list = std::make_shared<CSSSelectorList>();
+  if (!parser.ConsumeSelectorList(*list) || !parser.AtEnd())
+    return nullptr;
+  return list;
+}
+
+bool CSSSelectorParser::SkipWhitespace() {
+  size_t start = pos_;
+  while (!AtEnd() && IsSelectorWhitespace(text_[pos_]))
+    pos_++;
+  return pos_ != start;
+}
+
+bool CSSSelectorParser::ConsumeSelectorList(CSSSelectorList& list) {
+  while (true) {
+    SkipWhitespace();
+    CSSSelectorList::ComplexSelector selector;
+    if (!ConsumeComplexSelector(selector))
+      return false;
+    list.Append(std::move(selector));
+
+    if (Peek() != ',')
+      return true;
+    pos_++;
+  }
+}
+
+bool CSSSelectorParser::ConsumeComplexSelector(CSSSelectorList::ComplexSelector& selector) {
+  // Compound selectors from left to right, and the combinator on the left of each of them.
+  std::vector<std::vector<CSSSelector>> compounds;
+  std::vector<CSSSelector::RelationType> relations;
+  CSSSelector::RelationType relation = CSSSelector::kSubSelector;
+
+  while (true) {
+    std::vector<CSSSelector> compound;
+    if (!ConsumeCompoundSelector(compound))
+      return false;
+    compounds.emplace_back(std::move(compound));
+    relations.emplace_back(relation);
+
+    bool has_whitespace = SkipWhitespace();
+    char c = Peek();
+    if (AtEnd() || c == ',' || c == ')')
+      break;
+
+    if (c == '>') {
+      relation = CSSSelector::kChild;
+    } else if (c == '+') {
+      relation = CSSSelector::kDirectAdjacent;
+    } else if (c == '~') {
+      relation = CSSSelector::kIndirectAdjacent;
+    } else if (has_whitespace) {
+      relation = CSSSelector::kDescendant;
+      continue;
+    } else {
+      return false;
+    }
+    pos_++;
+    SkipWhitespace();
+  }
+
+  // Flatten from right to left, the last simple selector of each compound holds the relation to its left.
+  for (size_t i = compounds.size(); i-- > 0;) {
+    for (auto& simple : compounds[i]) {
+      selector.emplace_back(std::move(simple));
+    }
+    selector.back().SetRelation(relations[i]);
+  }
+  return true;
+}
+
+bool CSSSelectorParser::ConsumeCompoundSelector(std::vector<CSSSelector>& compound) {
+  if (Peek() == '*') {
+    pos_++;
+    if (Peek() == '|')
+      return false;
+    compound.emplace_back(CSSSelector::kUniversalTag, AtomicString::Null());
+  } else if (IsNameStart(Peek()) || Peek() == '-') {
+    std::string tag;
+    if (!ConsumeIdent(tag) || Peek() == '|')
+      return false;
+    LowerASCII(tag);
+    compound.emplace_back(CSSSelector::kTag, AtomicString(ctx_, tag));
+  }
+
+  while (!AtEnd()) {
+    char c = Peek();
+    if (c == '#' || c == '.') {
+      pos_++;
+      std::string name;
+      if (!ConsumeIdent(name))
+        return false;
+      compound.emplace_back(c == '#' ? CSSSelector::kId : CSSSelector::kClass, AtomicString(ctx_, name));
+    } else if (c == '[') {
+      if (!ConsumeAttributeSelector(compound))
+        return false;
+    } else if (c == ':') {
+      if (!ConsumePseudoClass(compound))
+        return false;
+    } else {
+      break;
+    }
+  }
+
+  return !compound.empty();
+}
+
+bool CSSSelectorParser::ConsumeIdent(std::string& ident) {
+  size_t start = pos_;
+  if (Peek() == '-') {
+    // "-" alone or followed by a digit is not an identifier.
+    if (!(IsNameStart(Peek(1)) || Peek(1) == '-'))
+      return false;
+    pos_++;
+  } else if (!IsNameStart(Peek())) {
+    // Escapes are not supported natively.
+    return false;
+  }
+
+  while (!AtEnd() && IsNameChar(text_[pos_]))
+    pos_++;
+  if (Peek() == '\\')
+    return false;
+
+  ident.assign(text_, start, pos_ - start);
+  return true;
+}
+
+bool CSSSelectorParser::ConsumeAttributeValue(std::string& value) {
+  char quote = Peek();
+  if (quote != '"' && quote != '\'')
+    return ConsumeIdent(value);
+
+  pos_++;
+  size_t start = pos_;
+  while (!AtEnd() && text_[pos_] != quote) {
+    if (text_[pos_] == '\\' || text_[pos_] == '\n')
+      return false;
+    pos_++;
+  }
+  if (AtEnd())
+    return false;
+
+  value.assign(text_, start, pos_ - start);
+  pos_++;
+  return true;
+}
+
+bool CSSSelectorParser::ConsumeAttributeSelector(std::vector<CSSSelector>& compound) {
+  // Skip '['.
+  pos_++;
+  SkipWhitespace();
+
+  std::string name;
+  // Namespaced attributes are not supported, but |= is an operator.
+  if (!ConsumeIdent(name) || (Peek() == '|' && Peek(1) != '='))
+    return false;
+  LowerASCII(name);
+  SkipWhitespace();
+
+  if (Peek() == ']') {
+    pos_++;
+    CSSSelector selector(CSSSelector::kAttributeSet, AtomicString::Null());
+    selector.SetAttribute(AtomicString(ctx_, name), false);
+    compound.emplace_back(std::move(selector));
+    return true;
+  }
+
+  CSSSelector::MatchType match;
+  switch (Peek()) {
+    case '=':
+      match = CSSSelector::kAttributeExact;
+      break;
+    case '~':
+      match = CSSSelector::kAttributeList;
+      break;
+    case '|':
+      match = CSSSelector::kAttributeHyphen;
+      break;
+    case '^':
+      match = CSSSelector::kAttributeBegin;
+      break;
+    case '$':
+      match = CSSSelector::kAttributeEnd;
+      break;
+    case '*':
+      match = CSSSelector::kAttributeContain;
+      break;
+    default:
+      return false;
+  }
+  pos_++;
+  if (match != CSSSelector::kAttributeExact) {
+    if (Peek() != '=')
+      return false;
+    pos_++;
+  }
+  SkipWhitespace();
+
+  std::string value;
+  if (!ConsumeAttributeValue(value))
+    return false;
+  SkipWhitespace();
+
+  bool case_insensitive = false;
+  if (Peek() == 'i' || Peek() == 'I' || Peek() == 's' || Peek() == 'S') {
+    case_insensitive = Peek() == 'i' || Peek() == 'I';
+    pos_++;
+    SkipWhitespace();
+  }
+
+  if (Peek() != ']')
+    return false;
+  pos_++;
+
+  CSSSelector selector(match, AtomicString(ctx_, value));
+  selector.SetAttribute(AtomicString(ctx_, name), case_insensitive);
+  compound.emplace_back(std::move(selector));
+  return true;
+}
+
+bool CSSSelectorParser::ConsumePseudoClass(std::vector<CSSSelector>& compound) {
+  // Skip ':', pseudo elements are not supported.
+  pos_++;
+  if (Peek() == ':')
+    return false;
+
+  std::string name;
+  if (!ConsumeIdent(name))
+    return false;
+  LowerASCII(name);
+
+  bool has_arguments = Peek() == '(';
+  CSSSelector::PseudoType pseudo_type = NameToPseudoType(name, has_arguments);
+  if (pseudo_type == CSSSelector::kPseudoUnknown)
+    return false;
+
+  CSSSelector selector(CSSSelector::kPseudoClass, AtomicString::Null());
+  selector.SetPseudoType(pseudo_type);
+
+  if (has_arguments) {
+    pos_++;
+    if (pseudo_type == CSSSelector::kPseudoNot) {
+      if (++depth_ > kMaximumNotDepth)
+        return false;
+      auto list = std::make_shared<CSSSelectorList>();
+      if (!ConsumeSelectorList(*list))
+        return false;
+      depth_--;
+      selector.SetSelectorList(std::move(list));
+    } else {
+      size_t end = text_.find(')', pos_);
+      if (end == std::string::npos)
+        return false;
+      int a, b;
+      if (!ParseNth(text_.substr(pos_, end - pos_), a, b))
+        return false;
+      selector.SetNth(a, b);
+      pos_ = end;
+    }
+    SkipWhitespace();
+    if (Peek() != ')')
+      return false;
+    pos_++;
+  }
+
+  compound.emplace_back(std::move(selector));
+  return true;
+}
+
+// https://drafts.csswg.org/css-syntax-3/#anb-microsyntax
+bool CSSSelectorParser::ParseNth(const std::string& argument, int& a, int& b) {
+  // Whitespace is allowed around the argument and around the sign of b, not within "2n", "-n" or a number.
+  size_t begin = 0;
+  size_t end = argument.size();
+  while (begin < end && IsSelectorWhitespace(argument[begin]))
+    begin++;
+  while (end > begin && IsSelectorWhitespace(argument[end - 1]))
+    end--;
+  std::string string;
+  for (size_t i = begin; i < end; i++) {
+    if (!IsSelectorWhitespace(argument[i])) {
+      string += argument[i];
+      continue;
+    }
+    size_t next = i;
+    while (IsSelectorWhitespace(argument[next]))
+      next++;
+    size_t n = string.find_first_of("nN");
+    if (n == std::string::npos)
+      return false;
+    bool before_sign = n + 1 == string.size() && (argument[next] == '+' || argument[next] == '-');
+    bool after_sign = n + 2 == string.size();
+    if (!before_sign && !after_sign)
+      return false;
+    i = next - 1;
+  }
+  LowerASCII(string);
+
+  if (string == "odd") {
+    a = 2;
+    b = 1;
+    return true;
+  }
+  if (string == "even") {
+    a = 2;
+    b = 0;
+    return true;
+  }
+
+  size_t n = string.find('n');
+  if (n == std::string::npos) {
+    bool negative = !string.empty() && string[0] == '-';
+    size_t begin = !string.empty() && (string[0] == '-' || string[0] == '+') ? 1 : 0;
+    if (!ParseInteger(string, begin, string.size(), b))
+      return false;
+    a = 0;
+    b = negative ? -b : b;
+    return true;
+  }
+
+  if (n == 0 || (n == 1 && string[0] == '+')) {
+    a = 1;
+  } else if (n == 1 && string[0] == '-') {
+    a = -1;
+  } else {
+    bool negative = string[0] == '-';
+    size_t begin = string[0] == '-' || string[0] == '+' ? 1 : 0;
+    if (!ParseInteger(string, begin, n, a))
+      return false;
+    a = negative ? -a : a;
+  }
+
+  if (n + 1 == string.size()) {
+    b = 0;
+    return true;
+  }
+
+  char sign = string[n + 1];
+  if (sign != '+' && sign != '-')
+    return false;
+  if (!ParseInteger(string, n + 2, string.size(), b))
+    return false;
+  b = sign == '-' ? -b : b;
+  return true;
+}
+
+}  // namespace webf
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef WEBF_CORE_CSS_CSS_SELECTOR_PARSER_H_
+#define WEBF_CORE_CSS_CSS_SELECTOR_PARSER_H_
+
+#include <memory>
+#include <string>
+#include "css_selector.h"
+
+namespace webf {
+
+// Parses selector lists used by querySelector(), querySelectorAll(), matches() and closest().
+//
+// Supported: type, universal, id, class and attribute selectors, the descendant, child and sibling combinators,
+// :not() and the structural pseudo classes (:nth-child() and friends, :first-child, :root, :empty, ...).
+// Anything else, including CSS escapes, namespaces and pseudo elements, is rejected so the caller can fall back to
+// the dart implementation, which also reports syntax errors.
+class CSSSelectorParser {
+ public:
+  // Returns nullptr if |text| is not a selector list which can be matched natively.
+  static std::shared_ptr<CSSSelectorList> ParseSelector(JSContext* ctx, const std::string& text);
+
+ private:
+  CSSSelectorParser(JSContext* ctx, const std::string& text) : ctx_(ctx), text_(text) {}
+
+  bool ConsumeSelectorList(CSSSelectorList& list);
+  bool ConsumeComplexSelector(CSSSelectorList::ComplexSelector& selector);
+  bool ConsumeCompoundSelector(std::vector<CSSSelector>& compound);
+  bool ConsumeAttributeSelector(std::vector<CSSSelector>& compound);
+  bool ConsumePseudoClass(std::vector<CSSSelector>& compound);
+  bool ConsumeIdent(std::string& ident);
+  bool ConsumeAttributeValue(std::string& value);
+  static bool ParseNth(const std::string& argument, int& a, int& b);
+
+  bool SkipWhitespace();
+  bool AtEnd() const { return pos_ >= text_.size(); }
+  char Peek(size_t offset = 0) const { return pos_ + offset < text_.size() ? text_[pos_ + offset] : '\0'; }
+
+  JSContext* ctx_;
+  const std::string& text_;
+  size_t pos_{0};
+  // Nesting level of :not().
+  int depth_{0};
+};
+
+}  // namespace webf
+
+#endif  // WEBF_CORE_CSS_CSS_SELECTOR_PARSER_H_
@@ -3,32 +3,37 @@
  * Copyright (C) 2022-present The WebF authors. All rights reserved.
  */
 #include "inline_css_style_declaration.h"
+#include <algorithm>
 #include <vector>
 #include "core/dom/element.h"
 #include "core/dom/mutation_observer_interest_group.h"
 #include "core/executing_context.h"
-#include "core/html/parser/html_parser.h"
-#include "css_property_list.h"
 #include "element_namespace_uris.h"
 #include "html_names.h"
 
 namespace webf {
 
-static std::string parseJavaScriptCSSPropertyName(std::string& propertyName) {
-  static std::unordered_map<std::string, std::string> propertyCache{};
-
-  if (propertyCache.count(propertyName) > 0) {
-    return propertyCache[propertyName];
-  }
+static CSSPropertyID CSSPropertyIDFromName(const AtomicString& name) {
+  StringView view = name.ToStringView();
+  if (view.Is8Bit())
+    return css_property_names::LookupCSSPropertyID(view.Characters8(), view.length());
+  return css_property_names::LookupCSSPropertyID(view.Characters16(), view.length());
+}
 
-  std::vector<char> buffer(propertyName.size() + 1);
+static std::string trim(const std::string& str) {
+  std::string tmp = str;
+  tmp.erase(0, tmp.find_first_not_of(' '));  // prefixing spaces
+  tmp.erase(tmp.find_last_not_of(' ') + 1);  // surfixing spaces
+  return tmp;
+}
 
+static std::string parseJavaScriptCSSPropertyName(const std::string& propertyName) {
   if (propertyName.size() > 2 && propertyName[0] == '-' && propertyName[1] == '-') {
-    propertyCache[propertyName] = propertyName;
     return propertyName;
   }
 
-  size_t hyphen = 0;
+  std::string result;
+  result.reserve(propertyName.size());
   bool toCamelCase = false;
   for (size_t i = 0; i < propertyName.size(); ++i) {
     char c = propertyName[i];
@@ -36,32 +41,20 @@ static std::string parseJavaScriptCSSPropertyName(std::string& propertyName) {
       break;
     if (c == '-' && (i > 0 && propertyName[i - 1] != '-')) {
       toCamelCase = true;
-      hyphen++;
       continue;
     }
     if (toCamelCase) {
-      buffer[i - hyphen] = ToASCIIUpper(c);
+      result += ToASCIIUpper(c);
       toCamelCase = false;
     } else {
-      buffer[i - hyphen] = c;
+      result += c;
     }
   }
 
-  buffer.emplace_back('\0');
-
-  std::string result = std::string(buffer.data());
-
-  propertyCache[propertyName] = result;
   return result;
 }
 
 static std::string convertCamelCaseToKebabCase(const std::string& propertyName) {
-  static std::unordered_map<std::string, std::string> propertyCache{};
-
-  if (propertyCache.count(propertyName) > 0) {
-    return propertyCache[propertyName];
-  }
-
   std::string result;
   for (char c : propertyName) {
     if (std::isupper(c)) {
@@ -71,8 +64,6 @@ static std::string convertCamelCaseToKebabCase(const std::string& propertyName)
       result += c;
     }
   }
-
-  propertyCache[propertyName] = result;
   return result;
 }
 
@@ -90,8 +81,7 @@ ScriptValue InlineCssStyleDeclaration::item(const AtomicString& key, ExceptionSt
     return ScriptValue::Undefined(ctx());
   }
 
-  std::string property_name = key.ToStdString(ctx());
-  AtomicString property_value = InternalGetPropertyValue(property_name);
+  AtomicString property_value = InternalGetPropertyValue(key);
   return ScriptValue(ctx(), property_value);
 }
 
@@ -102,8 +92,7 @@ bool InlineCssStyleDeclaration::SetItem(const AtomicString& key,
     return false;
   }
 
-  std::string propertyName = key.ToStdString(ctx());
-  bool success = InternalSetProperty(propertyName, value.ToLegacyDOMString(ctx()));
+  bool success = InternalSetProperty(key, value.ToLegacyDOMString(ctx()));
   if (success)
     InlineStyleChanged();
   return success;
@@ -114,7 +103,7 @@ bool InlineCssStyleDeclaration::DeleteItem(const webf::AtomicString& key, webf::
 }
 
 int64_t InlineCssStyleDeclaration::length() const {
-  return properties_.size();
+  return properties_.size() + custom_properties_.size();
 }
 
 void InlineCssStyleDeclaration::Clear() {
@@ -122,39 +111,38 @@ void InlineCssStyleDeclaration::Clear() {
 }
 
 AtomicString InlineCssStyleDeclaration::getPropertyValue(const AtomicString& key, ExceptionState& exception_state) {
-  std::string propertyName = key.ToStdString(ctx());
-  return InternalGetPropertyValue(propertyName);
+  return InternalGetPropertyValue(key);
 }
 
 void InlineCssStyleDeclaration::setProperty(const AtomicString& key,
                                             const ScriptValue& value,
                                             ExceptionState& exception_state) {
-  std::string propertyName = key.ToStdString(ctx());
-  bool success = InternalSetProperty(propertyName, value.ToLegacyDOMString(ctx()));
+  bool success = InternalSetProperty(key, value.ToLegacyDOMString(ctx()));
   if (success)
     InlineStyleChanged();
 }
 
 AtomicString InlineCssStyleDeclaration::removeProperty(const AtomicString& key, ExceptionState& exception_state) {
-  std::string propertyName = key.ToStdString(ctx());
-  return InternalRemoveProperty(propertyName);
+  return InternalRemoveProperty(key);
 }
 
 void InlineCssStyleDeclaration::CopyWith(InlineCssStyleDeclaration* inline_style) {
-  for (auto& attr : inline_style->properties_) {
-    properties_[attr.first] = attr.second;
-  }
+  properties_ = inline_style->properties_;
+  custom_properties_ = inline_style->custom_properties_;
 }
 
 AtomicString InlineCssStyleDeclaration::cssText() const {
   std::string result;
-  size_t index = 0;
-  for (auto& attr : properties_) {
-    result += convertCamelCaseToKebabCase(attr.first) + ": " + attr.second.ToStdString(ctx()) + ";";
-    index++;
-    if (index < properties_.size()) {
+  for (auto& property : properties_) {
+    if (!result.empty())
       result += " ";
-    }
+    result += std::string(css_property_names::GetKebabCaseName(property.first)) + ": " +
+              property.second.ToStdString(ctx()) + ";";
+  }
+  for (auto& property : custom_properties_) {
+    if (!result.empty())
+      result += " ";
+    result += convertCamelCaseToKebabCase(property.first) + ": " + property.second.ToStdString(ctx()) + ";";
   }
   return AtomicString(ctx(), result);
 }
@@ -184,7 +172,12 @@ void InlineCssStyleDeclaration::SetCSSTextInternal(const AtomicString& value) {
       css_key = trim(css_key);
       std::string css_value = s.substr(position + 1, s.length());
       css_value = trim(css_value);
-      InternalSetProperty(css_key, AtomicString(ctx(), css_value));
+      CSSPropertyID id = css_property_names::LookupCSSPropertyID(css_key.data(), css_key.size());
+      if (id != CSSPropertyID::kInvalid) {
+        InternalSetProperty(id, AtomicString(ctx(), css_value));
+      } else {
+        InternalSetCustomProperty(parseJavaScriptCSSPropertyName(css_key), AtomicString(ctx(), css_value));
+      }
     }
   }
 }
@@ -194,16 +187,19 @@ void InlineCssStyleDeclaration::Trace(GCVisitor* visitor) const {
 }
 
 std::string InlineCssStyleDeclaration::ToString() const {
-  if (properties_.empty())
+  if (properties_.empty() && custom_properties_.empty())
     return "";
 
   std::string s;
 
-  for (auto& attr : properties_) {
-    s += attr.first + ": " + attr.second.ToStdString(ctx()) + ";";
+  for (auto& property : properties_) {
+    s += std::string(css_property_names::GetCamelCaseName(property.first)) + ": " +
+         property.second.ToStdString(ctx()) + ";";
+  }
+  for (auto& property : custom_properties_) {
+    s += property.first + ": " + property.second.ToStdString(ctx()) + ";";
   }
 
-  s += "\"";
   return s;
 }
 
@@ -226,34 +222,112 @@ void InlineCssStyleDeclaration::InlineStyleChanged() {
 }
 
 bool InlineCssStyleDeclaration::NamedPropertyQuery(const AtomicString& key, ExceptionState&) {
-  return cssPropertyList.count(key.ToStdString(ctx())) > 0;
+  return CSSPropertyIDFromName(key) != CSSPropertyID::kInvalid;
 }
 
 void InlineCssStyleDeclaration::NamedPropertyEnumerator(std::vector<AtomicString>& names, ExceptionState&) {
-  for (auto& entry : cssPropertyList) {
-    names.emplace_back(AtomicString(ctx(), entry.first));
+  const char* const* property_names = css_property_names::GetCamelCaseNames();
+  for (unsigned id = 1; id < kCSSPropertyIDCount; id++) {
+    names.emplace_back(AtomicString(ctx(), property_names[id]));
+  }
+}
+
+AtomicString InlineCssStyleDeclaration::InternalGetPropertyValue(const AtomicString& name) {
+  CSSPropertyID id = CSSPropertyIDFromName(name);
+  if (LIKELY(id != CSSPropertyID::kInvalid)) {
+    return InternalGetPropertyValue(id);
   }
+  return InternalGetCustomPropertyValue(parseJavaScriptCSSPropertyName(name.ToStdString(ctx())));
 }
 
-AtomicString InlineCssStyleDeclaration::InternalGetPropertyValue(std::string& name) {
-  name = parseJavaScriptCSSPropertyName(name);
+bool InlineCssStyleDeclaration::InternalSetProperty(const AtomicString& name, const AtomicString& value) {
+  CSSPropertyID id = CSSPropertyIDFromName(name);
+  if (LIKELY(id != CSSPropertyID::kInvalid)) {
+    return InternalSetProperty(id, value);
+  }
+  return InternalSetCustomProperty(parseJavaScriptCSSPropertyName(name.ToStdString(ctx())), value);
+}
 
-  if (LIKELY(properties_.count(name) > 0)) {
-    return properties_[name];
+AtomicString InlineCssStyleDeclaration::InternalRemoveProperty(const AtomicString& name) {
+  CSSPropertyID id = CSSPropertyIDFromName(name);
+  if (LIKELY(id != CSSPropertyID::kInvalid)) {
+    return InternalRemoveProperty(id);
   }
+  return InternalRemoveCustomProperty(parseJavaScriptCSSPropertyName(name.ToStdString(ctx())));
+}
+
+std::vector<InlineCssStyleDeclaration::PropertyEntry>::iterator InlineCssStyleDeclaration::FindProperty(
+    CSSPropertyID id) {
+  return std::lower_bound(properties_.begin(), properties_.end(), id,
+                          [](const PropertyEntry& entry, CSSPropertyID id) { return entry.first < id; });
+}
 
+AtomicString InlineCssStyleDeclaration::InternalGetPropertyValue(CSSPropertyID id) {
+  auto it = FindProperty(id);
+  if (it != properties_.end() && it->first == id) {
+    return it->second;
+  }
   return AtomicString::Null();
 }
 
-bool InlineCssStyleDeclaration::InternalSetProperty(std::string& name, const AtomicString& value) {
-  name = parseJavaScriptCSSPropertyName(name);
-  if (properties_[name] == value) {
-    return false;
+bool InlineCssStyleDeclaration::InternalSetProperty(CSSPropertyID id, const AtomicString& value) {
+  auto it = FindProperty(id);
+  if (it != properties_.end() && it->first == id) {
+    if (it->second == value)
+      return false;
+    it->second = value;
+  } else {
+    properties_.emplace(it, id, value);
+  }
+
+  GetExecutingContext()->uiCommandBuffer()->AddCommand(UICommand::kSetStyleById, value.ToNativeString(ctx()),
+                                                       owner_element_->bindingObject(),
+                                                       reinterpret_cast<void*>(static_cast<intptr_t>(id)));
+
+  return true;
+}
+
+AtomicString InlineCssStyleDeclaration::InternalRemoveProperty(CSSPropertyID id) {
+  auto it = FindProperty(id);
+  if (UNLIKELY(it == properties_.end() || it->first != id)) {
+    return AtomicString::Empty();
   }
 
-  AtomicString old_value = properties_[name];
+  AtomicString return_value = it->second;
+  properties_.erase(it);
+
+  InlineStyleChanged();
+
+  GetExecutingContext()->uiCommandBuffer()->AddCommand(UICommand::kSetStyleById, nullptr,
+                                                       owner_element_->bindingObject(),
+                                                       reinterpret_cast<void*>(static_cast<intptr_t>(id)));
+
+  return return_value;
+}
+
+std::vector<InlineCssStyleDeclaration::CustomPropertyEntry>::iterator InlineCssStyleDeclaration::FindCustomProperty(
+    const std::string& name) {
+  return std::find_if(custom_properties_.begin(), custom_properties_.end(),
+                      [&name](const CustomPropertyEntry& entry) { return entry.first == name; });
+}
+
+AtomicString InlineCssStyleDeclaration::InternalGetCustomPropertyValue(const std::string& name) {
+  auto it = FindCustomProperty(name);
+  if (it != custom_properties_.end()) {
+    return it->second;
+  }
+  return AtomicString::Null();
+}
 
-  properties_[name] = value;
+bool InlineCssStyleDeclaration::InternalSetCustomProperty(const std::string& name, const AtomicString& value) {
+  auto it = FindCustomProperty(name);
+  if (it != custom_properties_.end()) {
+    if (it->second == value)
+      return false;
+    it->second = value;
+  } else {
+    custom_properties_.emplace_back(name, value);
+  }
 
   std::unique_ptr<SharedNativeString> args_01 = stringToNativeString(name);
   GetExecutingContext()->uiCommandBuffer()->AddCommand(
@@ -262,15 +336,14 @@ bool InlineCssStyleDeclaration::InternalSetProperty(std::string& name, const Ato
   return true;
 }
 
-AtomicString InlineCssStyleDeclaration::InternalRemoveProperty(std::string& name) {
-  name = parseJavaScriptCSSPropertyName(name);
-
-  if (UNLIKELY(properties_.count(name) == 0)) {
+AtomicString InlineCssStyleDeclaration::InternalRemoveCustomProperty(const std::string& name) {
+  auto it = FindCustomProperty(name);
+  if (UNLIKELY(it == custom_properties_.end())) {
     return AtomicString::Empty();
   }
 
-  AtomicString return_value = properties_[name];
-  properties_.erase(name);
+  AtomicString return_value = it->second;
+  custom_properties_.erase(it);
 
   InlineStyleChanged();
 
@@ -282,9 +355,10 @@ AtomicString InlineCssStyleDeclaration::InternalRemoveProperty(std::string& name
 }
 
 void InlineCssStyleDeclaration::InternalClearProperty() {
-  if (properties_.empty())
+  if (properties_.empty() && custom_properties_.empty())
     return;
   properties_.clear();
+  custom_properties_.clear();
   GetExecutingContext()->uiCommandBuffer()->AddCommand(UICommand::kClearStyle, nullptr, owner_element_->bindingObject(),
                                                        nullptr);
 }
@@ -5,12 +5,14 @@
 #ifndef BRIDGE_CSS_STYLE_DECLARATION_H
 #define BRIDGE_CSS_STYLE_DECLARATION_H
 
-#include <unordered_map>
+#include <string>
+#include <vector>
 #include "bindings/qjs/atomic_string.h"
 #include "bindings/qjs/cppgc/member.h"
 #include "bindings/qjs/exception_state.h"
 #include "bindings/qjs/script_value.h"
 #include "bindings/qjs/script_wrappable.h"
+#include "css_property_names.h"
 #include "css_style_declaration.h"
 
 namespace webf {
@@ -51,11 +53,30 @@ class InlineCssStyleDeclaration : public CSSStyleDeclaration {
   void Trace(GCVisitor* visitor) const override;
 
  private:
-  AtomicString InternalGetPropertyValue(std::string& name);
-  bool InternalSetProperty(std::string& name, const AtomicString& value);
-  AtomicString InternalRemoveProperty(std::string& name);
+  using PropertyEntry = std::pair<CSSPropertyID, AtomicString>;
+  using CustomPropertyEntry = std::pair<std::string, AtomicString>;
+
+  AtomicString InternalGetPropertyValue(const AtomicString& name);
+  bool InternalSetProperty(const AtomicString& name, const AtomicString& value);
+  AtomicString InternalRemoveProperty(const AtomicString& name);
+
+  // Known properties are keyed by their CSSPropertyID and sent to dart as kSetStyleById. Custom properties and
+  // names unknown to the bridge keep their string name and are sent as kSetStyle.
+  AtomicString InternalGetPropertyValue(CSSPropertyID id);
+  bool InternalSetProperty(CSSPropertyID id, const AtomicString& value);
+  AtomicString InternalRemoveProperty(CSSPropertyID id);
+  std::vector<PropertyEntry>::iterator FindProperty(CSSPropertyID id);
+
+  AtomicString InternalGetCustomPropertyValue(const std::string& name);
+  bool InternalSetCustomProperty(const std::string& name, const AtomicString& value);
+  AtomicString InternalRemoveCustomProperty(const std::string& name);
+  std::vector<CustomPropertyEntry>::iterator FindCustomProperty(const std::string& name);
+
   void InternalClearProperty();
-  std::unordered_map<std::string, AtomicString> properties_;
+
+  // Sorted by CSSPropertyID.
+  std::vector<PropertyEntry> properties_;
+  std::vector<CustomPropertyEntry> custom_properties_;
   Member<Element> owner_element_;
 };
 
@@ -4,6 +4,7 @@
  */
 
 #include "gtest/gtest.h"
+#include "css_property_names.h"
 #include "webf_test_env.h"
 
 using namespace webf;
@@ -102,4 +103,35 @@ TEST(InlineCSSStyleDeclaration, setNullValue) {
       "console.assert(document.body.style.height === '')";
   env->page()->evaluateScript(code, strlen(code), "vm://", 0);
   EXPECT_EQ(errorCalled, false);
-}
\ No newline at end of file
+}
+
+TEST(InlineCSSStyleDeclaration, setStyleById) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "red red 0px");
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = env->page()->executingContext();
+  const char* code =
+      "document.body.style.cssText = 'margin-top: 0px';"
+      "document.body.style.setProperty('background-color', 'red');"
+      "console.log([document.body.style.backgroundColor, document.body.style.getPropertyValue('background-color'), "
+      "document.body.style.marginTop].join(' '));";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  UICommandItem* buffer = static_cast<UICommandItem*>(context->uiCommandBuffer()->data());
+  size_t commandSize = context->uiCommandBuffer()->size();
+
+  UICommandItem& last = buffer[commandSize - 1];
+  EXPECT_EQ(last.type, (int32_t)UICommand::kSetStyleById);
+  EXPECT_EQ(last.nativePtr2, static_cast<int64_t>(CSSPropertyID::kBackgroundColor));
+  EXPECT_EQ(css_property_names::LookupCSSPropertyID("background-color", 16), CSSPropertyID::kBackgroundColor);
+  EXPECT_EQ(css_property_names::LookupCSSPropertyID("--background-color", 18), CSSPropertyID::kInvalid);
+
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
@@ -0,0 +1,255 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "selector_checker.h"
+#include "core/dom/element.h"
+#include "core/dom/element_traversal.h"
+#include "core/dom/space_split_string.h"
+#include "core/dom/text.h"
+#include "element_namespace_uris.h"
+#include "html_names.h"
+
+namespace webf {
+
+namespace {
+
+inline char16_t CharAt(const StringView& string, unsigned index) {
+  return string.Is8Bit() ? static_cast<unsigned char>(string.Characters8()[index]) : string.Characters16()[index];
+}
+
+inline char16_t FoldCase(char16_t c, bool case_insensitive) {
+  return case_insensitive && c >= 'A' && c <= 'Z' ? static_cast<char16_t>(c | 0x20) : c;
+}
+
+// Returns true if |needle| occurs in |haystack| at |offset|.
+bool EqualAt(const StringView& haystack, unsigned offset, const StringView& needle, bool case_insensitive) {
+  if (offset + needle.length() > haystack.length())
+    return false;
+  for (unsigned i = 0; i < needle.length(); i++) {
+    if (FoldCase(CharAt(haystack, offset + i), case_insensitive) != FoldCase(CharAt(needle, i), case_insensitive))
+      return false;
+  }
+  return true;
+}
+
+bool ContainsTokenInView(const StringView& list, const StringView& token, bool case_insensitive) {
+  if (token.Empty())
+    return false;
+
+  unsigned length = list.length();
+  unsigned i = 0;
+  while (i < length) {
+    while (i < length && IsHTMLSpace(CharAt(list, i)))
+      i++;
+    unsigned start = i;
+    while (i < length && !IsHTMLSpace(CharAt(list, i)))
+      i++;
+    if (i - start == token.length() && EqualAt(list, start, token, case_insensitive))
+      return true;
+  }
+  return false;
+}
+
+bool HasSameType(const Element& a, const Element& b) {
+  return a.localName() == b.localName() && a.namespaceURI() == b.namespaceURI();
+}
+
+int CountPreviousSiblings(const Element& element, bool same_type) {
+  int count = 0;
+  for (Element* sibling = ElementTraversal::PreviousSibling(element); sibling;
+       sibling = ElementTraversal::PreviousSibling(*sibling)) {
+    if (!same_type || HasSameType(element, *sibling))
+      count++;
+  }
+  return count;
+}
+
+int CountNextSiblings(const Element& element, bool same_type) {
+  int count = 0;
+  for (Element* sibling = ElementTraversal::NextSibling(element); sibling;
+       sibling = ElementTraversal::NextSibling(*sibling)) {
+    if (!same_type || HasSameType(element, *sibling))
+      count++;
+  }
+  return count;
+}
+
+}  // namespace
+
+bool SelectorChecker::Match(const CSSSelectorList& selector_list, const Element& element) {
+  for (auto& selector : selector_list.Selectors()) {
+    if (Match(selector, element))
+      return true;
+  }
+  return false;
+}
+
+bool SelectorChecker::Match(const CSSSelectorList::ComplexSelector& selector, const Element& element) {
+  return MatchComplex(selector, 0, element);
+}
+
+bool SelectorChecker::ContainsToken(const AtomicString& list, const AtomicString& token) {
+  if (list.IsNull() || list.IsEmpty())
+    return false;
+  if (list == token)
+    return true;
+  return ContainsTokenInView(list.ToStringView(), token.ToStringView(), false);
+}
+
+bool SelectorChecker::MatchComplex(const CSSSelectorList::ComplexSelector& selector,
+                                   size_t index,
+                                   const Element& element) {
+  // Match every simple selector of the current compound selector.
+  size_t last = index;
+  while (true) {
+    if (!MatchSimple(selector[last], element))
+      return false;
+    if (selector[last].Relation() != CSSSelector::kSubSelector || last + 1 == selector.size())
+      break;
+    last++;
+  }
+
+  if (last + 1 == selector.size())
+    return true;
+
+  size_t next = last + 1;
+  switch (selector[last].Relation()) {
+    case CSSSelector::kDescendant:
+      for (Element* ancestor = element.parentElement(); ancestor; ancestor = ancestor->parentElement()) {
+        if (MatchComplex(selector, next, *ancestor))
+          return true;
+      }
+      return false;
+    case CSSSelector::kChild: {
+      Element* parent = element.parentElement();
+      return parent && MatchComplex(selector, next, *parent);
+    }
+    case CSSSelector::kDirectAdjacent: {
+      Element* previous = ElementTraversal::PreviousSibling(element);
+      return previous && MatchComplex(selector, next, *previous);
+    }
+    case CSSSelector::kIndirectAdjacent:
+      for (Element* previous = ElementTraversal::PreviousSibling(element); previous;
+           previous = ElementTraversal::PreviousSibling(*previous)) {
+        if (MatchComplex(selector, next, *previous))
+          return true;
+      }
+      return false;
+    case CSSSelector::kSubSelector:
+      break;
+  }
+  return true;
+}
+
+bool SelectorChecker::MatchSimple(const CSSSelector& selector, const Element& element) {
+  switch (selector.Match()) {
+    case CSSSelector::kUniversalTag:
+      return true;
+    case CSSSelector::kTag: {
+      if (element.localName() == selector.Value())
+        return true;
+      // Type selectors are lowercased by the parser, only HTML elements have lowercased local names.
+      return element.namespaceURI() != element_namespace_uris::khtml &&
+             element.localName().ToLowerIfNecessary(element.ctx()) == selector.Value();
+    }
+    case CSSSelector::kId: {
+      const AtomicString* id = element.FindAttribute(html_names::kIdAttr);
+      return id != nullptr && *id == selector.Value();
+    }
+    case CSSSelector::kClass: {
+      const AtomicString* class_name = element.FindAttribute(html_names::kClassAttr);
+      return class_name != nullptr && ContainsToken(*class_name, selector.Value());
+    }
+    case CSSSelector::kPseudoClass:
+      return MatchPseudoClass(selector, element);
+    default:
+      return MatchAttribute(selector, element);
+  }
+}
+
+bool SelectorChecker::MatchAttribute(const CSSSelector& selector, const Element& element) {
+  // The style attribute is serialized from the inline style lazily.
+  if (selector.Attribute() == html_names::kStyleAttr) {
+    const_cast<Element&>(element).SynchronizeAttribute(html_names::kStyleAttr);
+  }
+
+  const AtomicString* value = element.FindAttribute(selector.Attribute());
+  if (value == nullptr)
+    return false;
+  if (selector.Match() == CSSSelector::kAttributeSet)
+    return true;
+
+  bool case_insensitive = selector.IsAttributeCaseInsensitive();
+  if (selector.Match() == CSSSelector::kAttributeExact && !case_insensitive)
+    return *value == selector.Value();
+
+  StringView actual = value->ToStringView();
+  StringView expected = selector.Value().ToStringView();
+  switch (selector.Match()) {
+    case CSSSelector::kAttributeExact:
+      return actual.length() == expected.length() && EqualAt(actual, 0, expected, true);
+    case CSSSelector::kAttributeList:
+      return ContainsTokenInView(actual, expected, case_insensitive);
+    case CSSSelector::kAttributeHyphen:
+      return EqualAt(actual, 0, expected, case_insensitive) &&
+             (actual.length() == expected.length() || CharAt(actual, expected.length()) == '-');
+    case CSSSelector::kAttributeBegin:
+      return !expected.Empty() && EqualAt(actual, 0, expected, case_insensitive);
+    case CSSSelector::kAttributeEnd:
+      return !expected.Empty() && actual.length() >= expected.length() &&
+             EqualAt(actual, actual.length() - expected.length(), expected, case_insensitive);
+    case CSSSelector::kAttributeContain:
+      if (expected.Empty() || actual.length() < expected.length())
+        return false;
+      for (unsigned i = 0; i + expected.length() <= actual.length(); i++) {
+        if (EqualAt(actual, i, expected, case_insensitive))
+          return true;
+      }
+      return false;
+    default:
+      return false;
+  }
+}
+
+bool SelectorChecker::MatchPseudoClass(const CSSSelector& selector, const Element& element) {
+  switch (selector.GetPseudoType()) {
+    case CSSSelector::kPseudoNot:
+      return !Match(*selector.SelectorList(), element);
+    case CSSSelector::kPseudoNthChild:
+      return selector.MatchNth(CountPreviousSiblings(element, false) + 1);
+    case CSSSelector::kPseudoNthLastChild:
+      return selector.MatchNth(CountNextSiblings(element, false) + 1);
+    case CSSSelector::kPseudoNthOfType:
+      return selector.MatchNth(CountPreviousSiblings(element, true) + 1);
+    case CSSSelector::kPseudoNthLastOfType:
+      return selector.MatchNth(CountNextSiblings(element, true) + 1);
+    case CSSSelector::kPseudoFirstChild:
+      return ElementTraversal::PreviousSibling(element) == nullptr;
+    case CSSSelector::kPseudoLastChild:
+      return ElementTraversal::NextSibling(element) == nullptr;
+    case CSSSelector::kPseudoOnlyChild:
+      return ElementTraversal::PreviousSibling(element) == nullptr && ElementTraversal::NextSibling(element) == nullptr;
+    case CSSSelector::kPseudoFirstOfType:
+      return CountPreviousSiblings(element, true) == 0;
+    case CSSSelector::kPseudoLastOfType:
+      return CountNextSiblings(element, true) == 0;
+    case CSSSelector::kPseudoOnlyOfType:
+      return CountPreviousSiblings(element, true) == 0 && CountNextSiblings(element, true) == 0;
+    case CSSSelector::kPseudoRoot:
+      return element.parentNode() != nullptr && element.parentNode()->IsDocumentNode();
+    case CSSSelector::kPseudoEmpty:
+      for (Node* child = element.firstChild(); child; child = child->nextSibling()) {
+        if (child->IsElementNode())
+          return false;
+        if (child->IsTextNode() && To<Text>(child)->length() > 0)
+          return false;
+      }
+      return true;
+    case CSSSelector::kPseudoUnknown:
+      return false;
+  }
+  return false;
+}
+
+}  // namespace webf
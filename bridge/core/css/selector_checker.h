@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef WEBF_CORE_CSS_SELECTOR_CHECKER_H_
+#define WEBF_CORE_CSS_SELECTOR_CHECKER_H_
+
+#include "css_selector.h"
+
+namespace webf {
+
+class Element;
+
+// Matches parsed selectors against the element tree of the bridge, from the rightmost compound selector to the left.
+// Only the attributes known on the C++ side are consulted, the matcher never calls into dart.
+class SelectorChecker {
+ public:
+  static bool Match(const CSSSelectorList& selector_list, const Element& element);
+  static bool Match(const CSSSelectorList::ComplexSelector& selector, const Element& element);
+
+  // Returns true if the whitespace separated |list| contains |token|.
+  static bool ContainsToken(const AtomicString& list, const AtomicString& token);
+
+ private:
+  // Matches the complex selector starting at the compound selector which begins at |index|.
+  static bool MatchComplex(const CSSSelectorList::ComplexSelector& selector, size_t index, const Element& element);
+  static bool MatchSimple(const CSSSelector& selector, const Element& element);
+  static bool MatchAttribute(const CSSSelector& selector, const Element& element);
+  static bool MatchPseudoClass(const CSSSelector& selector, const Element& element);
+};
+
+}  // namespace webf
+
+#endif  // WEBF_CORE_CSS_SELECTOR_CHECKER_H_
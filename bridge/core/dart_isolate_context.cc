@@ -61,6 +61,10 @@ const std::unique_ptr<DartContextData>& DartIsolateContext::EnsureData() const {
   return data_;
 }
 
+// Pages running in a dedicated thread collect cycles in slices of this many GC objects, interleaved with the tasks
+// of the thread and run in its idle time, instead of stopping the thread for a full collection of the heap.
+constexpr int kGCSliceBudget = 2000;
+
 thread_local JSRuntime* runtime_{nullptr};
 thread_local uint32_t running_dart_isolates = 0;
 thread_local bool is_name_installed_ = false;
@@ -111,6 +115,16 @@ DartIsolateContext::DartIsolateContext(const uint64_t* dart_methods, int32_t dar
   running_dart_isolates++;
 }
 
+bool DartIsolateContext::CollectGarbageWhenIdle(multi_threading::Looper::TimerClock::time_point deadline) {
+  if (runtime_ == nullptr)
+    return false;
+  while (multi_threading::Looper::TimerClock::now() < deadline) {
+    if (!JS_RunGCSlice(runtime_, kGCSliceBudget))
+      return false;
+  }
+  return true;
+}
+
 JSRuntime* DartIsolateContext::runtime() {
   assert_m(runtime_ != nullptr, "nullptr is unsafe");
   return runtime_;
@@ -137,6 +151,7 @@ void DartIsolateContext::InitializeNewPageInJSThread(PageGroup* page_group,
                                                      AllocateNewPageCallback result_callback) {
   dart_isolate_context->profiler()->StartTrackInitialize();
   DartIsolateContext::InitializeJSRuntime();
+  JS_SetGCIncremental(runtime_, true, kGCSliceBudget);
   auto* page = new WebFPage(dart_isolate_context, true, sync_buffer_size, page_context_id, nullptr);
 
   dart_isolate_context->profiler()->FinishTrackInitialize();
@@ -180,6 +195,7 @@ void* DartIsolateContext::AddNewPage(double thread_identity,
       delete static_cast<PageGroup*>(p);
       DartIsolateContext::FinalizeJSRuntime();
     });
+    dispatcher_->looper(thread_group_id)->SetIdleHandler(CollectGarbageWhenIdle);
   } else {
     page_group = static_cast<PageGroup*>(dispatcher_->GetOpaque(thread_group_id));
   }
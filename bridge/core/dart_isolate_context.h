@@ -74,6 +74,7 @@ class DartIsolateContext {
  private:
   static void InitializeJSRuntime();
   static void FinalizeJSRuntime();
+  static bool CollectGarbageWhenIdle(multi_threading::Looper::TimerClock::time_point deadline);
   static std::unique_ptr<WebFPage> InitializeNewPageSync(DartIsolateContext* dart_isolate_context,
                                                          size_t sync_buffer_size,
                                                          double page_context_id);
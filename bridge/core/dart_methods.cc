@@ -124,6 +124,10 @@ int32_t DartMethodPointer::setInterval(bool is_dedicated,
   return new_timer_id;
 }
 
+int32_t DartMethodPointer::NewTimerId() {
+  return start_timer_id++;
+}
+
 void DartMethodPointer::clearTimeout(bool is_dedicated, double context_id, int32_t timer_id) {
 #if ENABLE_LOG
   WEBF_LOG(VERBOSE) << "[CPP] ClearTimeoutWrapper call" << std::endl;
@@ -176,6 +176,8 @@ class DartMethodPointer {
                       AsyncCallback callback,
                       int32_t timeout);
   void clearTimeout(bool is_dedicated, double context_id, int32_t timerId);
+  // Allocates a timer id without scheduling anything on the dart side, used by the timers of dedicated threads.
+  int32_t NewTimerId();
   int32_t requestAnimationFrame(bool is_dedicated,
                                 void* callback_context,
                                 double context_id,
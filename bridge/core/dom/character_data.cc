@@ -11,8 +11,8 @@
 
 namespace webf {
 
-void CharacterData::setData(const AtomicString& data, ExceptionState& exception_state) {
-  AtomicString old_data = data_;
+void CharacterData::setData(const String& data, ExceptionState& exception_state) {
+  String old_data = data_;
   data_ = data;
 
   std::unique_ptr<SharedNativeString> args_01 = data.ToNativeString(ctx());
@@ -23,16 +23,19 @@ void CharacterData::setData(const AtomicString& data, ExceptionState& exception_
   DidModifyData(old_data);
 }
 
-void CharacterData::DidModifyData(const webf::AtomicString& old_data) {
+void CharacterData::DidModifyData(const String& old_data) {
   std::shared_ptr<MutationObserverInterestGroup> mutation_recipients =
       MutationObserverInterestGroup::CreateForCharacterDataMutation(*this);
   if (mutation_recipients != nullptr) {
-    mutation_recipients->EnqueueMutationRecord(MutationRecord::CreateCharacterData(this, old_data));
+    // The old value is only interned when an observer asked for it.
+    AtomicString old_value =
+        mutation_recipients->IsOldValueRequested() ? old_data.ToAtomicString(ctx()) : AtomicString::Null();
+    mutation_recipients->EnqueueMutationRecord(MutationRecord::CreateCharacterData(this, old_value));
   }
 }
 
 AtomicString CharacterData::nodeValue() const {
-  return data_;
+  return data_.ToAtomicString(ctx());
 }
 
 bool CharacterData::IsCharacterDataNode() const {
@@ -40,10 +43,10 @@ bool CharacterData::IsCharacterDataNode() const {
 }
 
 void CharacterData::setNodeValue(const AtomicString& value, ExceptionState& exception_state) {
-  setData(!value.IsEmpty() ? value : built_in_string::kempty_string, exception_state);
+  setData(String(ctx(), !value.IsEmpty() ? value : built_in_string::kempty_string), exception_state);
 }
 
-CharacterData::CharacterData(TreeScope& tree_scope, const AtomicString& text, Node::ConstructionType type)
+CharacterData::CharacterData(TreeScope& tree_scope, const String& text, Node::ConstructionType type)
     : Node(tree_scope.GetDocument().GetExecutingContext(), &tree_scope, type), data_(text) {
   assert(type == kCreateOther || type == kCreateText);
 }
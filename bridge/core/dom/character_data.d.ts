@@ -2,7 +2,7 @@ import {Node} from "./node";
 import {ChildNode} from "./child_node";
 
 export interface CharacterData extends Node, ChildNode {
-  data: string;
+  data: NonAtomicString;
   readonly length: int64;
   new(): void;
 }
@@ -6,6 +6,7 @@
 #ifndef BRIDGE_CHARACTER_DATA_H
 #define BRIDGE_CHARACTER_DATA_H
 
+#include "bindings/qjs/dom_string.h"
 #include "node.h"
 #include "plugin_api/character_data.h"
 
@@ -19,11 +20,12 @@ class CharacterData : public Node {
  public:
   //  static CharacterDataRustMethods* rustMethodPointer();
 
-  const AtomicString& data() const { return data_; }
+  // The data is not interned, as text payloads are large and rarely repeat.
+  const String& data() const { return data_; }
   int64_t length() const { return data_.length(); };
-  void setData(const AtomicString& data, ExceptionState& exception_state);
+  void setData(const String& data, ExceptionState& exception_state);
 
-  void DidModifyData(const AtomicString& old_data);
+  void DidModifyData(const String& old_data);
 
   AtomicString nodeValue() const override;
   bool IsCharacterDataNode() const override;
@@ -32,10 +34,10 @@ class CharacterData : public Node {
   const CharacterDataPublicMethods* characterDataPublicMethods();
 
  protected:
-  CharacterData(TreeScope& tree_scope, const AtomicString& text, ConstructionType type);
+  CharacterData(TreeScope& tree_scope, const String& text, ConstructionType type);
 
  private:
-  AtomicString data_;
+  String data_;
 };
 
 template <>
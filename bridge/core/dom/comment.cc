@@ -9,16 +9,17 @@
 
 namespace webf {
 
-Comment* Comment::Create(ExecutingContext* context, const AtomicString& data, ExceptionState& exception_state) {
-  return MakeGarbageCollected<Comment>(*context->document(), data.IsNull() ? AtomicString::Empty() : data,
+Comment* Comment::Create(ExecutingContext* context, const String& data, ExceptionState& exception_state) {
+  return MakeGarbageCollected<Comment>(*context->document(),
+                                       data.IsNull() ? String(context->ctx(), AtomicString::Empty()) : data,
                                        ConstructionType::kCreateOther);
 }
 
-Comment* Comment::Create(Document& document, const AtomicString& data) {
+Comment* Comment::Create(Document& document, const String& data) {
   return MakeGarbageCollected<Comment>(document, data, ConstructionType::kCreateOther);
 }
 
-Comment::Comment(TreeScope& tree_scope, const AtomicString& data, ConstructionType type)
+Comment::Comment(TreeScope& tree_scope, const String& data, ConstructionType type)
     : CharacterData(tree_scope, data, type) {
   GetExecutingContext()->uiCommandBuffer()->AddCommand(UICommand::kCreateComment, nullptr, bindingObject(), nullptr);
 }
@@ -1,5 +1,5 @@
 import {CharacterData} from "./character_data";
 
 export interface Comment extends CharacterData {
-  new(data: string | null): Comment;
+  new(data: NonAtomicString | null): Comment;
 }
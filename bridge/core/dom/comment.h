@@ -14,10 +14,10 @@ class Comment : public CharacterData {
   DEFINE_WRAPPERTYPEINFO();
 
  public:
-  static Comment* Create(ExecutingContext*, const AtomicString&, ExceptionState&);
-  static Comment* Create(Document&, const AtomicString&);
+  static Comment* Create(ExecutingContext*, const String&, ExceptionState&);
+  static Comment* Create(Document&, const String&);
 
-  explicit Comment(TreeScope& tree_scope, const AtomicString& data, ConstructionType type);
+  explicit Comment(TreeScope& tree_scope, const String& data, ConstructionType type);
 
   NodeType nodeType() const override;
 
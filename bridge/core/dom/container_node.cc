@@ -304,6 +304,25 @@ Node* ContainerNode::AppendChild(Node* new_child) {
   return AppendChild(new_child, ASSERT_NO_EXCEPTION());
 }
 
+void ContainerNode::ParserAppendChild(Node* new_child) {
+  assert(new_child);
+  assert(!new_child->parentNode());
+  assert(IsChildTypeAllowed(*new_child));
+
+  Node* previous = last_child_;
+  new_child->SetParentOrShadowHostNode(this);
+  if (last_child_) {
+    new_child->SetPreviousSibling(last_child_);
+    last_child_->SetNextSibling(new_child);
+  } else {
+    SetFirstChild(new_child);
+  }
+  SetLastChild(new_child);
+
+  NotifyNodeInsertedInternal(*new_child);
+  ChildrenChanged(ChildrenChange::ForInsertion(*new_child, previous, nullptr, ChildrenChangeSource::kParser));
+}
+
 void ContainerNode::WillRemoveChild(Node& child) {
   assert(child.parentNode() == this);
   ChildListMutationScope(*this).WillRemoveChild(child);
@@ -42,6 +42,9 @@ class ContainerNode : public Node {
   Node* RemoveChild(Node* child, ExceptionState&);
   Node* AppendChild(Node* new_child, ExceptionState&);
   Node* AppendChild(Node* new_child);
+  // Appends a child created by the HTML parser. It skips the checks, the mutation records and the UI command of
+  // AppendChild(), the parser sends the whole subtree to dart at once.
+  void ParserAppendChild(Node* new_child);
   void WillRemoveChildren();
   void WillRemoveChild(Node& child);
   bool EnsurePreInsertionValidity(const Node& new_child,
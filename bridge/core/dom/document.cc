@@ -23,6 +23,7 @@
 #include "element_traversal.h"
 #include "event_factory.h"
 #include "foundation/ascii_types.h"
+#include "foundation/dart_readable.h"
 #include "foundation/native_value_converter.h"
 #include "html_element_factory.h"
 #include "svg_element_factory.h"
@@ -108,7 +109,7 @@ Element* Document::createElementNS(const AtomicString& uri,
   return createElementNS(uri, name, exception_state);
 }
 
-Text* Document::createTextNode(const AtomicString& value, ExceptionState& exception_state) {
+Text* Document::createTextNode(const String& value, ExceptionState& exception_state) {
   return Text::Create(*this, value);
 }
 
@@ -116,7 +117,7 @@ DocumentFragment* Document::createDocumentFragment(ExceptionState& exception_sta
   return DocumentFragment::Create(*this);
 }
 
-Comment* Document::createComment(const AtomicString& data, ExceptionState& exception_state) {
+Comment* Document::createComment(const String& data, ExceptionState& exception_state) {
   return Comment::Create(*this, data);
 }
 
@@ -163,6 +164,10 @@ bool Document::ChildTypeAllowed(NodeType type) const {
 }
 
 Element* Document::querySelector(const AtomicString& selectors, ExceptionState& exception_state) {
+  if (SelectorQuery* selector_query = GetSelectorQueryCache().Add(ctx(), selectors)) {
+    return selector_query->QueryFirst(*this);
+  }
+
   NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), selectors)};
   NativeValue result = InvokeBindingMethod(binding_call_methods::kquerySelector, 1, arguments,
                                            FlushUICommandReason::kDependentsAll, exception_state);
@@ -173,6 +178,10 @@ Element* Document::querySelector(const AtomicString& selectors, ExceptionState&
 }
 
 std::vector<Element*> Document::querySelectorAll(const AtomicString& selectors, ExceptionState& exception_state) {
+  if (SelectorQuery* selector_query = GetSelectorQueryCache().Add(ctx(), selectors)) {
+    return selector_query->QueryAll(*this);
+  }
+
   NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), selectors)};
   NativeValue result = InvokeBindingMethod(binding_call_methods::kquerySelectorAll, 1, arguments,
                                            FlushUICommandReason::kDependentsAll, exception_state);
@@ -183,44 +192,20 @@ std::vector<Element*> Document::querySelectorAll(const AtomicString& selectors,
 }
 
 Element* Document::getElementById(const AtomicString& id, ExceptionState& exception_state) {
-  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), id)};
-  NativeValue result = InvokeBindingMethod(binding_call_methods::kgetElementById, 1, arguments,
-                                           FlushUICommandReason::kDependentsAll, exception_state);
-  if (exception_state.HasException()) {
-    return {};
-  }
-  return NativeValueConverter<NativeTypePointer<Element>>::FromNativeValue(ctx(), result);
+  return TreeScope::getElementById(id);
 }
 
 std::vector<Element*> Document::getElementsByClassName(const AtomicString& class_name,
                                                        ExceptionState& exception_state) {
-  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), class_name)};
-  NativeValue result = InvokeBindingMethod(binding_call_methods::kgetElementsByClassName, 1, arguments,
-                                           FlushUICommandReason::kDependentsAll, exception_state);
-  if (exception_state.HasException()) {
-    return {};
-  }
-  return NativeValueConverter<NativeTypeArray<NativeTypePointer<Element>>>::FromNativeValue(ctx(), result);
+  return SelectorQuery::ElementsByClassName(*this, class_name);
 }
 
 std::vector<Element*> Document::getElementsByTagName(const AtomicString& tag_name, ExceptionState& exception_state) {
-  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), tag_name)};
-  NativeValue result = InvokeBindingMethod(binding_call_methods::kgetElementsByTagName, 1, arguments,
-                                           FlushUICommandReason::kDependentsAll, exception_state);
-  if (exception_state.HasException()) {
-    return {};
-  }
-  return NativeValueConverter<NativeTypeArray<NativeTypePointer<Element>>>::FromNativeValue(ctx(), result);
+  return SelectorQuery::ElementsByTagName(*this, tag_name);
 }
 
 std::vector<Element*> Document::getElementsByName(const AtomicString& name, ExceptionState& exception_state) {
-  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), name)};
-  NativeValue result = InvokeBindingMethod(binding_call_methods::kgetElementsByName, 1, arguments,
-                                           FlushUICommandReason::kDependentsAll, exception_state);
-  if (exception_state.HasException()) {
-    return {};
-  }
-  return NativeValueConverter<NativeTypeArray<NativeTypePointer<Element>>>::FromNativeValue(ctx(), result);
+  return SelectorQuery::ElementsByName(*this, name);
 }
 
 Element* Document::elementFromPoint(double x, double y, ExceptionState& exception_state) {
@@ -237,6 +222,41 @@ Element* Document::elementFromPoint(double x, double y, ExceptionState& exceptio
   return NativeValueConverter<NativeTypePointer<Element>>::FromNativeValue(ctx(), result);
 }
 
+void Document::___prefetchBoundingClientRects__(const std::vector<Element*>& elements,
+                                                ExceptionState& exception_state) {
+  GeometryCache* geometry_cache = GetExecutingContext()->geometryCache();
+  std::vector<Element*> targets;
+  std::vector<NativeValue> args;
+  for (Element* element : elements) {
+    if (element == nullptr || geometry_cache->GetBoundingClientRect(element->bindingObject()) != nullptr)
+      continue;
+    targets.emplace_back(element);
+    args.emplace_back(NativeValueConverter<NativeTypePointer<Element>>::ToNativeValue(element));
+  }
+  if (targets.empty())
+    return;
+
+  NativeValue result = InvokeBindingMethod(
+      binding_call_methods::k__prefetch_bounding_client_rects__, args.size(), args.data(),
+      FlushUICommandReason::kDependentsOnElement | FlushUICommandReason::kDependentsOnLayout, exception_state);
+  if (exception_state.HasException() || result.tag != NativeTag::TAG_LIST)
+    return;
+
+  // Dart answers with x, y, width and height of every element in order.
+  auto* values = static_cast<NativeValue*>(result.u.ptr);
+  if (result.uint32 == targets.size() * 4) {
+    for (size_t i = 0; i < targets.size(); i++) {
+      double x = NativeValueConverter<NativeTypeDouble>::FromNativeValue(values[i * 4]);
+      double y = NativeValueConverter<NativeTypeDouble>::FromNativeValue(values[i * 4 + 1]);
+      double width = NativeValueConverter<NativeTypeDouble>::FromNativeValue(values[i * 4 + 2]);
+      double height = NativeValueConverter<NativeTypeDouble>::FromNativeValue(values[i * 4 + 3]);
+      geometry_cache->SetBoundingClientRect(targets[i]->bindingObject(),
+                                            BoundingClientRectData{x, y, width, height, y, x + width, y + height, x});
+    }
+  }
+  dart_free(values);
+}
+
 Window* Document::defaultView() const {
   return GetExecutingContext()->window();
 }
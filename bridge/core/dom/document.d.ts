@@ -31,9 +31,9 @@ interface Document extends Node, ParentNode {
 
   createElement(tagName: string, options?: any): Element;
   createElementNS(uri: string | null, tagName: string, options?: any): Element;
-  createTextNode(value: string): Text;
+  createTextNode(value: NonAtomicString): Text;
   createDocumentFragment(): DocumentFragment;
-  createComment(data: string): Comment;
+  createComment(data: NonAtomicString): Comment;
   createEvent(event_type: string): Event;
 
   getElementById(id: string): Element | null;
@@ -45,6 +45,8 @@ interface Document extends Node, ParentNode {
   querySelectorAll(selectors: string): Element[];
 
   elementFromPoint(x: number, y: number): Element | null;
+  // Reads the bounding client rects of all elements with a single round trip to dart.
+  __prefetchBoundingClientRects__(elements: Element[]): void;
 
   onreadystatechange: IDLEventHandler | null;
   new(): Document;
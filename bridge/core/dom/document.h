@@ -10,6 +10,7 @@
 #include "event_type_names.h"
 #include "plugin_api/document.h"
 #include "scripted_animation_controller.h"
+#include "selector_query.h"
 #include "tree_scope.h"
 
 namespace webf {
@@ -53,9 +54,9 @@ class Document : public ContainerNode, public TreeScope {
                            const AtomicString& name,
                            const ScriptValue& options,
                            ExceptionState& exception_state);
-  Text* createTextNode(const AtomicString& value, ExceptionState& exception_state);
+  Text* createTextNode(const String& value, ExceptionState& exception_state);
   DocumentFragment* createDocumentFragment(ExceptionState& exception_state);
-  Comment* createComment(const AtomicString& data, ExceptionState& exception_state);
+  Comment* createComment(const String& data, ExceptionState& exception_state);
   Event* createEvent(const AtomicString& type, ExceptionState& exception_state);
   HTMLAllCollection* all();
 
@@ -73,6 +74,7 @@ class Document : public ContainerNode, public TreeScope {
   std::vector<Element*> getElementsByName(const AtomicString& name, ExceptionState& exception_state);
 
   Element* elementFromPoint(double x, double y, ExceptionState& exception_state);
+  void ___prefetchBoundingClientRects__(const std::vector<Element*>& elements, ExceptionState& exception_state);
 
   Window* defaultView() const;
   AtomicString domain();
@@ -126,11 +128,14 @@ class Document : public ContainerNode, public TreeScope {
                                        ExceptionState& exception_state);
   std::shared_ptr<EventListener> GetWindowAttributeEventListener(const AtomicString& event_type);
 
+  SelectorQueryCache& GetSelectorQueryCache() { return selector_query_cache_; }
+
   void Trace(GCVisitor* visitor) const override;
   const DocumentPublicMethods* documentPublicMethods();
 
  private:
   int node_count_{0};
+  SelectorQueryCache selector_query_cache_;
   ScriptAnimationController script_animation_controller_;
   MutationObserverOptions mutation_observer_types_;
 };
@@ -191,3 +191,39 @@ TEST(document, all) {
   EXPECT_EQ(errorCalled, false);
   EXPECT_EQ(logCalled, true);
 }
+
+TEST(Document, getElementByIdAfterMutations) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "first,second,,renamed,,2,1");
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  const char* code =
+      "let first = document.createElement('div');"
+      "first.id = 'a'; first.className = 'item first'; first.textContent = 'first';"
+      "let second = document.createElement('div');"
+      "second.setAttribute('id', 'a'); second.className = 'item'; second.textContent = 'second';"
+      "let result = [];"
+      "document.body.appendChild(second);"
+      "document.body.insertBefore(first, second);"
+      "result.push(document.getElementById('a').textContent);"
+      "document.body.removeChild(first);"
+      "result.push(document.getElementById('a').textContent);"
+      "second.removeAttribute('id');"
+      "result.push(document.getElementById('a'));"
+      "second.id = 'renamed';"
+      "result.push(document.getElementById('renamed').id);"
+      "result.push(document.getElementById('detached'));"
+      "document.body.appendChild(first);"
+      "result.push(document.getElementsByClassName('item').length);"
+      "result.push(document.getElementsByClassName('first item').length);"
+      "console.log(result.join(','));";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
@@ -12,6 +12,7 @@
 #include "child_list_mutation_scope.h"
 #include "comment.h"
 #include "core/dom/document_fragment.h"
+#include "core/dom/selector_query.h"
 #include "core/fileapi/blob.h"
 #include "core/html/html_template_element.h"
 #include "core/html/parser/html_parser.h"
@@ -19,9 +20,11 @@
 #include "element_namespace_uris.h"
 #include "foundation/native_value_converter.h"
 #include "html_element_type_helper.h"
+#include "markup_serializer.h"
 #include "mutation_observer_interest_group.h"
 #include "plugin_api/element.h"
 #include "qjs_element.h"
+#include "space_split_string.h"
 #include "text.h"
 
 namespace webf {
@@ -52,6 +55,12 @@ ElementAttributes& Element::EnsureElementAttributes() const {
   return *attributes_;
 }
 
+const AtomicString* Element::FindAttribute(const AtomicString& name) const {
+  if (attributes_ == nullptr)
+    return nullptr;
+  return attributes_->FindAttribute(name);
+}
+
 bool Element::hasAttribute(const AtomicString& name, ExceptionState& exception_state) {
   return EnsureElementAttributes().hasAttribute(name, exception_state);
 }
@@ -70,11 +79,27 @@ void Element::setAttribute(const AtomicString& name, const AtomicString& value,
   SetAttributeInternal(name, value, AttributeModificationReason::kDirectly, exception_state);
 }
 
+bool Element::ParserSetAttribute(const AtomicString& name, const AtomicString& value) {
+  ExceptionState exception_state;
+  if (!EnsureElementAttributes().setAttribute(name, value, exception_state)) {
+    return false;
+  }
+  AttributeChanged(
+      AttributeModificationParams(name, AtomicString::Null(), value, AttributeModificationReason::kByParser));
+  return true;
+}
+
 void Element::removeAttribute(const AtomicString& name, ExceptionState& exception_state) {
   EnsureElementAttributes().removeAttribute(name, exception_state);
 }
 
 BoundingClientRect* Element::getBoundingClientRect(ExceptionState& exception_state) {
+  // Nothing which may affect layout happened since dart last measured this element.
+  GeometryCache* geometry_cache = GetExecutingContext()->geometryCache();
+  if (const BoundingClientRectData* cached = geometry_cache->GetBoundingClientRect(bindingObject())) {
+    return BoundingClientRect::Create(GetExecutingContext(), *cached);
+  }
+
   NativeValue result = InvokeBindingMethod(
       binding_call_methods::kgetBoundingClientRect, 0, nullptr,
       FlushUICommandReason::kDependentsOnElement | FlushUICommandReason::kDependentsOnLayout, exception_state);
@@ -85,7 +110,9 @@ BoundingClientRect* Element::getBoundingClientRect(ExceptionState& exception_sta
     return nullptr;
   }
 
-  return BoundingClientRect::Create(GetExecutingContext(), native_binding_object);
+  auto* rect = BoundingClientRect::Create(GetExecutingContext(), native_binding_object);
+  geometry_cache->SetBoundingClientRect(bindingObject(), rect->data());
+  return rect;
 }
 
 std::vector<BoundingClientRect*> Element::getClientRects(ExceptionState& exception_state) {
@@ -203,26 +230,18 @@ void Element::setId(const AtomicString& value, ExceptionState& exception_state)
 }
 
 std::vector<Element*> Element::getElementsByClassName(const AtomicString& class_name, ExceptionState& exception_state) {
-  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), class_name)};
-  NativeValue result = InvokeBindingMethod(binding_call_methods::kgetElementsByClassName, 1, arguments,
-                                           FlushUICommandReason::kDependentsAll, exception_state);
-  if (exception_state.HasException()) {
-    return {};
-  }
-  return NativeValueConverter<NativeTypeArray<NativeTypePointer<Element>>>::FromNativeValue(ctx(), result);
+  return SelectorQuery::ElementsByClassName(*this, class_name);
 }
 
 std::vector<Element*> Element::getElementsByTagName(const AtomicString& tag_name, ExceptionState& exception_state) {
-  NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), tag_name)};
-  NativeValue result = InvokeBindingMethod(binding_call_methods::kgetElementsByTagName, 1, arguments,
-                                           FlushUICommandReason::kDependentsAll, exception_state);
-  if (exception_state.HasException()) {
-    return {};
-  }
-  return NativeValueConverter<NativeTypeArray<NativeTypePointer<Element>>>::FromNativeValue(ctx(), result);
+  return SelectorQuery::ElementsByTagName(*this, tag_name);
 }
 
 Element* Element::querySelector(const AtomicString& selectors, ExceptionState& exception_state) {
+  if (SelectorQuery* selector_query = GetDocument().GetSelectorQueryCache().Add(ctx(), selectors)) {
+    return selector_query->QueryFirst(*this);
+  }
+
   NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), selectors)};
   NativeValue result = InvokeBindingMethod(binding_call_methods::kquerySelector, 1, arguments,
                                            FlushUICommandReason::kDependentsAll, exception_state);
@@ -233,6 +252,10 @@ Element* Element::querySelector(const AtomicString& selectors, ExceptionState& e
 }
 
 std::vector<Element*> Element::querySelectorAll(const AtomicString& selectors, ExceptionState& exception_state) {
+  if (SelectorQuery* selector_query = GetDocument().GetSelectorQueryCache().Add(ctx(), selectors)) {
+    return selector_query->QueryAll(*this);
+  }
+
   NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), selectors)};
   NativeValue result = InvokeBindingMethod(binding_call_methods::kquerySelectorAll, 1, arguments,
                                            FlushUICommandReason::kDependentsAll, exception_state);
@@ -243,6 +266,10 @@ std::vector<Element*> Element::querySelectorAll(const AtomicString& selectors, E
 }
 
 bool Element::matches(const AtomicString& selectors, ExceptionState& exception_state) {
+  if (SelectorQuery* selector_query = GetDocument().GetSelectorQueryCache().Add(ctx(), selectors)) {
+    return selector_query->Matches(*this);
+  }
+
   NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), selectors)};
   NativeValue result = InvokeBindingMethod(binding_call_methods::kmatches, 1, arguments,
                                            FlushUICommandReason::kDependentsAll, exception_state);
@@ -253,6 +280,10 @@ bool Element::matches(const AtomicString& selectors, ExceptionState& exception_s
 }
 
 Element* Element::closest(const AtomicString& selectors, ExceptionState& exception_state) {
+  if (SelectorQuery* selector_query = GetDocument().GetSelectorQueryCache().Add(ctx(), selectors)) {
+    return selector_query->Closest(*this);
+  }
+
   NativeValue arguments[] = {NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), selectors)};
   NativeValue result = InvokeBindingMethod(binding_call_methods::kclosest, 1, arguments,
                                            FlushUICommandReason::kDependentsAll, exception_state);
@@ -561,7 +592,15 @@ void Element::DidModifyAttribute(const AtomicString& name,
   AttributeChanged(AttributeModificationParams(name, old_value, new_value, reason));
 }
 
-void Element::DidRemoveAttribute(const AtomicString& name, const AtomicString& old_value) {}
+void Element::DidRemoveAttribute(const AtomicString& name, const AtomicString& old_value) {
+  if (!isConnected())
+    return;
+  if (name == html_names::kIdAttr) {
+    UpdateId(GetTreeScope(), old_value, AtomicString::Null());
+  } else if (name == html_names::kClassAttr) {
+    UpdateClassTokens(GetTreeScope(), old_value, AtomicString::Null());
+  }
+}
 
 void Element::SynchronizeStyleAttributeInternal() {
   assert(IsStyledElement());
@@ -624,6 +663,14 @@ void Element::InvalidateStyleAttribute() {
 void Element::AttributeChanged(const AttributeModificationParams& params) {
   const AtomicString& name = params.name;
 
+  if (isConnected()) {
+    if (name == html_names::kIdAttr) {
+      UpdateId(GetTreeScope(), params.old_value, params.new_value);
+    } else if (name == html_names::kClassAttr) {
+      UpdateClassTokens(GetTreeScope(), params.old_value, params.new_value);
+    }
+  }
+
   if (IsStyledElement()) {
     if (name == html_names::kStyleAttr) {
       StyleAttributeChanged(params.new_value, params.reason);
@@ -631,6 +678,55 @@ void Element::AttributeChanged(const AttributeModificationParams& params) {
   }
 }
 
+void Element::InsertedInto(ContainerNode& insertion_point) {
+  ContainerNode::InsertedInto(insertion_point);
+  if (!insertion_point.isConnected())
+    return;
+
+  if (const AtomicString* id = FindAttribute(html_names::kIdAttr)) {
+    UpdateId(insertion_point.GetTreeScope(), AtomicString::Null(), *id);
+  }
+  if (const AtomicString* class_name = FindAttribute(html_names::kClassAttr)) {
+    UpdateClassTokens(insertion_point.GetTreeScope(), AtomicString::Null(), *class_name);
+  }
+}
+
+void Element::RemovedFrom(ContainerNode& insertion_point) {
+  if (insertion_point.isConnected()) {
+    if (const AtomicString* id = FindAttribute(html_names::kIdAttr)) {
+      UpdateId(insertion_point.GetTreeScope(), *id, AtomicString::Null());
+    }
+    if (const AtomicString* class_name = FindAttribute(html_names::kClassAttr)) {
+      UpdateClassTokens(insertion_point.GetTreeScope(), *class_name, AtomicString::Null());
+    }
+  }
+  ContainerNode::RemovedFrom(insertion_point);
+}
+
+void Element::UpdateId(TreeScope& scope, const AtomicString& old_id, const AtomicString& new_id) {
+  if (old_id == new_id)
+    return;
+  if (!old_id.IsNull() && !old_id.IsEmpty())
+    scope.RemoveElementById(old_id, *this);
+  if (!new_id.IsNull() && !new_id.IsEmpty())
+    scope.AddElementById(new_id, *this);
+}
+
+void Element::UpdateClassTokens(TreeScope& scope, const AtomicString& old_class, const AtomicString& new_class) {
+  if (old_class == new_class)
+    return;
+  SpaceSplitString old_tokens(ctx(), old_class);
+  SpaceSplitString new_tokens(ctx(), new_class);
+  for (size_t i = 0; i < old_tokens.size(); i++) {
+    if (!new_tokens.Contains(old_tokens[i]))
+      scope.RemoveElementByClassToken(old_tokens[i], *this);
+  }
+  for (size_t i = 0; i < new_tokens.size(); i++) {
+    if (!old_tokens.Contains(new_tokens[i]))
+      scope.AddElementByClassToken(new_tokens[i], *this);
+  }
+}
+
 void Element::StyleAttributeChanged(const AtomicString& new_style_string,
                                     AttributeModificationReason modification_reason) {
   assert(IsStyledElement());
@@ -647,52 +743,11 @@ void Element::SetInlineStyleFromString(const webf::AtomicString& new_style_strin
 }
 
 std::string Element::outerHTML() {
-  std::string tagname = local_name_.ToStdString(ctx());
-  std::string s = "<" + tagname;
-
-  // Read attributes
-  if (attributes_ != nullptr) {
-    s += " " + attributes_->ToString();
-  }
-  if (cssom_wrapper_ != nullptr) {
-    s += " style=\"" + cssom_wrapper_->ToString();
-  }
-
-  s += ">";
-
-  std::string childHTML = innerHTML();
-  s += childHTML;
-  s += "</" + tagname + ">";
-
-  return s;
+  return MarkupSerializer::ForCurrentThread().SerializeElement(*this);
 }
 
 std::string Element::innerHTML() {
-  std::string s;
-
-  // If Element is TemplateElement, the innerHTML content is the content of documentFragment.
-  Node* parent = To<Node>(this);
-
-  if (auto* template_element = DynamicTo<HTMLTemplateElement>(this)) {
-    parent = To<Node>(template_element->content());
-  }
-
-  if (parent->firstChild() == nullptr)
-    return s;
-
-  auto* child = parent->firstChild();
-  while (child != nullptr) {
-    if (auto* element = DynamicTo<Element>(child)) {
-      s += element->outerHTML();
-    } else if (auto* text = DynamicTo<Text>(child)) {
-      s += text->data().ToStdString(ctx());
-    } else if (auto* comment = DynamicTo<Comment>(child)) {
-      s += "<!--" + comment->data().ToStdString(ctx()) + "-->";
-    }
-    child = child->nextSibling();
-  }
-
-  return s;
+  return MarkupSerializer::ForCurrentThread().SerializeChildren(*this);
 }
 
 void Element::setInnerHTML(const AtomicString& value, ExceptionState& exception_state) {
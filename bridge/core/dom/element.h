@@ -57,6 +57,8 @@ class Element : public ContainerNode {
 
   ElementAttributes* attributes() const { return &EnsureElementAttributes(); }
   ElementAttributes& EnsureElementAttributes() const;
+  // Attribute lookup for selector matching, never creates the attributes object or calls into dart.
+  const AtomicString* FindAttribute(const AtomicString& name) const;
 
   bool hasAttribute(const AtomicString&, ExceptionState& exception_state);
   AtomicString getAttribute(const AtomicString&, ExceptionState& exception_state) const;
@@ -65,6 +67,8 @@ class Element : public ContainerNode {
   // calling either of these set methods.
   void setAttribute(const AtomicString&, const AtomicString& value);
   void setAttribute(const AtomicString&, const AtomicString& value, ExceptionState&);
+  // Sets an attribute of an element created by the HTML parser, no mutation observer can be interested in it yet.
+  bool ParserSetAttribute(const AtomicString& name, const AtomicString& value);
   void removeAttribute(const AtomicString&, ExceptionState& exception_state);
   BoundingClientRect* getBoundingClientRect(ExceptionState& exception_state);
   std::vector<BoundingClientRect*> getClientRects(ExceptionState& exception_state);
@@ -142,6 +146,9 @@ class Element : public ContainerNode {
   NodeType nodeType() const override;
   bool ChildTypeAllowed(NodeType) const override;
 
+  void InsertedInto(ContainerNode& insertion_point) override;
+  void RemovedFrom(ContainerNode& insertion_point) override;
+
   // Clones attributes only.
   void CloneAttributesFrom(const Element&);
   bool HasEquivalentAttributes(const Element& other) const;
@@ -169,6 +176,8 @@ class Element : public ContainerNode {
   AtomicString local_name_ = AtomicString::Empty();
 
  private:
+  friend class MarkupSerializer;
+
   // Clone is private so that non-virtual CloneElementWithChildren and
   // CloneElementWithoutChildren are used inst
   Node* Clone(Document&, CloneChildrenFlag) const override;
@@ -180,6 +189,10 @@ class Element : public ContainerNode {
   void _notifyChildInsert();
   void _beforeUpdateId(JSValue oldIdValue, JSValue newIdValue);
 
+  // Keep the id and class indexes of the tree scope in sync, only connected elements are indexed.
+  void UpdateId(TreeScope& scope, const AtomicString& old_id, const AtomicString& new_id);
+  void UpdateClassTokens(TreeScope& scope, const AtomicString& old_class, const AtomicString& new_class);
+
   mutable std::unique_ptr<ElementData> element_data_;
   mutable Member<ElementAttributes> attributes_;
   Member<InlineCssStyleDeclaration> cssom_wrapper_;
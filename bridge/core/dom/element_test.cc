@@ -4,6 +4,7 @@
  */
 
 #include "core/dom/legacy/bounding_client_rect.h"
+#include "core/dom/subtree_stream.h"
 #include "gtest/gtest.h"
 #include "webf_test_env.h"
 using namespace webf;
@@ -79,6 +80,46 @@ TEST(Element, setAttributeWithHTML) {
   EXPECT_EQ(errorCalled, false);
 }
 
+TEST(Element, innerHTMLSendsSubtreeAsOneCommand) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "10px SPAN hi true");
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = env->page()->executingContext();
+  int64_t command_start = context->uiCommandBuffer()->size();
+  const char* code =
+      "document.body.innerHTML = '<div id=\"box\" style=\"width: 10px\"><span class=\"a\">hi</span>"
+      "<svg><path d=\"M0 0\"></path></svg></div>';"
+      "let box = document.getElementById('box');"
+      "console.log(box.style.width, box.firstChild.tagName, box.firstChild.textContent, "
+      "document.getElementsByClassName('a')[0] === box.firstChild);";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+
+  int subtree_commands = 0;
+  auto* items = static_cast<UICommandItem*>(context->uiCommandBuffer()->data());
+  for (int64_t i = command_start; i < context->uiCommandBuffer()->size(); i++) {
+    auto type = static_cast<UICommand>(items[i].type);
+    EXPECT_NE(type, UICommand::kCreateElement);
+    EXPECT_NE(type, UICommand::kSetAttribute);
+    EXPECT_NE(type, UICommand::kSetStyleById);
+    if (type == UICommand::kInsertSubtree) {
+      subtree_commands++;
+      auto* stream = reinterpret_cast<NativeSubtreeStream*>(items[i].nativePtr2);
+      // box, span, text, svg and path, the four attributes of box, span and path and the text data.
+      EXPECT_EQ(stream->length, 5 * 3 + 4 * 2 + 1);
+    }
+  }
+  EXPECT_EQ(subtree_commands, 1);
+}
+
 TEST(Element, outerHTML) {
   bool static errorCalled = false;
   bool static logCalled = false;
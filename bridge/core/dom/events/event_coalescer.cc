@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "event_coalescer.h"
+#include "bindings/qjs/exception_state.h"
+#include "core/dom/events/event_target.h"
+#include "core/events/pointer_event.h"
+#include "core/executing_context.h"
+#include "event_type_names.h"
+
+namespace webf {
+
+bool EventCoalescer::IsCoalescable(const AtomicString& event_type) {
+  return event_type == event_type_names::kpointermove || event_type == event_type_names::ktouchmove ||
+         event_type == event_type_names::kmousemove || event_type == event_type_names::kscroll;
+}
+
+void EventCoalescer::Enqueue(EventTarget* target, Event* event) {
+  for (auto it = pending_events_.begin(); it != pending_events_.end(); it++) {
+    if (it->target.Get() != target || !IsSameKind(*it->event, *event))
+      continue;
+
+    auto* pointer_event = DynamicTo<PointerEvent>(event);
+    auto* pending_pointer_event = DynamicTo<PointerEvent>(it->event.Get());
+    if (pointer_event != nullptr && pending_pointer_event != nullptr) {
+      pointer_event->CoalesceEarlierEvent(pending_pointer_event);
+    }
+    pending_events_.erase(it);
+    break;
+  }
+  pending_events_.emplace_back(PendingEvent{target, event});
+
+  // Without a dedicated thread Dart waits for each event, the pending ones are only dispatched by Flush().
+  if (!flush_task_posted_ && context_->isDedicated()) {
+    flush_task_posted_ = true;
+    context_->dartIsolateContext()->dispatcher()->PostToJs(true, static_cast<int32_t>(context_->contextId()),
+                                                           HandleFlushTask, context_, context_->contextId());
+  }
+}
+
+void EventCoalescer::Flush() {
+  if (pending_events_.empty())
+    return;
+
+  // Listeners may cause new events to be queued meanwhile, they wait for the next flush.
+  std::vector<PendingEvent> pending_events;
+  std::swap(pending_events, pending_events_);
+
+  for (auto& pending_event : pending_events) {
+    ExceptionState exception_state;
+    pending_event.target->DispatchEventAlongPath(*pending_event.event, exception_state);
+    context_->HandleException(exception_state);
+  }
+}
+
+void EventCoalescer::HandleFlushTask(ExecutingContext* context, double context_id) {
+  if (!isContextValid(context_id))
+    return;
+
+  MemberMutationScope mutation_scope{context};
+  EventCoalescer* coalescer = context->eventCoalescer();
+  coalescer->flush_task_posted_ = false;
+  coalescer->Flush();
+}
+
+bool EventCoalescer::IsSameKind(const Event& event, const Event& other) {
+  if (event.type() != other.type())
+    return false;
+
+  // Each pointer moves on its own.
+  auto* pointer_event = DynamicTo<PointerEvent>(event);
+  auto* other_pointer_event = DynamicTo<PointerEvent>(other);
+  if (pointer_event != nullptr && other_pointer_event != nullptr)
+    return pointer_event->pointerId() == other_pointer_event->pointerId();
+  return true;
+}
+
+}  // namespace webf
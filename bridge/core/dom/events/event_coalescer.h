@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef WEBF_CORE_DOM_EVENTS_EVENT_COALESCER_H_
+#define WEBF_CORE_DOM_EVENTS_EVENT_COALESCER_H_
+
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
+#include "bindings/qjs/cppgc/member.h"
+#include "foundation/macros.h"
+
+namespace webf {
+
+class Event;
+class EventTarget;
+class ExecutingContext;
+
+// Merges the high frequency input events Dart posts to the JS thread while it is busy.
+//
+// Only the latest event of each kind at a target is dispatched, the earlier pointer events are kept as its coalesced
+// events, see PointerEvent::getCoalescedEvents(). The pending events are flushed by a task posted behind the ones
+// already queued for the JS thread, and before any other event from Dart is dispatched to keep the order.
+class EventCoalescer {
+ public:
+  explicit EventCoalescer(ExecutingContext* context) : context_(context) {}
+  WEBF_DISALLOW_COPY_ASSIGN_AND_MOVE(EventCoalescer);
+
+  static bool IsCoalescable(const AtomicString& event_type);
+
+  // Queues |event| to be dispatched along the path of |target|, replacing the pending event of the same kind.
+  void Enqueue(EventTarget* target, Event* event);
+  // Dispatches the pending events in the order their latest sample arrived.
+  void Flush();
+
+  bool HasPendingEvents() const { return !pending_events_.empty(); }
+
+ private:
+  struct PendingEvent {
+    Member<EventTarget> target;
+    Member<Event> event;
+  };
+
+  static void HandleFlushTask(ExecutingContext* context, double context_id);
+  static bool IsSameKind(const Event& event, const Event& other);
+
+  ExecutingContext* context_;
+  std::vector<PendingEvent> pending_events_;
+  bool flush_task_posted_{false};
+};
+
+}  // namespace webf
+
+#endif  // WEBF_CORE_DOM_EVENTS_EVENT_COALESCER_H_
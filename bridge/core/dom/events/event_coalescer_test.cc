@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "event_coalescer.h"
+#include "core/dom/events/event.h"
+#include "core/dom/events/event_target.h"
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+namespace {
+
+// Queues the [target, event] pairs of globalThis.queue and flushes them.
+std::string EnqueueAndFlush(const char* setup) {
+  return TEST_collectConsoleMessages(setup, [](ExecutingContext* context, std::string& logs) {
+    EventCoalescer coalescer{context};
+    JSContext* ctx = context->ctx();
+    JSValue queue = JS_GetPropertyStr(ctx, context->Global(), "queue");
+    JSValue length_value = JS_GetPropertyStr(ctx, queue, "length");
+    int32_t length;
+    JS_ToInt32(ctx, &length, length_value);
+    for (int32_t i = 0; i < length; i++) {
+      JSValue pair = JS_GetPropertyUint32(ctx, queue, i);
+      JSValue target = JS_GetPropertyUint32(ctx, pair, 0);
+      JSValue event = JS_GetPropertyUint32(ctx, pair, 1);
+      coalescer.Enqueue(toScriptWrappable<EventTarget>(target), toScriptWrappable<Event>(event));
+      JS_FreeValue(ctx, event);
+      JS_FreeValue(ctx, target);
+      JS_FreeValue(ctx, pair);
+    }
+    JS_FreeValue(ctx, length_value);
+    JS_FreeValue(ctx, queue);
+
+    logs += "| ";
+    EXPECT_EQ(coalescer.HasPendingEvents(), length > 0);
+    coalescer.Flush();
+    EXPECT_EQ(coalescer.HasPendingEvents(), false);
+  });
+}
+
+}  // namespace
+
+TEST(EventCoalescer, dispatchesLatestPointerMove) {
+  std::string logs = EnqueueAndFlush(R"(
+const div = document.createElement('div');
+document.body.appendChild(div);
+document.body.addEventListener('pointermove', (e) => {
+  console.log(e.width + ':' + e.getCoalescedEvents().map((event) => event.width).join(','));
+});
+globalThis.queue = [1, 2, 3].map((width) => [div, new PointerEvent('pointermove', { bubbles: true, width })]);
+)");
+  EXPECT_EQ(logs, "| 3:1,2,3 ");
+}
+
+TEST(EventCoalescer, keepsPointersTargetsAndTypesApart) {
+  std::string logs = EnqueueAndFlush(R"(
+const a = document.createElement('div');
+const b = document.createElement('div');
+document.body.appendChild(a);
+document.body.appendChild(b);
+const log = (name) => (e) => console.log(name + e.pointerId + ':' + e.getCoalescedEvents().map((event) => event.width));
+a.addEventListener('pointermove', log('a'));
+b.addEventListener('pointermove', log('b'));
+a.addEventListener('scroll', () => console.log('scroll'));
+const move = (pointerId, width) => new PointerEvent('pointermove', { pointerId, width });
+globalThis.queue = [
+  [a, move(1, 1)],
+  [a, move(2, 10)],
+  [b, move(1, 20)],
+  [a, new Event('scroll')],
+  [a, move(1, 2)],
+  [a, new Event('scroll')],
+];
+)");
+  EXPECT_EQ(logs, "| a2:10 b1:20 a1:1,2 scroll ");
+}
@@ -6,6 +6,9 @@
 #include <cstdint>
 #include "binding_call_methods.h"
 #include "bindings/qjs/converter_impl.h"
+#include "core/dom/container_node.h"
+#include "core/dom/document.h"
+#include "core/dom/events/event_coalescer.h"
 #include "event_factory.h"
 #include "event_target.h"
 #include "include/dart_api.h"
@@ -22,12 +25,6 @@
 
 namespace webf {
 
-struct EventDispatchResult : public DartReadable {
-  bool canceled{false};
-  bool propagationStopped{false};
-  bool preventDefaulted{false};
-};
-
 struct DartEventListenerOptions : public DartReadable {
   bool capture{false};
 };
@@ -353,6 +350,57 @@ bool EventTarget::RemoveEventListenerInternal(const AtomicString& event_type,
   return true;
 }
 
+// Collects the targets an event at |target| propagates through, from |target| up to the window.
+static void CalculateEventPath(EventTarget* target, std::vector<Member<EventTarget>>& path) {
+  Node* node = target->ToNode();
+  if (node == nullptr) {
+    path.emplace_back(target);
+    return;
+  }
+
+  for (Node* current = node; current != nullptr; current = current->parentNode()) {
+    path.emplace_back(current);
+    if (current->IsDocumentNode() && current->GetExecutingContext()->window() != nullptr) {
+      path.emplace_back(current->GetExecutingContext()->window());
+    }
+  }
+}
+
+DispatchEventResult EventTarget::DispatchEventAlongPath(Event& event, ExceptionState& exception_state) {
+  std::vector<Member<EventTarget>> path;
+  path.reserve(16);
+  CalculateEventPath(this, path);
+
+  event.SetTarget(this);
+
+  // Capturing listeners run from the outermost ancestor down to the parent of the target.
+  event.SetEventPhase(Event::kCapturingPhase);
+  for (size_t i = path.size() - 1; i > 0 && !event.propagationStopped(); i--) {
+    event.SetCurrentTarget(path[i].Get());
+    path[i]->FireEventListeners(event, true, exception_state);
+  }
+
+  // Every listener of the target runs unless propagation was stopped by an ancestor, capturing ones first.
+  if (!event.propagationStopped()) {
+    event.SetEventPhase(Event::kAtTarget);
+    event.SetCurrentTarget(this);
+    FireEventListeners(event, true, exception_state);
+    FireEventListeners(event, false, exception_state);
+  }
+
+  if (event.bubbles()) {
+    event.SetEventPhase(Event::kBubblingPhase);
+    for (size_t i = 1; i < path.size() && !event.propagationStopped(); i++) {
+      event.SetCurrentTarget(path[i].Get());
+      path[i]->FireEventListeners(event, false, exception_state);
+    }
+  }
+
+  event.SetEventPhase(0);
+  event.SetCurrentTarget(nullptr);
+  return GetDispatchEventResult(event);
+}
+
 DispatchEventResult EventTarget::DispatchEventInternal(Event& event, ExceptionState& exception_state) {
   event.SetTarget(this);
   event.SetCurrentTarget(this);
@@ -373,10 +421,20 @@ NativeValue EventTarget::HandleCallFromDartSide(const AtomicString& method,
   if (method == binding_call_methods::kdispatchEvent) {
     return HandleDispatchEventFromDart(argc, argv, dart_object);
   }
+  if (method == binding_call_methods::kdispatchEventAlongPath) {
+    return HandleDispatchEventAlongPathFromDart(argc, argv, dart_object);
+  }
 
   return Native_NewNull();
 }
 
+static void WillDispatchEventFromDart(Event& event) {
+  auto* window = DynamicTo<Window>(event.target());
+  if (window != nullptr && (event.type() == event_type_names::kload || event.type() == event_type_names::kgcopen)) {
+    window->OnLoadEventFired();
+  }
+}
+
 NativeValue EventTarget::HandleDispatchEventFromDart(int32_t argc, const NativeValue* argv, Dart_Handle dart_object) {
   GetExecutingContext()->dartIsolateContext()->profiler()->StartTrackSteps("EventTarget::HandleDispatchEventFromDart");
 
@@ -391,11 +449,8 @@ NativeValue EventTarget::HandleDispatchEventFromDart(int32_t argc, const NativeV
   Event* event = EventFactory::Create(GetExecutingContext(), event_type, raw_event);
   assert(event->target() != nullptr);
   assert(event->currentTarget() != nullptr);
-
-  auto* window = DynamicTo<Window>(event->target());
-  if (window != nullptr && (event->type() == event_type_names::kload || event->type() == event_type_names::kgcopen)) {
-    window->OnLoadEventFired();
-  }
+  GetExecutingContext()->eventCoalescer()->Flush();
+  WillDispatchEventFromDart(*event);
 
   ExceptionState exception_state;
   event->SetTrusted(false);
@@ -403,6 +458,66 @@ NativeValue EventTarget::HandleDispatchEventFromDart(int32_t argc, const NativeV
   DispatchEventResult dispatch_result = FireEventListeners(*event, isCapture, exception_state);
   event->SetEventPhase(0);
 
+  return FinishDispatchEventFromDart(event, dispatch_result, exception_state, dart_object);
+}
+
+NativeValue EventTarget::HandleDispatchEventAlongPathFromDart(int32_t argc,
+                                                              const NativeValue* argv,
+                                                              Dart_Handle dart_object) {
+  GetExecutingContext()->dartIsolateContext()->profiler()->StartTrackSteps(
+      "EventTarget::HandleDispatchEventAlongPathFromDart");
+
+  assert(argc >= 2);
+  NativeValue native_event_type = argv[0];
+  AtomicString event_type =
+      NativeValueConverter<NativeTypeString>::FromNativeValue(ctx(), std::move(native_event_type));
+  RawEvent* raw_event = NativeValueConverter<NativeTypePointer<RawEvent>>::FromNativeValue(argv[1]);
+
+  Event* event = EventFactory::Create(GetExecutingContext(), event_type, raw_event);
+  assert(event->target() == this);
+  event->SetTrusted(false);
+
+  // While the JS thread is behind, move events only wait for the next event of the same kind or the flush task.
+  // Nothing was dispatched yet when Dart gets the result, so there are no props for it to keep alive.
+  EventCoalescer* coalescer = GetExecutingContext()->eventCoalescer();
+  if (GetExecutingContext()->isDedicated() && EventCoalescer::IsCoalescable(event_type)) {
+    coalescer->Enqueue(this, event);
+    GetExecutingContext()->dartIsolateContext()->profiler()->FinishTrackSteps();
+    return NativeValueConverter<NativeTypePointer<EventDispatchResult>>::ToNativeValue(new EventDispatchResult());
+  }
+  coalescer->Flush();
+  WillDispatchEventFromDart(*event);
+
+  ExceptionState exception_state;
+  DispatchEventResult dispatch_result = DispatchEventAlongPath(*event, exception_state);
+
+  return FinishDispatchEventFromDart(event, dispatch_result, exception_state, dart_object);
+}
+
+NativeValue EventTarget::FinishDispatchEventFromDart(Event* event,
+                                                     DispatchEventResult dispatch_result,
+                                                     ExceptionState& exception_state,
+                                                     Dart_Handle dart_object) {
+  if (dart_object != nullptr) {
+    KeepEventAliveForDartObject(event, dart_object);
+  }
+
+  if (exception_state.HasException()) {
+    JSValue error = JS_GetException(ctx());
+    GetExecutingContext()->ReportError(error);
+    JS_FreeValue(ctx(), error);
+  }
+
+  GetExecutingContext()->dartIsolateContext()->profiler()->FinishTrackSteps();
+
+  auto* result = new EventDispatchResult{.canceled = dispatch_result == DispatchEventResult::kCanceledByEventHandler,
+                                         .propagationStopped = event->propagationStopped(),
+                                         .preventDefaulted = event->defaultPrevented()};
+  return NativeValueConverter<NativeTypePointer<EventDispatchResult>>::ToNativeValue(result);
+}
+
+// The props set by listeners live in the JS event, which is kept until the Dart event is finalized.
+void EventTarget::KeepEventAliveForDartObject(Event* event, Dart_Handle dart_object) {
   auto* wire = new DartWireContext();
   wire->jsObject = event->ToValue();
   wire->is_dedicated = GetExecutingContext()->isDedicated();
@@ -434,19 +549,6 @@ NativeValue EventTarget::HandleDispatchEventFromDart(int32_t argc, const NativeV
         Dart_NewFinalizableHandle_DL(object, peer, external_allocation_size, callback);
       },
       dart_object, reinterpret_cast<void*>(wire), sizeof(DartWireContext), dart_object_finalize_callback);
-
-  if (exception_state.HasException()) {
-    JSValue error = JS_GetException(ctx());
-    GetExecutingContext()->ReportError(error);
-    JS_FreeValue(ctx(), error);
-  }
-
-  GetExecutingContext()->dartIsolateContext()->profiler()->FinishTrackSteps();
-
-  auto* result = new EventDispatchResult{.canceled = dispatch_result == DispatchEventResult::kCanceledByEventHandler,
-                                         .propagationStopped = event->propagationStopped(),
-                                         .preventDefaulted = event->defaultPrevented()};
-  return NativeValueConverter<NativeTypePointer<EventDispatchResult>>::ToNativeValue(result);
 }
 
 RegisteredEventListener* EventTarget::GetAttributeRegisteredEventListener(const AtomicString& event_type) {
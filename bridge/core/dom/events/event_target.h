@@ -46,6 +46,13 @@ enum class DispatchEventResult {
   kCanceledBeforeDispatch,
 };
 
+// The result of a dispatch requested by Dart, read and freed by Dart.
+struct EventDispatchResult : public DartReadable {
+  bool canceled{false};
+  bool propagationStopped{false};
+  bool preventDefaulted{false};
+};
+
 struct FiringEventIterator {
   WEBF_DISALLOW_NEW();
 
@@ -122,6 +129,8 @@ class EventTarget : public BindingObject {
                            bool use_capture,
                            ExceptionState& exception_state);
   bool dispatchEvent(Event* event, ExceptionState& exception_state);
+  // Runs the capturing, at target and bubbling phases over the ancestors of this target in the bridge tree.
+  DispatchEventResult DispatchEventAlongPath(Event& event, ExceptionState& exception_state);
 
   virtual DispatchEventResult FireEventListeners(Event&, ExceptionState&);
   virtual DispatchEventResult FireEventListeners(Event&, bool isCapture, ExceptionState&);
@@ -159,7 +168,10 @@ class EventTarget : public BindingObject {
 
   DispatchEventResult DispatchEventInternal(Event& event, ExceptionState& exception_state);
 
+  // Fires the listeners of this target only, Dart calls it for each target of the path.
   NativeValue HandleDispatchEventFromDart(int32_t argc, const NativeValue* argv, Dart_Handle dart_object);
+  // Dispatches the event along the whole path with one call from Dart.
+  NativeValue HandleDispatchEventAlongPathFromDart(int32_t argc, const NativeValue* argv, Dart_Handle dart_object);
 
   // Subclasses should likely not override these themselves; instead, they
   // should subclass EventTargetWithInlineData.
@@ -168,6 +180,11 @@ class EventTarget : public BindingObject {
 
  private:
   RegisteredEventListener* GetAttributeRegisteredEventListener(const AtomicString& event_type);
+  NativeValue FinishDispatchEventFromDart(Event* event,
+                                          DispatchEventResult dispatch_result,
+                                          ExceptionState& exception_state,
+                                          Dart_Handle dart_object);
+  void KeepEventAliveForDartObject(Event* event, Dart_Handle dart_object);
 
   bool FireEventListeners(Event&, EventTargetData*, EventListenerVector&, ExceptionState&);
 };
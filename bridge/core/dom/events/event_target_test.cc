@@ -3,7 +3,10 @@
  * Copyright (C) 2022-present The WebF authors. All rights reserved.
  */
 #include "event_target.h"
+#include "binding_call_methods.h"
+#include "bindings/qjs/cppgc/mutation_scope.h"
 #include "core/dom/container_node.h"
+#include "core/dom/document.h"
 #include "core/dom/events/event.h"
 #include "event_type_names.h"
 #include "gtest/gtest.h"
@@ -276,4 +279,57 @@ proxy.dispatchEvent(new Event('click'));
 
   JS_RunGC(JS_GetRuntime(env->page()->executingContext()->ctx()));
   EXPECT_EQ(logCalled, true);
-}
\ No newline at end of file
+}
+
+namespace {
+
+std::string DispatchClickAlongPathFromDart(const char* setup) {
+  return TEST_collectConsoleMessages(setup, [](ExecutingContext* context, std::string& logs) {
+    auto* span = To<ContainerNode>(context->document()->body()->firstChild())->firstChild();
+
+    NativeEvent native_event;
+    native_event.bubbles = 1;
+    native_event.target = span->bindingObject();
+    native_event.currentTarget = span->bindingObject();
+    native_event.props = nullptr;
+    native_event.props_len = 0;
+    RawEvent raw_event;
+    raw_event.bytes = reinterpret_cast<uint64_t*>(&native_event);
+    raw_event.length = sizeof(NativeEvent) / sizeof(int64_t);
+    raw_event.is_custom_event = 0;
+
+    NativeValue argv[] = {Native_NewCString("click"), Native_NewPtr(JSPointerType::Others, &raw_event)};
+    NativeValue result = span->HandleCallFromDartSide(binding_call_methods::kdispatchEventAlongPath, 2, argv, nullptr);
+    auto* dispatch_result = static_cast<EventDispatchResult*>(result.u.ptr);
+    logs += dispatch_result->propagationStopped ? "stopped" : "done";
+    delete dispatch_result;
+  });
+}
+
+const char* kPathListeners = R"(
+const div = document.createElement('div');
+const span = document.createElement('span');
+div.appendChild(span);
+document.body.appendChild(div);
+const targets = { window, document, body: document.body, div, span };
+for (const name in targets) {
+  const log = (phase) => (e) => console.log(name + ':' + phase + (e.currentTarget === targets[name] ? '' : '!'));
+  targets[name].addEventListener('click', log('capture'), true);
+  targets[name].addEventListener('click', log('bubble'));
+}
+)";
+
+}  // namespace
+
+TEST(EventTarget, dispatchEventAlongPathFromDart) {
+  std::string logs = DispatchClickAlongPathFromDart(kPathListeners);
+  EXPECT_EQ(logs,
+            "window:capture document:capture body:capture div:capture span:capture span:bubble div:bubble "
+            "body:bubble document:bubble window:bubble done");
+}
+
+TEST(EventTarget, dispatchEventAlongPathFromDartStopsPropagation) {
+  std::string setup = std::string(kPathListeners) + "div.addEventListener('click', (e) => e.stopPropagation(), true);";
+  std::string logs = DispatchClickAlongPathFromDart(setup.c_str());
+  EXPECT_EQ(logs, "window:capture document:capture body:capture div:capture stopped");
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "geometry_cache.h"
+#include "core/executing_context.h"
+
+namespace webf {
+
+const BoundingClientRectData* GeometryCache::GetBoundingClientRect(const NativeBindingObject* target) {
+  Entry* entry = Find(target);
+  return entry != nullptr && entry->has_rect ? &entry->rect : nullptr;
+}
+
+void GeometryCache::SetBoundingClientRect(const NativeBindingObject* target, const BoundingClientRectData& rect) {
+  Entry& entry = Ensure(target);
+  entry.has_rect = true;
+  entry.rect = rect;
+}
+
+bool GeometryCache::GetProperty(const NativeBindingObject* target, const AtomicString& name, NativeValue& value) {
+  if (Entry* entry = Find(target)) {
+    for (auto& property : entry->properties) {
+      if (property.first == name) {
+        value = property.second;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void GeometryCache::SetProperty(const NativeBindingObject* target, const AtomicString& name, const NativeValue& value) {
+  if (value.tag != NativeTag::TAG_FLOAT64 && value.tag != NativeTag::TAG_INT)
+    return;
+
+  Entry& entry = Ensure(target);
+  for (auto& property : entry.properties) {
+    if (property.first == name) {
+      property.second = value;
+      return;
+    }
+  }
+  entry.properties.emplace_back(name, value);
+}
+
+GeometryCache::Entry* GeometryCache::Find(const NativeBindingObject* target) {
+  if (entries_epoch_ != CurrentEpoch())
+    return nullptr;
+  auto it = entries_.find(target);
+  return it != entries_.end() ? &it->second : nullptr;
+}
+
+GeometryCache::Entry& GeometryCache::Ensure(const NativeBindingObject* target) {
+  uint64_t epoch = CurrentEpoch();
+  if (entries_epoch_ != epoch) {
+    entries_.clear();
+    entries_epoch_ = epoch;
+  }
+  return entries_[target];
+}
+
+uint64_t GeometryCache::CurrentEpoch() const {
+  return context_->uiCommandBuffer()->layoutEpoch();
+}
+
+}  // namespace webf
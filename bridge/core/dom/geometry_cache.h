@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef WEBF_CORE_DOM_GEOMETRY_CACHE_H_
+#define WEBF_CORE_DOM_GEOMETRY_CACHE_H_
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
+#include "core/dom/legacy/bounding_client_rect.h"
+#include "foundation/macros.h"
+#include "foundation/native_value.h"
+
+namespace webf {
+
+class ExecutingContext;
+struct NativeBindingObject;
+
+// Keeps the geometry dart reported for elements, so reading it again before anything changed is served without
+// flushing the UI commands and blocking on dart.
+// Everything cached belongs to the current layout epoch of the UI command buffer, see
+// SharedUICommand::layoutEpoch().
+class GeometryCache {
+ public:
+  explicit GeometryCache(ExecutingContext* context) : context_(context) {}
+  WEBF_DISALLOW_COPY_ASSIGN_AND_MOVE(GeometryCache);
+
+  const BoundingClientRectData* GetBoundingClientRect(const NativeBindingObject* target);
+  void SetBoundingClientRect(const NativeBindingObject* target, const BoundingClientRectData& rect);
+
+  // Only numeric values are kept.
+  bool GetProperty(const NativeBindingObject* target, const AtomicString& name, NativeValue& value);
+  void SetProperty(const NativeBindingObject* target, const AtomicString& name, const NativeValue& value);
+
+ private:
+  struct Entry {
+    bool has_rect{false};
+    BoundingClientRectData rect;
+    std::vector<std::pair<AtomicString, NativeValue>> properties;
+  };
+
+  Entry* Find(const NativeBindingObject* target);
+  Entry& Ensure(const NativeBindingObject* target);
+  uint64_t CurrentEpoch() const;
+
+  ExecutingContext* context_;
+  std::unordered_map<const NativeBindingObject*, Entry> entries_;
+  // The layout epoch |entries_| were recorded in.
+  uint64_t entries_epoch_{0};
+};
+
+}  // namespace webf
+
+#endif  // WEBF_CORE_DOM_GEOMETRY_CACHE_H_
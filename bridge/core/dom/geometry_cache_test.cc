@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "geometry_cache.h"
+#include "bindings/qjs/native_string_utils.h"
+#include "core/dom/document.h"
+#include "core/html/html_body_element.h"
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+TEST(GeometryCache, rectIsDroppedOnceLayoutMayChange) {
+  auto env = TEST_init();
+  auto* context = env->page()->executingContext();
+  GeometryCache* cache = context->geometryCache();
+  NativeBindingObject* body = context->document()->body()->bindingObject();
+
+  cache->SetBoundingClientRect(body, BoundingClientRectData{1, 2, 3, 4, 2, 4, 6, 1});
+  const BoundingClientRectData* rect = cache->GetBoundingClientRect(body);
+  ASSERT_NE(rect, nullptr);
+  EXPECT_EQ(rect->width, 3);
+  EXPECT_EQ(rect->bottom, 6);
+
+  const char* code = "document.body.style.width = '100px';";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(cache->GetBoundingClientRect(body), nullptr);
+}
+
+TEST(GeometryCache, keepsNumericPropertiesOnly) {
+  auto env = TEST_init();
+  auto* context = env->page()->executingContext();
+  GeometryCache* cache = context->geometryCache();
+  NativeBindingObject* body = context->document()->body()->bindingObject();
+  AtomicString offset_width = AtomicString(context->ctx(), "offsetWidth");
+  AtomicString class_name = AtomicString(context->ctx(), "className");
+
+  cache->SetProperty(body, offset_width, Native_NewFloat64(20));
+  cache->SetProperty(body, class_name, Native_NewNull());
+
+  NativeValue value;
+  EXPECT_TRUE(cache->GetProperty(body, offset_width, value));
+  EXPECT_EQ(value.u.float64, 20);
+  EXPECT_FALSE(cache->GetProperty(body, class_name, value));
+
+  context->uiCommandBuffer()->BumpLayoutEpoch();
+  EXPECT_FALSE(cache->GetProperty(body, offset_width, value));
+}
+
+TEST(GeometryCache, rectIsDroppedWhenDartCallsBack) {
+  auto env = TEST_init();
+  auto* context = env->page()->executingContext();
+  NativeBindingObject* body = context->document()->body()->bindingObject();
+
+  // Nothing is mutated between the two tasks, only dart runs in between.
+  const char* code = R"(
+__webf_add_module_listener__('Geometry', () => document.body.getBoundingClientRect() === null ? 'measured' : 'cached');
+)";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+
+  // Measured by the previous task, dart may lay out, resize or scroll the page before calling back.
+  context->geometryCache()->SetBoundingClientRect(body, BoundingClientRectData{1, 2, 3, 4, 2, 4, 6, 1});
+
+  NativeValue extra = Native_NewNull();
+  NativeValue* result =
+      env->page()->invokeModuleEvent(stringToNativeString("Geometry").release(), "geometry", nullptr, &extra);
+  ASSERT_NE(result, nullptr);
+  EXPECT_EQ(nativeStringToStdString(static_cast<SharedNativeString*>(result->u.ptr)), "measured");
+}
@@ -32,7 +32,10 @@ class BoundingClientRect : public BindingObject {
   using ImplType = BoundingClientRect*;
   BoundingClientRect() = delete;
   static BoundingClientRect* Create(ExecutingContext* context, NativeBindingObject* native_binding_object);
+  // Creates a rect from the geometry cached on the bridge, which is not backed by any dart object.
+  static BoundingClientRect* Create(ExecutingContext* context, const BoundingClientRectData& data);
   explicit BoundingClientRect(ExecutingContext* context, NativeBindingObject* native_binding_object);
+  explicit BoundingClientRect(ExecutingContext* context, const BoundingClientRectData& data);
 
   NativeValue HandleCallFromDartSide(const AtomicString& method,
                                      int32_t argc,
@@ -48,8 +51,11 @@ class BoundingClientRect : public BindingObject {
   double bottom() const { return extra_->bottom; }
   double left() const { return extra_->left; }
 
+  const BoundingClientRectData& data() const { return *extra_; }
+
  private:
   BoundingClientRectData* extra_ = nullptr;
+  BoundingClientRectData data_{};
 };
 
 }  // namespace webf
@@ -92,6 +92,13 @@ bool ElementAttributes::hasAttribute(const AtomicString& name, ExceptionState& e
   return has_attribute;
 }
 
+const AtomicString* ElementAttributes::FindAttribute(const AtomicString& name) const {
+  auto it = attributes_.find(name);
+  if (it == attributes_.end())
+    return nullptr;
+  return &it->second;
+}
+
 void ElementAttributes::removeAttribute(const AtomicString& name, ExceptionState& exception_state) {
   if (!hasAttribute(name, exception_state))
     return;
@@ -99,7 +106,8 @@ void ElementAttributes::removeAttribute(const AtomicString& name, ExceptionState
   AtomicString old_value = getAttribute(name, exception_state);
   element_->WillModifyAttribute(name, old_value, AtomicString::Null());
 
-  attributes_.erase(name);
+  if (attributes_.erase(name) > 0)
+    element_->DidRemoveAttribute(name, old_value);
 
   std::unique_ptr<SharedNativeString> args_01 = name.ToNativeString(ctx());
   GetExecutingContext()->uiCommandBuffer()->AddCommand(UICommand::kRemoveAttribute, std::move(args_01),
@@ -30,6 +30,8 @@ class ElementAttributes : public ScriptWrappable {
   AtomicString getAttribute(const AtomicString& name, ExceptionState& exception_state);
   bool setAttribute(const AtomicString& name, const AtomicString& value, ExceptionState& exception_state);
   bool hasAttribute(const AtomicString& name, ExceptionState& exception_state);
+  // Returns nullptr if the attribute is not set. Unlike getAttribute(), never falls back to dart.
+  const AtomicString* FindAttribute(const AtomicString& name) const;
   void removeAttribute(const AtomicString& name, ExceptionState& exception_state);
   void CopyWith(ElementAttributes* attributes);
   std::string ToString();
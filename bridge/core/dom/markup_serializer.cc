@@ -0,0 +1,277 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "markup_serializer.h"
+#include <cstring>
+#include "core/css/inline_css_style_declaration.h"
+#include "core/dom/comment.h"
+#include "core/dom/document_fragment.h"
+#include "core/dom/element.h"
+#include "core/dom/legacy/element_attributes.h"
+#include "core/dom/node_traversal.h"
+#include "core/dom/text.h"
+#include "core/html/html_template_element.h"
+#include "html_element_type_helper.h"
+#include "html_names.h"
+
+namespace webf {
+
+namespace {
+
+// Larger buffers are released after use instead of being kept for the next serialization.
+constexpr size_t kMaxRetainedCapacity = 1 << 20;
+
+// https://html.spec.whatwg.org/multipage/syntax.html#void-elements
+const char* const kVoidElements[] = {"area", "base",  "br",   "col",   "embed", "hr",  "img",
+                                     "input", "link", "meta", "param", "source", "track", "wbr"};
+
+// Elements whose text children are serialized without escaping.
+const char* const kRawTextElements[] = {"iframe", "noembed", "noframes", "noscript",
+                                        "plaintext", "script", "style", "xmp"};
+
+template <size_t N>
+bool LocalNameIsOneOf(const Element& element, const char* const (&names)[N]) {
+  StringView local_name = element.localName().ToStringView();
+  if (!local_name.Is8Bit())
+    return false;
+  for (const char* name : names) {
+    if (strlen(name) == local_name.length() && memcmp(name, local_name.Characters8(), local_name.length()) == 0)
+      return true;
+  }
+  return false;
+}
+
+bool IsVoidElement(const Element& element) {
+  return LocalNameIsOneOf(element, kVoidElements);
+}
+
+// The children of a template element are the children of its content.
+const Node* FirstChildForSerialization(const Element& element) {
+  if (auto* template_element = DynamicTo<HTMLTemplateElement>(element)) {
+    return NodeTraversal::FirstChild(*template_element->content());
+  }
+  return NodeTraversal::FirstChild(element);
+}
+
+void AppendUTF8(std::string& buffer, uint32_t c) {
+  if (c < 0x80) {
+    buffer.push_back(static_cast<char>(c));
+  } else if (c < 0x800) {
+    buffer.push_back(static_cast<char>(0xc0 | (c >> 6)));
+    buffer.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+  } else if (c < 0x10000) {
+    buffer.push_back(static_cast<char>(0xe0 | (c >> 12)));
+    buffer.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3f)));
+    buffer.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+  } else {
+    buffer.push_back(static_cast<char>(0xf0 | (c >> 18)));
+    buffer.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3f)));
+    buffer.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3f)));
+    buffer.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+  }
+}
+
+// Returns the entity of |c|, or nullptr if it is written as is.
+// https://html.spec.whatwg.org/multipage/parsing.html#escapingString
+template <bool kAttribute>
+const char* EntityFor(uint32_t c) {
+  switch (c) {
+    case '&':
+      return "&amp;";
+    case 0xa0:
+      return "&nbsp;";
+    case '"':
+      return kAttribute ? "&quot;" : nullptr;
+    case '<':
+      return kAttribute ? nullptr : "&lt;";
+    case '>':
+      return kAttribute ? nullptr : "&gt;";
+    default:
+      return nullptr;
+  }
+}
+
+template <bool kAttribute>
+void AppendEscaped8(std::string& buffer, const uint8_t* characters, unsigned length, bool escape) {
+  unsigned run_start = 0;
+  for (unsigned i = 0; i < length; i++) {
+    uint8_t c = characters[i];
+    if (c < 0x80 && (!escape || EntityFor<kAttribute>(c) == nullptr))
+      continue;
+    buffer.append(reinterpret_cast<const char*>(characters + run_start), i - run_start);
+    run_start = i + 1;
+    const char* entity = escape ? EntityFor<kAttribute>(c) : nullptr;
+    if (entity != nullptr) {
+      buffer.append(entity);
+    } else {
+      AppendUTF8(buffer, c);
+    }
+  }
+  buffer.append(reinterpret_cast<const char*>(characters + run_start), length - run_start);
+}
+
+template <bool kAttribute>
+void AppendEscaped16(std::string& buffer, const char16_t* characters, unsigned length, bool escape) {
+  for (unsigned i = 0; i < length; i++) {
+    uint32_t c = characters[i];
+    const char* entity = escape ? EntityFor<kAttribute>(c) : nullptr;
+    if (entity != nullptr) {
+      buffer.append(entity);
+      continue;
+    }
+    if (c >= 0xd800 && c <= 0xdfff) {
+      if (c <= 0xdbff && i + 1 < length && characters[i + 1] >= 0xdc00 && characters[i + 1] <= 0xdfff) {
+        c = 0x10000 + ((c - 0xd800) << 10) + (characters[i + 1] - 0xdc00);
+        i++;
+      } else {
+        // Unpaired surrogates can not be encoded in UTF-8.
+        c = 0xfffd;
+      }
+    }
+    AppendUTF8(buffer, c);
+  }
+}
+
+// |value| is already UTF-8, only its ASCII characters are escaped.
+void AppendEscapedUTF8Attribute(std::string& buffer, const std::string& value) {
+  for (char c : value) {
+    const char* entity = c == '&' || c == '"' ? EntityFor<true>(c) : nullptr;
+    if (entity != nullptr) {
+      buffer.append(entity);
+    } else {
+      buffer.push_back(c);
+    }
+  }
+}
+
+}  // namespace
+
+MarkupSerializer& MarkupSerializer::ForCurrentThread() {
+  thread_local static MarkupSerializer serializer;
+  return serializer;
+}
+
+const std::string& MarkupSerializer::SerializeElement(const Element& element) {
+  Reset();
+  AppendStartTag(element);
+  if (!IsVoidElement(element)) {
+    AppendChildren(element);
+    AppendEndTag(element);
+  }
+  return buffer_;
+}
+
+const std::string& MarkupSerializer::SerializeChildren(const Element& element) {
+  Reset();
+  if (!IsVoidElement(element)) {
+    AppendChildren(element);
+  }
+  return buffer_;
+}
+
+void MarkupSerializer::Reset() {
+  if (buffer_.capacity() > kMaxRetainedCapacity) {
+    std::string().swap(buffer_);
+  } else {
+    buffer_.clear();
+  }
+  open_elements_.clear();
+}
+
+// Walks the descendants of |root| in tree order. |open_elements_| holds the elements whose end tag is pending, as the
+// children of a template element are not reachable from the parent pointers of its content.
+void MarkupSerializer::AppendChildren(const Element& root) {
+  const Element* parent = &root;
+  const Node* node = FirstChildForSerialization(root);
+
+  while (node != nullptr) {
+    if (auto* element = DynamicTo<Element>(node)) {
+      AppendStartTag(*element);
+      if (!IsVoidElement(*element)) {
+        if (const Node* first_child = FirstChildForSerialization(*element)) {
+          open_elements_.push_back(parent);
+          parent = element;
+          node = first_child;
+          continue;
+        }
+        AppendEndTag(*element);
+      }
+    } else if (auto* text = DynamicTo<Text>(node)) {
+      AppendString(text->data().ToStringView(),
+                   LocalNameIsOneOf(*parent, kRawTextElements) ? EscapeMode::kNone : EscapeMode::kText);
+    } else if (auto* comment = DynamicTo<Comment>(node)) {
+      buffer_.append("<!--");
+      AppendString(comment->data().ToStringView(), EscapeMode::kNone);
+      buffer_.append("-->");
+    }
+
+    // Close the elements whose last child was written.
+    while (NodeTraversal::NextSibling(*node) == nullptr && parent != &root) {
+      AppendEndTag(*parent);
+      node = parent;
+      parent = open_elements_.back();
+      open_elements_.pop_back();
+    }
+    node = NodeTraversal::NextSibling(*node);
+  }
+}
+
+void MarkupSerializer::AppendStartTag(const Element& element) {
+  buffer_.push_back('<');
+  AppendString(element.localName().ToStringView(), EscapeMode::kNone);
+
+  // The inline style is written from the style declaration, which is newer than the style attribute.
+  if (element.attributes_ != nullptr) {
+    for (auto it = element.attributes_->begin(); it != element.attributes_->end(); ++it) {
+      auto& attribute = *it;
+      if (element.cssom_wrapper_ != nullptr && attribute.first == html_names::kStyleAttr)
+        continue;
+      AppendAttribute(attribute.first, attribute.second);
+    }
+  }
+  if (element.cssom_wrapper_ != nullptr) {
+    std::string style = element.cssom_wrapper_->ToString();
+    if (!style.empty()) {
+      buffer_.append(" style=\"");
+      AppendEscapedUTF8Attribute(buffer_, style);
+      buffer_.push_back('"');
+    }
+  }
+
+  buffer_.push_back('>');
+}
+
+void MarkupSerializer::AppendEndTag(const Element& element) {
+  buffer_.append("</");
+  AppendString(element.localName().ToStringView(), EscapeMode::kNone);
+  buffer_.push_back('>');
+}
+
+void MarkupSerializer::AppendAttribute(const AtomicString& name, const AtomicString& value) {
+  buffer_.push_back(' ');
+  AppendString(name.ToStringView(), EscapeMode::kNone);
+  buffer_.append("=\"");
+  AppendString(value.ToStringView(), EscapeMode::kAttribute);
+  buffer_.push_back('"');
+}
+
+void MarkupSerializer::AppendString(const StringView& view, EscapeMode mode) {
+  bool escape = mode != EscapeMode::kNone;
+  if (view.Is8Bit()) {
+    auto* characters = reinterpret_cast<const uint8_t*>(view.Characters8());
+    if (mode == EscapeMode::kAttribute) {
+      AppendEscaped8<true>(buffer_, characters, view.length(), escape);
+    } else {
+      AppendEscaped8<false>(buffer_, characters, view.length(), escape);
+    }
+  } else {
+    if (mode == EscapeMode::kAttribute) {
+      AppendEscaped16<true>(buffer_, view.Characters16(), view.length(), escape);
+    } else {
+      AppendEscaped16<false>(buffer_, view.Characters16(), view.length(), escape);
+    }
+  }
+}
+
+}  // namespace webf
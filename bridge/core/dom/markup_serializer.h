@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef WEBF_CORE_DOM_MARKUP_SERIALIZER_H_
+#define WEBF_CORE_DOM_MARKUP_SERIALIZER_H_
+
+#include <string>
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
+#include "foundation/macros.h"
+
+namespace webf {
+
+class Element;
+class Node;
+
+// Serializes the element tree of the bridge to HTML markup for innerHTML and outerHTML.
+//
+// The tree is walked without recursion and the UTF-8 markup of every node is written into a single buffer, which
+// keeps its capacity for the next serialization on the same thread.
+class MarkupSerializer {
+ public:
+  MarkupSerializer() = default;
+  WEBF_DISALLOW_COPY_ASSIGN_AND_MOVE(MarkupSerializer);
+
+  static MarkupSerializer& ForCurrentThread();
+
+  // The returned markup is only valid until the next serialization.
+  const std::string& SerializeElement(const Element& element);
+  const std::string& SerializeChildren(const Element& element);
+
+ private:
+  enum class EscapeMode { kNone, kText, kAttribute };
+
+  void Reset();
+  void AppendChildren(const Element& element);
+  void AppendStartTag(const Element& element);
+  void AppendEndTag(const Element& element);
+  void AppendAttribute(const AtomicString& name, const AtomicString& value);
+  void AppendString(const StringView& view, EscapeMode mode);
+
+  std::string buffer_;
+  std::vector<const Element*> open_elements_;
+};
+
+}  // namespace webf
+
+#endif  // WEBF_CORE_DOM_MARKUP_SERIALIZER_H_
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "markup_serializer.h"
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+namespace {
+
+std::string SerializeScript(const char* code) {
+  static std::string last_message;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    last_message = message;
+  };
+  bool static errorCalled = false;
+  errorCalled = false;
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  last_message.clear();
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  return last_message;
+}
+
+}  // namespace
+
+TEST(MarkupSerializer, escapesTextAndAttributes) {
+  std::string markup = SerializeScript(
+      "const div = document.createElement('div');"
+      "div.setAttribute('title', 'a&\"<b>\\u00a0');"
+      "div.appendChild(document.createTextNode('1 < 2 && \"3\" > 2\\u00a0\\u00e9\\u{1F600}'));"
+      "div.appendChild(document.createComment(' <raw> '));"
+      "console.log(div.outerHTML);");
+  EXPECT_EQ(markup,
+            "<div title=\"a&amp;&quot;<b>&nbsp;\">1 &lt; 2 &amp;&amp; \"3\" &gt; 2&nbsp;\xC3\xA9\xF0\x9F\x98\x80"
+            "<!-- <raw> --></div>");
+}
+
+TEST(MarkupSerializer, voidAndRawTextElements) {
+  std::string markup = SerializeScript(
+      "const div = document.createElement('div');"
+      "const img = document.createElement('img');"
+      "img.setAttribute('src', 'a.png');"
+      "div.appendChild(img);"
+      "div.appendChild(document.createElement('br'));"
+      "const script = document.createElement('script');"
+      "script.appendChild(document.createTextNode('if (a < b && c) {}'));"
+      "div.appendChild(script);"
+      "console.log(div.innerHTML + '|' + img.outerHTML + '|' + script.innerHTML);");
+  EXPECT_EQ(markup,
+            "<img src=\"a.png\"><br><script>if (a < b && c) {}</script>|<img src=\"a.png\">|if (a < b && c) {}");
+}
+
+TEST(MarkupSerializer, templateContentAndDeepTrees) {
+  std::string markup = SerializeScript(
+      "const template = document.createElement('template');"
+      "template.innerHTML = '<p>a</p><p>b</p>';"
+      "const root = document.createElement('section');"
+      "let parent = root;"
+      "for (let i = 0; i < 5000; i++) {"
+      "  const child = document.createElement('div');"
+      "  parent.appendChild(child);"
+      "  parent = child;"
+      "}"
+      "parent.appendChild(template);"
+      "const html = root.outerHTML;"
+      "console.log(template.outerHTML + '|' + html.length + '|' + html.indexOf('<template><p>a</p><p>b</p></template>')"
+      " + '|' + html.endsWith('</template></div></section>'));");
+  // Each div writes 11 characters.
+  EXPECT_EQ(markup, "<template><p>a</p><p>b</p></template>|" + std::to_string(19 + 5000 * 11 + 37) + "|" +
+                        std::to_string(9 + 5000 * 5) + "|true");
+}
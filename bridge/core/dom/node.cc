@@ -314,7 +314,7 @@ static Node* NodeOrStringToNode(const std::shared_ptr<QJSUnionDomStringNode>& no
       case QJSUnionDomStringNode::ContentType::kNode:
         return node_or_string->GetAsNode();
       case QJSUnionDomStringNode::ContentType::kDomString:
-        return Text::Create(document, node_or_string->GetAsDomString());
+        return Text::Create(document, String(document.ctx(), node_or_string->GetAsDomString()));
     }
     assert(false);
     return nullptr;
@@ -325,8 +325,8 @@ static Node* NodeOrStringToNode(const std::shared_ptr<QJSUnionDomStringNode>& no
   if (node_or_string->IsNode() && !node_or_string->GetAsNode()->IsTextNode())
     return node_or_string->GetAsNode();
 
-  AtomicString string_value =
-      node_or_string->IsDomString() ? node_or_string->GetAsDomString() : node_or_string->GetAsNode()->textContent();
+  String string_value = node_or_string->IsDomString() ? String(document.ctx(), node_or_string->GetAsDomString())
+                                                      : node_or_string->GetAsNode()->textContent();
 
   return Text::Create(document, string_value);
 }
@@ -482,7 +482,45 @@ bool Node::isEqualNode(Node* other) const {
   return isEqualNode(other, exception_state);
 }
 
-AtomicString Node::textContent(bool convert_brs_to_newlines) const {
+// Concatenates the data of |texts| into one flat string, which keeps the 8-bit storage when all of them are 8-bit.
+static String ConcatenateTextData(JSContext* ctx, const std::vector<const Text*>& texts) {
+  size_t length = 0;
+  bool is_8bit = true;
+  for (const Text* text : texts) {
+    length += text->length();
+    is_8bit = is_8bit && text->data().ToStringView().Is8Bit();
+  }
+
+  JSValue value;
+  if (is_8bit) {
+    std::string content;
+    content.reserve(length);
+    for (const Text* text : texts) {
+      StringView view = text->data().ToStringView();
+      content.append(view.Characters8(), view.length());
+    }
+    value = JS_NewRawUTF8String(ctx, reinterpret_cast<const uint8_t*>(content.data()), content.size());
+  } else {
+    std::vector<uint16_t> content;
+    content.reserve(length);
+    for (const Text* text : texts) {
+      StringView view = text->data().ToStringView();
+      if (view.Is8Bit()) {
+        auto* characters = reinterpret_cast<const uint8_t*>(view.Characters8());
+        content.insert(content.end(), characters, characters + view.length());
+      } else {
+        content.insert(content.end(), view.Characters16(), view.Characters16() + view.length());
+      }
+    }
+    value = JS_NewUnicodeString(ctx, content.data(), content.size());
+  }
+
+  String result(ctx, value);
+  JS_FreeValue(ctx, value);
+  return result;
+}
+
+String Node::textContent(bool convert_brs_to_newlines) const {
   // This covers ProcessingInstruction and Comment that should return their
   // value when .textContent is accessed on them, but should be ignored when
   // iterated over as a descendant of a ContainerNode.
@@ -496,23 +534,28 @@ AtomicString Node::textContent(bool convert_brs_to_newlines) const {
   // Documents and non-container nodes (that are not CharacterData)
   // have null textContent.
   if (IsDocumentNode() || !IsContainerNode())
-    return AtomicString::Null();
+    return String::Null();
 
-  std::string content;
+  std::vector<const Text*> texts;
   for (const Node& node : NodeTraversal::InclusiveDescendantsOf(*this)) {
     if (auto* text_node = DynamicTo<Text>(node)) {
-      content.append(text_node->data().ToStdString(ctx()));
+      texts.push_back(text_node);
     }
   }
-  return AtomicString(ctx(), content);
+  // The string of a single text node is shared instead of copied.
+  if (texts.size() == 1)
+    return texts[0]->data();
+  return ConcatenateTextData(ctx(), texts);
 }
 
-void Node::setTextContent(const AtomicString& text, ExceptionState& exception_state) {
+void Node::setTextContent(const String& text, ExceptionState& exception_state) {
   switch (nodeType()) {
     case kAttributeNode:
+      setNodeValue(text.ToAtomicString(ctx()), exception_state);
+      return;
     case kTextNode:
     case kCommentNode:
-      setNodeValue(text, exception_state);
+      To<CharacterData>(this)->setData(text.IsNull() ? String(ctx(), AtomicString::Empty()) : text, exception_state);
       return;
     case kElementNode:
     case kDocumentFragmentNode: {
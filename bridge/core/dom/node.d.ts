@@ -63,7 +63,7 @@ interface Node extends EventTarget {
    * Returns the previous sibling.
    */
   readonly previousSibling: Node | null;
-  textContent: string | null;
+  textContent: NonAtomicString | null;
   appendChild(newNode: Node): Node;
   /**
    * Returns a copy of node. If deep is true, the copy also includes the node's descendants.
@@ -9,6 +9,7 @@
 #include <set>
 #include <utility>
 
+#include "bindings/qjs/dom_string.h"
 #include "events/event_target.h"
 #include "foundation/macros.h"
 #include "mutation_observer.h"
@@ -120,8 +121,8 @@ class Node : public EventTarget {
   bool isEqualNode(Node*) const;
   bool isSameNode(const Node* other, ExceptionState& exception_state) const { return this == other; }
 
-  [[nodiscard]] AtomicString textContent(bool convert_brs_to_newlines = false) const;
-  virtual void setTextContent(const AtomicString&, ExceptionState& exception_state);
+  [[nodiscard]] String textContent(bool convert_brs_to_newlines = false) const;
+  virtual void setTextContent(const String&, ExceptionState& exception_state);
 
   // Other methods (not part of DOM)
   [[nodiscard]] FORCE_INLINE bool IsTextNode() const { return GetDOMNodeType() == DOMNodeType::kText; }
@@ -158,6 +158,29 @@ TEST(Node, textContent) {
   EXPECT_EQ(logCalled, true);
 }
 
+TEST(Node, textContentOfMixedWidthTexts) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    EXPECT_STREQ(message.c_str(), "caf\xC3\xA9 \xF0\x9F\x98\x80! 8 true");
+    logCalled = true;
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) { errorCalled = true; });
+  auto context = env->page()->executingContext();
+  const char* code =
+      "let div = document.createElement('div');"
+      "let span = document.createElement('span');"
+      "div.appendChild(document.createTextNode('caf\\u00e9 '));"
+      "span.appendChild(document.createTextNode('\\u{1F600}'));"
+      "div.appendChild(span);"
+      "div.appendChild(document.createTextNode('!'));"
+      "console.log(div.textContent, div.textContent.length, span.textContent === span.firstChild.data)";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
 TEST(Node, setTextContent) {
   bool static errorCalled = false;
   bool static logCalled = false;
@@ -31,6 +31,8 @@ static void handleRAFTransientCallback(void* ptr, double contextId, double highR
   context->dartIsolateContext()->profiler()->StartTrackAsyncEvaluation();
   context->dartIsolateContext()->profiler()->StartTrackSteps("handleRAFTransientCallback");
 
+  context->uiCommandBuffer()->BumpLayoutEpoch();
+
   assert(frame_callback->status() == FrameCallback::FrameStatus::kPending);
 
   frame_callback->SetStatus(FrameCallback::FrameStatus::kExecuting);
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "selector_query.h"
+#include "core/css/css_selector_parser.h"
+#include "core/css/selector_checker.h"
+#include "core/dom/container_node.h"
+#include "core/dom/element.h"
+#include "core/dom/element_traversal.h"
+#include "core/dom/space_split_string.h"
+#include "element_namespace_uris.h"
+#include "html_names.h"
+
+namespace webf {
+
+template <typename MatchFunc>
+static Element* FirstMatchingDescendant(ContainerNode& root, MatchFunc match) {
+  for (Element* element = ElementTraversal::FirstWithin(root); element;
+       element = ElementTraversal::Next(*element, &root)) {
+    if (match(*element))
+      return element;
+  }
+  return nullptr;
+}
+
+template <typename MatchFunc>
+static std::vector<Element*> AllMatchingDescendants(ContainerNode& root, MatchFunc match) {
+  std::vector<Element*> result;
+  for (Element* element = ElementTraversal::FirstWithin(root); element;
+       element = ElementTraversal::Next(*element, &root)) {
+    if (match(*element))
+      result.emplace_back(element);
+  }
+  return result;
+}
+
+static bool IsInScope(const ContainerNode& root, const Element& element) {
+  return &root == &root.GetTreeScope().RootNode() || element.IsDescendantOf(&root);
+}
+
+SelectorQuery::SelectorQuery(std::shared_ptr<CSSSelectorList> selector_list)
+    : selector_list_(std::move(selector_list)) {
+  if (selector_list_->Selectors().size() != 1)
+    return;
+  for (const CSSSelector& selector : selector_list_->Selectors()[0]) {
+    if (selector.Match() == CSSSelector::kId) {
+      subject_id_ = selector.Value();
+      break;
+    }
+    if (selector.Relation() != CSSSelector::kSubSelector)
+      break;
+  }
+}
+
+bool SelectorQuery::Matches(const Element& element) const {
+  return SelectorChecker::Match(*selector_list_, element);
+}
+
+Element* SelectorQuery::Closest(Element& element) const {
+  for (Element* current = &element; current; current = current->parentElement()) {
+    if (Matches(*current))
+      return current;
+  }
+  return nullptr;
+}
+
+bool SelectorQuery::QueryById(ContainerNode& root, Element*& result) const {
+  if (subject_id_.IsNull() || !root.isConnected())
+    return false;
+  TreeScope& scope = root.GetTreeScope();
+  if (scope.ContainsMultipleElementsWithId(subject_id_))
+    return false;
+
+  Element* element = scope.getElementById(subject_id_);
+  result = element && IsInScope(root, *element) && Matches(*element) ? element : nullptr;
+  return true;
+}
+
+Element* SelectorQuery::QueryFirst(ContainerNode& root) const {
+  Element* element;
+  if (QueryById(root, element))
+    return element;
+  return FirstMatchingDescendant(root, [this](const Element& element) { return Matches(element); });
+}
+
+std::vector<Element*> SelectorQuery::QueryAll(ContainerNode& root) const {
+  Element* element;
+  if (QueryById(root, element))
+    return element ? std::vector<Element*>{element} : std::vector<Element*>();
+  return AllMatchingDescendants(root, [this](const Element& element) { return Matches(element); });
+}
+
+Element* SelectorQuery::ElementById(ContainerNode& root, const AtomicString& id) {
+  if (id.IsNull() || id.IsEmpty())
+    return nullptr;
+
+  if (root.isConnected()) {
+    TreeScope& scope = root.GetTreeScope();
+    if (&root == &scope.RootNode())
+      return scope.getElementById(id);
+    if (!scope.HasElementWithId(id))
+      return nullptr;
+    if (!scope.ContainsMultipleElementsWithId(id)) {
+      Element* element = scope.getElementById(id);
+      return IsInScope(root, *element) ? element : nullptr;
+    }
+  }
+
+  return FirstMatchingDescendant(root, [&id](const Element& element) {
+    const AtomicString* value = element.FindAttribute(html_names::kIdAttr);
+    return value != nullptr && *value == id;
+  });
+}
+
+std::vector<Element*> SelectorQuery::ElementsByClassName(ContainerNode& root, const AtomicString& class_names) {
+  SpaceSplitString names(root.ctx(), class_names);
+  if (names.size() == 0)
+    return {};
+
+  if (root.isConnected()) {
+    TreeScope& scope = root.GetTreeScope();
+    for (size_t i = 0; i < names.size(); i++) {
+      if (!scope.HasElementWithClassToken(names[i]))
+        return {};
+    }
+
+    std::vector<Element*> result;
+    for (Element* element : scope.ElementsByClassToken(names[0])) {
+      if (!IsInScope(root, *element))
+        continue;
+      const AtomicString* value = element->FindAttribute(html_names::kClassAttr);
+      bool matched = true;
+      for (size_t i = 1; i < names.size() && matched; i++) {
+        matched = SelectorChecker::ContainsToken(*value, names[i]);
+      }
+      if (matched)
+        result.emplace_back(element);
+    }
+    return result;
+  }
+
+  return AllMatchingDescendants(root, [&names](const Element& element) {
+    const AtomicString* value = element.FindAttribute(html_names::kClassAttr);
+    if (value == nullptr)
+      return false;
+    for (size_t i = 0; i < names.size(); i++) {
+      if (!SelectorChecker::ContainsToken(*value, names[i]))
+        return false;
+    }
+    return true;
+  });
+}
+
+std::vector<Element*> SelectorQuery::ElementsByTagName(ContainerNode& root, const AtomicString& tag_name) {
+  if (tag_name == html_names::kStar) {
+    return AllMatchingDescendants(root, [](const Element&) { return true; });
+  }
+
+  // https://dom.spec.whatwg.org/#concept-getelementsbytagname
+  AtomicString lowercased = tag_name.ToLowerIfNecessary(root.ctx());
+  return AllMatchingDescendants(root, [&tag_name, &lowercased](const Element& element) {
+    if (element.namespaceURI() == element_namespace_uris::khtml)
+      return element.localName() == lowercased;
+    return element.localName() == tag_name;
+  });
+}
+
+std::vector<Element*> SelectorQuery::ElementsByName(ContainerNode& root, const AtomicString& name) {
+  return AllMatchingDescendants(root, [&name](const Element& element) {
+    const AtomicString* value = element.FindAttribute(html_names::kNameAttr);
+    return value != nullptr && *value == name;
+  });
+}
+
+SelectorQuery* SelectorQueryCache::Add(JSContext* ctx, const AtomicString& selectors) {
+  auto it = entries_.find(selectors);
+  if (it != entries_.end()) {
+    lru_.splice(lru_.end(), lru_, it->second);
+    return it->second->query.get();
+  }
+
+  std::shared_ptr<CSSSelectorList> selector_list = CSSSelectorParser::ParseSelector(ctx, selectors.ToStdString(ctx));
+  std::unique_ptr<SelectorQuery> query =
+      selector_list != nullptr ? std::make_unique<SelectorQuery>(std::move(selector_list)) : nullptr;
+
+  if (entries_.size() >= kMaximumSelectorQueryCacheSize) {
+    entries_.erase(lru_.front().selectors);
+    lru_.pop_front();
+  }
+
+  SelectorQuery* result = query.get();
+  entries_[selectors] = lru_.insert(lru_.end(), Entry{selectors, std::move(query)});
+  return result;
+}
+
+}  // namespace webf
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef WEBF_CORE_DOM_SELECTOR_QUERY_H_
+#define WEBF_CORE_DOM_SELECTOR_QUERY_H_
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "core/css/css_selector.h"
+#include "foundation/macros.h"
+
+namespace webf {
+
+class ContainerNode;
+class Element;
+
+// Runs querySelector(), querySelectorAll(), matches() and closest() over the element tree of the bridge, so these
+// calls no longer need to flush UI commands and wait for dart.
+class SelectorQuery {
+ public:
+  explicit SelectorQuery(std::shared_ptr<CSSSelectorList> selector_list);
+  WEBF_DISALLOW_COPY_ASSIGN_AND_MOVE(SelectorQuery);
+
+  bool Matches(const Element& element) const;
+  Element* Closest(Element& element) const;
+  Element* QueryFirst(ContainerNode& root) const;
+  std::vector<Element*> QueryAll(ContainerNode& root) const;
+
+  // getElementById(), getElementsByClassName(), getElementsByTagName() and getElementsByName(). Connected roots are
+  // answered from the id and class indexes of their tree scope.
+  static Element* ElementById(ContainerNode& root, const AtomicString& id);
+  static std::vector<Element*> ElementsByClassName(ContainerNode& root, const AtomicString& class_names);
+  static std::vector<Element*> ElementsByTagName(ContainerNode& root, const AtomicString& tag_name);
+  static std::vector<Element*> ElementsByName(ContainerNode& root, const AtomicString& name);
+
+ private:
+  // Returns the element for the id of the rightmost compound selector, or false if the tree has to be walked.
+  bool QueryById(ContainerNode& root, Element*& result) const;
+
+  std::shared_ptr<CSSSelectorList> selector_list_;
+  // Set when the selector list is a single complex selector whose subject carries an id.
+  AtomicString subject_id_ = AtomicString::Null();
+};
+
+// Parsed selectors of a document, keyed by the selector text.
+class SelectorQueryCache {
+ public:
+  SelectorQueryCache() = default;
+  WEBF_DISALLOW_COPY_ASSIGN_AND_MOVE(SelectorQueryCache);
+
+  // Returns nullptr if |selectors| can not be matched natively, callers should fall back to dart. The result of the
+  // parse is cached in both cases.
+  SelectorQuery* Add(JSContext* ctx, const AtomicString& selectors);
+
+ private:
+  static constexpr size_t kMaximumSelectorQueryCacheSize = 256;
+
+  struct Entry {
+    AtomicString selectors;
+    std::unique_ptr<SelectorQuery> query;
+  };
+
+  // Least recently used first.
+  std::list<Entry> lru_;
+  std::unordered_map<AtomicString, std::list<Entry>::iterator, AtomicString::KeyHasher> entries_;
+};
+
+}  // namespace webf
+
+#endif  // WEBF_CORE_DOM_SELECTOR_QUERY_H_
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "core/css/css_selector_parser.h"
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+static const char* kSelectorQueryFixture =
+    "document.body.innerHTML = '<div id=\"a\" class=\"x y\"><p class=\"y\">1</p><p>2</p>"
+    "<span lang=\"en-US\" data-k=\"abc\"></span><p class=\"z\">3</p></div><section></section>';"
+    "function ids(list) { return Array.from(list).map(e => e.textContent || e.tagName.toLowerCase()).join(','); }";
+
+TEST(SelectorQuery, querySelectorAll) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "1,2,3|1,3|1|2,3|span|span|span|2,3|1,3|2,3|1|section");
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  env->page()->evaluateScript(kSelectorQueryFixture, strlen(kSelectorQueryFixture), "vm://", 0);
+  const char* code =
+      "console.log(["
+      "ids(document.querySelectorAll('div > p')),"
+      "ids(document.querySelectorAll('#a p[class]')),"
+      "ids(document.querySelectorAll('.x .y')),"
+      "ids(document.querySelectorAll('p:not(.y, :first-child)')),"
+      "ids(document.querySelectorAll('[lang|=en]')),"
+      "ids(document.querySelectorAll('span[data-k^=a][data-k$=\"c\"][data-k*=b]')),"
+      "ids(document.querySelectorAll('P + SPAN')),"
+      "ids(document.querySelectorAll('p:nth-child(n+2)')),"
+      "ids(document.querySelectorAll('p:nth-of-type(odd)')),"
+      "ids(document.querySelectorAll('span ~ p, p:nth-child(2)')),"
+      "document.querySelector('p.y').textContent,"
+      "ids(document.querySelectorAll('div ~ section:empty'))"
+      "].join('|'));";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(SelectorQuery, matchesAndClosest) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "true,false,a,true");
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  env->page()->evaluateScript(kSelectorQueryFixture, strlen(kSelectorQueryFixture), "vm://", 0);
+  const char* code =
+      "let span = document.querySelector('span');"
+      "span.setAttribute('class', 'late');"
+      "console.log([span.matches('div > .late'), span.matches(':first-child'), span.closest('.x').id,"
+      "document.getElementById('a').matches(':root > body > div')].join(','));";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(SelectorQuery, getElementsBy) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "123,1|1,2,3|span|a");
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  env->page()->evaluateScript(kSelectorQueryFixture, strlen(kSelectorQueryFixture), "vm://", 0);
+  const char* code =
+      "console.log([ids(document.getElementsByClassName(' y ')),"
+      "ids(document.getElementById('a').getElementsByTagName('P')),"
+      "ids(document.getElementsByTagName('span')),"
+      "document.getElementById('a').id].join('|'));";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(SelectorQuery, nthWhitespace) {
+  auto env = TEST_init();
+  JSContext* ctx = env->page()->executingContext()->ctx();
+  EXPECT_NE(CSSSelectorParser::ParseSelector(ctx, "p:nth-child( 2n + 1 )"), nullptr);
+  EXPECT_NE(CSSSelectorParser::ParseSelector(ctx, "p:nth-child(-n- 3)"), nullptr);
+  // Only the sign of b may be surrounded by whitespace.
+  EXPECT_EQ(CSSSelectorParser::ParseSelector(ctx, "p:nth-child(2 n)"), nullptr);
+  EXPECT_EQ(CSSSelectorParser::ParseSelector(ctx, "p:nth-child(- n+1)"), nullptr);
+  EXPECT_EQ(CSSSelectorParser::ParseSelector(ctx, "p:nth-child(2n 1)"), nullptr);
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "subtree_stream.h"
+#include <cstring>
+#include "core/dom/node.h"
+#include "core/executing_context.h"
+
+namespace webf {
+
+SubtreeStream::SubtreeStream(ExecutingContext* context) : context_(context) {}
+
+SubtreeStream::~SubtreeStream() {
+  // Release the strings of a stream which was never committed.
+  for (auto& value : nodes_) {
+    if (value.tag == NativeTag::TAG_STRING) {
+      std::unique_ptr<AutoFreeNativeString> string(static_cast<AutoFreeNativeString*>(value.u.ptr));
+    }
+  }
+}
+
+void SubtreeStream::AddElement(Node* node, Node* parent, NodeKind kind, const AtomicString& tag_name) {
+  AddNode(node, parent, kind, NameIndex(tag_name));
+}
+
+void SubtreeStream::AddAttribute(const AtomicString& name, const AtomicString& value) {
+  assert(!nodes_.empty());
+  nodes_.emplace_back(Native_NewInt64(NameIndex(name)));
+  nodes_.emplace_back(Native_NewString(value.ToNativeString(context_->ctx()).release()));
+  nodes_[last_header_].uint32 += 2;
+}
+
+void SubtreeStream::AddText(Node* node, Node* parent, const String& data) {
+  AddNode(node, parent, kText, 0);
+  nodes_.emplace_back(Native_NewString(data.ToNativeString(context_->ctx()).release()));
+  nodes_[last_header_].uint32 = 1;
+}
+
+void SubtreeStream::AddNode(Node* node, Node* parent, NodeKind kind, int64_t name_index) {
+  NativeValue header = Native_NewInt64(name_index << 2 | kind);
+  header.uint32 = 0;
+
+  nodes_.emplace_back(Native_NewPtr(JSPointerType::NativeBindingObject, node->bindingObject()));
+  nodes_.emplace_back(Native_NewPtr(JSPointerType::NativeBindingObject, parent->bindingObject()));
+  last_header_ = nodes_.size();
+  nodes_.emplace_back(header);
+}
+
+int64_t SubtreeStream::NameIndex(const AtomicString& name) {
+  auto it = name_indexes_.find(name);
+  if (it != name_indexes_.end()) {
+    return it->second;
+  }
+
+  auto index = static_cast<int64_t>(names_.size());
+  names_.emplace_back(name);
+  name_indexes_[name] = index;
+  return index;
+}
+
+bool SubtreeStream::Commit(Node* root) {
+  if (nodes_.empty())
+    return false;
+
+  auto* stream = new NativeSubtreeStream();
+  stream->length = static_cast<int64_t>(nodes_.size());
+  stream->nodes = static_cast<NativeValue*>(dart_malloc(sizeof(NativeValue) * nodes_.size()));
+  memcpy(stream->nodes, nodes_.data(), sizeof(NativeValue) * nodes_.size());
+
+  stream->names_length = static_cast<int64_t>(names_.size());
+  stream->names = static_cast<NativeValue*>(dart_malloc(sizeof(NativeValue) * names_.size()));
+  for (size_t i = 0; i < names_.size(); i++) {
+    stream->names[i] = Native_NewString(names_[i].ToNativeString(context_->ctx()).release());
+  }
+
+  // The ownership of the strings is transferred to dart.
+  nodes_.clear();
+  names_.clear();
+  name_indexes_.clear();
+
+  context_->uiCommandBuffer()->AddCommand(UICommand::kInsertSubtree, nullptr, root->bindingObject(), stream);
+  return true;
+}
+
+}  // namespace webf
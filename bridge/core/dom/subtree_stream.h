@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_DOM_SUBTREE_STREAM_H_
+#define BRIDGE_CORE_DOM_SUBTREE_STREAM_H_
+
+#include <unordered_map>
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
+#include "bindings/qjs/dom_string.h"
+#include "foundation/macros.h"
+#include "foundation/native_value.h"
+
+namespace webf {
+
+class ExecutingContext;
+class Node;
+
+// The nodes of a subtree, read by dart with the UICommand::kInsertSubtree command.
+struct NativeSubtreeStream : public DartReadable {
+  NativeValue* nodes;
+  int64_t length;
+  NativeValue* names;
+  int64_t names_length;
+};
+
+// Describes a subtree built natively to dart in one command, instead of one command for each node creation,
+// insertion, attribute and style property.
+//
+// Nodes are added in tree order, each entry in |nodes_| is laid out as:
+//   [node: TAG_POINTER] [parent: TAG_POINTER] [header: TAG_INT] [argv...]
+// header.u is (name_index << 2 | NodeKind) where name_index refers to |names_|, and header.uint32 is argc.
+// The argv of elements are pairs of [attribute name index: TAG_INT] [value: TAG_STRING], the argv of a text node is
+// its data. Dart creates each node, sets its attributes and appends it to its parent, which always came first.
+class SubtreeStream {
+ public:
+  enum NodeKind : int64_t {
+    kElement = 0,
+    kSVGElement = 1,
+    kText = 2,
+  };
+
+  explicit SubtreeStream(ExecutingContext* context);
+  ~SubtreeStream();
+  WEBF_DISALLOW_COPY_ASSIGN_AND_MOVE(SubtreeStream);
+
+  void AddElement(Node* node, Node* parent, NodeKind kind, const AtomicString& tag_name);
+  // Adds an attribute to the element added last.
+  void AddAttribute(const AtomicString& name, const AtomicString& value);
+  void AddText(Node* node, Node* parent, const String& data);
+
+  FORCE_INLINE bool empty() const { return nodes_.empty(); }
+
+  // Sends the subtree to dart as a single command targeting |root|. Returns false if there is nothing to commit.
+  bool Commit(Node* root);
+
+ private:
+  int64_t NameIndex(const AtomicString& name);
+  void AddNode(Node* node, Node* parent, NodeKind kind, int64_t name_index);
+
+  ExecutingContext* context_;
+  std::vector<NativeValue> nodes_;
+  std::vector<AtomicString> names_;
+  std::unordered_map<AtomicString, int64_t, AtomicString::KeyHasher> name_indexes_;
+  // Position of the header of the node added last.
+  size_t last_header_{0};
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_DOM_SUBTREE_STREAM_H_
@@ -8,15 +8,16 @@
 
 namespace webf {
 
-Text* Text::Create(Document& document, const AtomicString& value) {
+Text* Text::Create(Document& document, const String& value) {
   return MakeGarbageCollected<Text>(document, value, ConstructionType::kCreateText);
 }
 
 Text* Text::Create(ExecutingContext* context, ExceptionState& exception_state) {
-  return MakeGarbageCollected<Text>(*context->document(), AtomicString::Empty(), ConstructionType::kCreateText);
+  return MakeGarbageCollected<Text>(*context->document(), String(context->ctx(), AtomicString::Empty()),
+                                    ConstructionType::kCreateText);
 }
 
-Text* Text::Create(ExecutingContext* context, const AtomicString& value, ExceptionState& executing_context) {
+Text* Text::Create(ExecutingContext* context, const String& value, ExceptionState& executing_context) {
   return MakeGarbageCollected<Text>(*context->document(), value, ConstructionType::kCreateText);
 }
 
@@ -1,5 +1,5 @@
 import {CharacterData} from "./character_data";
 
 interface Text extends CharacterData {
-  new(value?: string): Text;
+  new(value?: NonAtomicString): Text;
 }
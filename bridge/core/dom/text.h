@@ -17,11 +17,11 @@ class Text : public CharacterData {
  public:
   static const unsigned kDefaultLengthLimit = 1 << 16;
 
-  static Text* Create(Document&, const AtomicString&);
+  static Text* Create(Document&, const String&);
   static Text* Create(ExecutingContext* context, ExceptionState& executing_context);
-  static Text* Create(ExecutingContext* context, const AtomicString& value, ExceptionState& executing_context);
+  static Text* Create(ExecutingContext* context, const String& value, ExceptionState& executing_context);
 
-  Text(TreeScope& tree_scope, const AtomicString& data, ConstructionType type) : CharacterData(tree_scope, data, type) {
+  Text(TreeScope& tree_scope, const String& data, ConstructionType type) : CharacterData(tree_scope, data, type) {
     GetExecutingContext()->uiCommandBuffer()->AddCommand(
         UICommand::kCreateTextNode, std::move(data.ToNativeString(ctx())), bindingObject(), nullptr);
   }
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "tree_ordered_map.h"
+#include "core/dom/container_node.h"
+#include "core/dom/element.h"
+#include "core/dom/element_traversal.h"
+#include "core/dom/tree_scope.h"
+
+namespace webf {
+
+static const std::vector<Element*> kEmptyElementList;
+
+void TreeOrderedMap::Add(const AtomicString& key, Element& element) {
+  assert(!key.IsNull() && !key.IsEmpty());
+  MapEntry& entry = map_[key];
+  if (entry.elements.insert(&element).second)
+    entry.ordered_list.clear();
+}
+
+void TreeOrderedMap::Remove(const AtomicString& key, Element& element) {
+  auto it = map_.find(key);
+  if (it == map_.end())
+    return;
+
+  MapEntry& entry = it->second;
+  if (entry.elements.erase(&element) == 0)
+    return;
+  if (entry.elements.empty()) {
+    map_.erase(it);
+    return;
+  }
+  entry.ordered_list.clear();
+}
+
+bool TreeOrderedMap::ContainsMultiple(const AtomicString& key) const {
+  auto it = map_.find(key);
+  return it != map_.end() && it->second.elements.size() > 1;
+}
+
+Element* TreeOrderedMap::GetElementByKey(const AtomicString& key, const TreeScope& scope) const {
+  auto it = map_.find(key);
+  if (it == map_.end())
+    return nullptr;
+
+  MapEntry& entry = it->second;
+  if (entry.elements.size() == 1)
+    return *entry.elements.begin();
+  if (entry.ordered_list.empty())
+    ResolveTreeOrder(entry, scope);
+  return entry.ordered_list.empty() ? nullptr : entry.ordered_list.front();
+}
+
+const std::vector<Element*>& TreeOrderedMap::GetAllElementsByKey(const AtomicString& key,
+                                                                 const TreeScope& scope) const {
+  auto it = map_.find(key);
+  if (it == map_.end())
+    return kEmptyElementList;
+
+  MapEntry& entry = it->second;
+  if (entry.ordered_list.empty())
+    ResolveTreeOrder(entry, scope);
+  return entry.ordered_list;
+}
+
+void TreeOrderedMap::ResolveTreeOrder(MapEntry& entry, const TreeScope& scope) const {
+  entry.ordered_list.reserve(entry.elements.size());
+  if (entry.elements.size() == 1) {
+    entry.ordered_list.emplace_back(*entry.elements.begin());
+    return;
+  }
+
+  // Stop walking as soon as every element of the entry has been seen.
+  ContainerNode& root = scope.RootNode();
+  for (Element* element = ElementTraversal::FirstWithin(root);
+       element && entry.ordered_list.size() < entry.elements.size();
+       element = ElementTraversal::Next(*element, &root)) {
+    if (entry.elements.count(element))
+      entry.ordered_list.emplace_back(element);
+  }
+  assert(entry.ordered_list.size() == entry.elements.size());
+}
+
+}  // namespace webf
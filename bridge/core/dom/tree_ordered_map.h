@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef WEBF_CORE_DOM_TREE_ORDERED_MAP_H_
+#define WEBF_CORE_DOM_TREE_ORDERED_MAP_H_
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
+#include "foundation/macros.h"
+
+namespace webf {
+
+class Element;
+class TreeScope;
+
+// Maps a key (an id or a class token) to the connected elements of a tree scope which carry it. Elements are added
+// and removed in any order, the tree order is resolved lazily by walking the scope when the key has more than one
+// element, and kept until the key is touched again.
+class TreeOrderedMap {
+ public:
+  TreeOrderedMap() = default;
+  WEBF_DISALLOW_COPY_ASSIGN_AND_MOVE(TreeOrderedMap);
+
+  void Add(const AtomicString& key, Element& element);
+  void Remove(const AtomicString& key, Element& element);
+
+  bool Contains(const AtomicString& key) const { return map_.count(key) > 0; }
+  bool ContainsMultiple(const AtomicString& key) const;
+
+  // Returns the first element in tree order carrying |key|.
+  Element* GetElementByKey(const AtomicString& key, const TreeScope& scope) const;
+  // Returns all elements carrying |key| in tree order.
+  const std::vector<Element*>& GetAllElementsByKey(const AtomicString& key, const TreeScope& scope) const;
+
+ private:
+  struct MapEntry {
+    std::unordered_set<Element*> elements;
+    // Elements in tree order, empty until resolved.
+    std::vector<Element*> ordered_list;
+  };
+
+  void ResolveTreeOrder(MapEntry& entry, const TreeScope& scope) const;
+
+  mutable std::unordered_map<AtomicString, MapEntry, AtomicString::KeyHasher> map_;
+};
+
+}  // namespace webf
+
+#endif  // WEBF_CORE_DOM_TREE_ORDERED_MAP_H_
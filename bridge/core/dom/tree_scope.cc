@@ -12,4 +12,43 @@ TreeScope::TreeScope(Document& document) : root_node_(&document), document_(&doc
   root_node_->SetTreeScope(this);
 }
 
+Element* TreeScope::getElementById(const AtomicString& element_id) const {
+  if (element_id.IsNull() || element_id.IsEmpty())
+    return nullptr;
+  return elements_by_id_.GetElementByKey(element_id, *this);
+}
+
+bool TreeScope::HasElementWithId(const AtomicString& id) const {
+  assert(!id.IsNull());
+  return elements_by_id_.Contains(id);
+}
+
+bool TreeScope::ContainsMultipleElementsWithId(const AtomicString& id) const {
+  return elements_by_id_.ContainsMultiple(id);
+}
+
+void TreeScope::AddElementById(const AtomicString& element_id, Element& element) {
+  elements_by_id_.Add(element_id, element);
+}
+
+void TreeScope::RemoveElementById(const AtomicString& element_id, Element& element) {
+  elements_by_id_.Remove(element_id, element);
+}
+
+const std::vector<Element*>& TreeScope::ElementsByClassToken(const AtomicString& token) const {
+  return elements_by_class_token_.GetAllElementsByKey(token, *this);
+}
+
+bool TreeScope::HasElementWithClassToken(const AtomicString& token) const {
+  return elements_by_class_token_.Contains(token);
+}
+
+void TreeScope::AddElementByClassToken(const AtomicString& token, Element& element) {
+  elements_by_class_token_.Add(token, element);
+}
+
+void TreeScope::RemoveElementByClassToken(const AtomicString& token, Element& element) {
+  elements_by_class_token_.Remove(token, element);
+}
+
 }  // namespace webf
@@ -7,11 +7,15 @@
 #define BRIDGE_CORE_DOM_TREE_SCOPE_H_
 
 #include <cassert>
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
+#include "tree_ordered_map.h"
 
 namespace webf {
 
 class ContainerNode;
 class Document;
+class Element;
 
 // The root node of a document tree (in which case this is a Document) or of a
 // shadow tree (in which case this is a ShadowRoot). Various things, like
@@ -29,6 +33,21 @@ class TreeScope {
     return *document_;
   }
 
+  ContainerNode& RootNode() const { return *root_node_; }
+
+  // Connected elements are indexed by their id and class tokens, so that getElementById() and
+  // getElementsByClassName() can be answered without walking the whole tree.
+  Element* getElementById(const AtomicString&) const;
+  bool HasElementWithId(const AtomicString& id) const;
+  bool ContainsMultipleElementsWithId(const AtomicString& id) const;
+  void AddElementById(const AtomicString& element_id, Element&);
+  void RemoveElementById(const AtomicString& element_id, Element&);
+
+  const std::vector<Element*>& ElementsByClassToken(const AtomicString& token) const;
+  bool HasElementWithClassToken(const AtomicString& token) const;
+  void AddElementByClassToken(const AtomicString& token, Element&);
+  void RemoveElementByClassToken(const AtomicString& token, Element&);
+
  protected:
   explicit TreeScope(Document&);
 
@@ -36,6 +55,8 @@ class TreeScope {
   ContainerNode* root_node_;
   Document* document_;
   TreeScope* parent_tree_scope_;
+  TreeOrderedMap elements_by_id_;
+  TreeOrderedMap elements_by_class_token_;
 };
 
 }  // namespace webf
@@ -3,6 +3,7 @@
  */
 
 #include "pointer_event.h"
+#include "event_type_names.h"
 #include "qjs_pointer_event.h"
 
 namespace webf {
@@ -94,6 +95,27 @@ double PointerEvent::width() const {
   return width_;
 };
 
+std::vector<PointerEvent*> PointerEvent::getCoalescedEvents(ExceptionState& exception_state) {
+  std::vector<PointerEvent*> events;
+  if (type() != event_type_names::kpointermove)
+    return events;
+
+  events.reserve(coalesced_events_.size() + 1);
+  for (auto& event : coalesced_events_) {
+    events.emplace_back(event.Get());
+  }
+  events.emplace_back(this);
+  return events;
+}
+
+void PointerEvent::CoalesceEarlierEvent(PointerEvent* earlier) {
+  std::vector<Member<PointerEvent>> events = std::move(earlier->coalesced_events_);
+  earlier->coalesced_events_.clear();
+  events.emplace_back(earlier);
+  events.insert(events.end(), coalesced_events_.begin(), coalesced_events_.end());
+  coalesced_events_ = std::move(events);
+}
+
 bool PointerEvent::IsPointerEvent() const {
   return true;
 }
@@ -103,4 +125,11 @@ const PointerEventPublicMethods* PointerEvent::pointerEventPublicMethods() {
   return &pointer_event_public_methods;
 }
 
+void PointerEvent::Trace(GCVisitor* visitor) const {
+  for (auto& event : coalesced_events_) {
+    visitor->TraceMember(event);
+  }
+  MouseEvent::Trace(visitor);
+}
+
 }  // namespace webf
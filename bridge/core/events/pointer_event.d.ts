@@ -13,6 +13,7 @@ interface PointerEvent extends MouseEvent {
     readonly tiltY: number;
     readonly twist: number;
     readonly width: number;
+    getCoalescedEvents(): PointerEvent[];
     [key: string]: any;
     new(type: string, init?: PointerEventInit): PointerEvent;
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #ifndef WEBF_CORE_EVENTS_POINTER_EVENT_H_
 #define WEBF_CORE_EVENTS_POINTER_EVENT_H_
 
+#include <vector>
 #include "mouse_event.h"
 #include "plugin_api/pointer_event.h"
 #include "qjs_pointer_event_init.h"
@@ -46,10 +47,16 @@ class PointerEvent : public MouseEvent {
   double twist() const;
   double width() const;
 
+  // The pointermove events merged into this one, followed by this event, see EventCoalescer.
+  std::vector<PointerEvent*> getCoalescedEvents(ExceptionState& exception_state);
+  void CoalesceEarlierEvent(PointerEvent* earlier);
+
   bool IsPointerEvent() const override;
 
   const PointerEventPublicMethods* pointerEventPublicMethods();
 
+  void Trace(GCVisitor* visitor) const override;
+
  private:
   double height_;
   bool is_primary;
@@ -61,6 +68,7 @@ class PointerEvent : public MouseEvent {
   double tilt_y_;
   double twist_;
   double width_;
+  std::vector<Member<PointerEvent>> coalesced_events_;
 };
 
 template <>
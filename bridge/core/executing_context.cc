@@ -5,10 +5,12 @@
 #include "executing_context.h"
 
 #include <utility>
+#include "bindings/qjs/code_cache.h"
 #include "bindings/qjs/converter_impl.h"
 #include "bindings/qjs/script_promise_resolver.h"
 #include "built_in_string.h"
 #include "core/dom/document.h"
+#include "core/dom/events/event_coalescer.h"
 #include "core/dom/mutation_observer.h"
 #include "core/events/error_event.h"
 #include "core/events/promise_rejection_event.h"
@@ -101,9 +103,7 @@ ExecutingContext::ExecutingContext(DartIsolateContext* dart_isolate_context,
     EvaluateByteCode(p.second.bytes, p.second.length);
   }
 
-  for (auto& p : plugin_string_code) {
-    EvaluateJavaScript(p.second.c_str(), p.second.size(), p.first.c_str(), 0);
-  }
+  EvaluatePluginCodes();
 
   dart_isolate_context->profiler()->FinishTrackSteps();
 
@@ -129,6 +129,9 @@ ExecutingContext::~ExecutingContext() {
   for (auto& active_wrapper : active_wrappers_) {
     JS_FreeValue(ctx(), active_wrapper->ToQuickJSUnsafe());
   }
+
+  // Keeps the order of the scripts this page read from the code cache.
+  CodeCache::Shared()->Flush();
 }
 
 ExecutingContext* ExecutingContext::From(JSContext* ctx) {
@@ -147,19 +150,14 @@ bool ExecutingContext::EvaluateJavaScript(const char* code,
   dart_isolate_context_->profiler()->StartTrackSteps("ExecutingContext::EvaluateJavaScript");
 
   JSValue result;
-  if (parsed_bytecodes == nullptr) {
+  if (parsed_bytecodes == nullptr && !CodeCache::Shared()->enabled()) {
     dart_isolate_context_->profiler()->StartTrackSteps("JS_Eval");
 
     result = JS_Eval(script_state_.ctx(), code, code_len, sourceURL, JS_EVAL_TYPE_GLOBAL);
 
     dart_isolate_context_->profiler()->FinishTrackSteps();
   } else {
-    dart_isolate_context_->profiler()->StartTrackSteps("JS_Eval");
-
-    JSValue byte_object =
-        JS_Eval(script_state_.ctx(), code, code_len, sourceURL, JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
-
-    dart_isolate_context_->profiler()->FinishTrackSteps();
+    JSValue byte_object = CompileJavaScript(code, code_len, sourceURL);
 
     if (JS_IsException(byte_object)) {
       HandleException(&byte_object);
@@ -167,12 +165,14 @@ bool ExecutingContext::EvaluateJavaScript(const char* code,
       return false;
     }
 
-    dart_isolate_context_->profiler()->StartTrackSteps("JS_Eval");
-    size_t len;
-    *parsed_bytecodes = JS_WriteObject(script_state_.ctx(), &len, byte_object, JS_WRITE_OBJ_BYTECODE);
-    *bytecode_len = len;
+    if (parsed_bytecodes != nullptr) {
+      dart_isolate_context_->profiler()->StartTrackSteps("JS_WriteObject");
+      size_t len;
+      *parsed_bytecodes = JS_WriteObject(script_state_.ctx(), &len, byte_object, JS_WRITE_OBJ_BYTECODE);
+      *bytecode_len = len;
+      dart_isolate_context_->profiler()->FinishTrackSteps();
+    }
 
-    dart_isolate_context_->profiler()->FinishTrackSteps();
     dart_isolate_context_->profiler()->StartTrackSteps("JS_EvalFunction");
 
     result = JS_EvalFunction(script_state_.ctx(), byte_object);
@@ -189,6 +189,36 @@ bool ExecutingContext::EvaluateJavaScript(const char* code,
   return success;
 }
 
+JSValue ExecutingContext::CompileJavaScript(const char* code, size_t code_len, const char* sourceURL) {
+  CodeCache* code_cache = CodeCache::Shared();
+  std::vector<uint8_t> bytecode;
+  if (code_cache->Load(code, code_len, sourceURL, bytecode)) {
+    dart_isolate_context_->profiler()->StartTrackSteps("JS_ReadObject");
+    JSValue byte_object = JS_ReadObject(script_state_.ctx(), bytecode.data(), bytecode.size(), JS_READ_OBJ_BYTECODE);
+    dart_isolate_context_->profiler()->FinishTrackSteps();
+    if (!JS_IsException(byte_object))
+      return byte_object;
+    // Not readable by this engine, compiled again below and the entry is replaced.
+    JS_FreeValue(script_state_.ctx(), JS_GetException(script_state_.ctx()));
+  }
+
+  dart_isolate_context_->profiler()->StartTrackSteps("JS_Eval");
+  JSValue byte_object =
+      JS_Eval(script_state_.ctx(), code, code_len, sourceURL, JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+  dart_isolate_context_->profiler()->FinishTrackSteps();
+
+  if (code_cache->enabled() && !JS_IsException(byte_object)) {
+    size_t len;
+    uint8_t* bytes = JS_WriteObject(script_state_.ctx(), &len, byte_object, JS_WRITE_OBJ_BYTECODE);
+    if (bytes != nullptr) {
+      code_cache->Store(code, code_len, sourceURL, bytes, len);
+      js_free(script_state_.ctx(), bytes);
+    }
+  }
+
+  return byte_object;
+}
+
 bool ExecutingContext::EvaluateJavaScript(const char16_t* code, size_t length, const char* sourceURL, int startLine) {
   std::string utf8Code = toUTF8(std::u16string(reinterpret_cast<const char16_t*>(code), length));
   JSValue result = JS_Eval(script_state_.ctx(), utf8Code.c_str(), utf8Code.size(), sourceURL, JS_EVAL_TYPE_GLOBAL);
@@ -544,9 +574,12 @@ void ExecutingContext::FlushUICommand(const webf::BindingObject* self,
 bool ExecutingContext::SyncUICommandBuffer(const BindingObject* self,
                                            uint32_t reason,
                                            std::vector<NativeBindingObject*>& deps) {
+  // Dart must replay the recorded canvas calls before it answers any synchronous call.
+  bool canvas_display_list_committed = canvas_display_list_.Commit();
+
   if (!uiCommandBuffer()->empty()) {
     if (is_dedicated_) {
-      bool should_swap_ui_commands = false;
+      bool should_swap_ui_commands = canvas_display_list_committed;
       if (isUICommandReasonDependsOnElement(reason)) {
         bool element_mounted_on_dart = self->bindingObject()->invoke_bindings_methods_from_native != nullptr;
         bool is_deps_elements_mounted_on_dart = true;
@@ -627,6 +660,64 @@ void ExecutingContext::DispatchGlobalRejectionHandledEvent(ExecutingContext* con
 std::unordered_map<std::string, NativeByteCode> ExecutingContext::plugin_byte_code{};
 std::unordered_map<std::string, std::string> ExecutingContext::plugin_string_code{};
 
+static std::mutex plugin_code_mutex;
+static std::unordered_map<std::string, std::shared_ptr<std::vector<uint8_t>>> plugin_string_code_bytecodes;
+
+void ExecutingContext::RegisterPluginCode(const std::string& name, std::string code) {
+  std::lock_guard<std::mutex> lock(plugin_code_mutex);
+  plugin_string_code[name] = std::move(code);
+  plugin_string_code_bytecodes.erase(name);
+}
+
+void ExecutingContext::EvaluatePluginCodes() {
+  struct PluginCode {
+    std::string name;
+    // Copied only for the codes which aren't compiled yet.
+    std::string source;
+    std::shared_ptr<std::vector<uint8_t>> bytecode;
+  };
+  std::vector<PluginCode> codes;
+  {
+    std::lock_guard<std::mutex> lock(plugin_code_mutex);
+    codes.reserve(plugin_string_code.size());
+    for (auto& p : plugin_string_code) {
+      auto it = plugin_string_code_bytecodes.find(p.first);
+      if (it != plugin_string_code_bytecodes.end()) {
+        codes.emplace_back(PluginCode{p.first, std::string(), it->second});
+      } else {
+        codes.emplace_back(PluginCode{p.first, p.second, nullptr});
+      }
+    }
+  }
+
+  // Compiled without holding the lock, pages created meanwhile on other threads don't wait for it.
+  for (auto& code : codes) {
+    if (code.bytecode != nullptr)
+      continue;
+
+    uint64_t length;
+    uint8_t* bytes = DumpByteCode(code.source.c_str(), code.source.size(), code.name.c_str(), &length);
+    // Syntax errors were reported, the next page compiles it again.
+    if (bytes == nullptr)
+      continue;
+    code.bytecode = std::make_shared<std::vector<uint8_t>>(bytes, bytes + length);
+    js_free(ctx(), bytes);
+
+    std::lock_guard<std::mutex> lock(plugin_code_mutex);
+    // Another page may have compiled it first, or the plugin was registered again while it compiled.
+    auto it = plugin_string_code.find(code.name);
+    if (it != plugin_string_code.end() && it->second == code.source) {
+      plugin_string_code_bytecodes.emplace(code.name, code.bytecode);
+    }
+  }
+
+  for (auto& code : codes) {
+    if (code.bytecode != nullptr) {
+      EvaluateByteCode(code.bytecode->data(), code.bytecode->size());
+    }
+  }
+}
+
 void ExecutingContext::promiseRejectTracker(JSContext* ctx,
                                             JSValue promise,
                                             JSValue reason,
@@ -648,6 +739,13 @@ DOMTimerCoordinator* ExecutingContext::Timers() {
   return &timers_;
 }
 
+EventCoalescer* ExecutingContext::eventCoalescer() {
+  if (event_coalescer_ == nullptr) {
+    event_coalescer_ = std::make_unique<EventCoalescer>(this);
+  }
+  return event_coalescer_.get();
+}
+
 ModuleListenerContainer* ExecutingContext::ModuleListeners() {
   return &module_listener_container_;
 }
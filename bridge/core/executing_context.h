@@ -28,10 +28,12 @@
 
 #include "dart_isolate_context.h"
 #include "dart_methods.h"
+#include "dom/geometry_cache.h"
 #include "executing_context_data.h"
 #include "frame/dom_timer_coordinator.h"
 #include "frame/module_context_coordinator.h"
 #include "frame/module_listener_container.h"
+#include "html/canvas/canvas_display_list.h"
 #include "script_state.h"
 
 #include "shared_ui_command.h"
@@ -51,6 +53,7 @@ class MemberMutationScope;
 class ErrorEvent;
 class DartContext;
 class MutationObserver;
+class EventCoalescer;
 class BindingObject;
 struct NativeBindingObject;
 class ScriptWrappable;
@@ -135,6 +138,8 @@ class ExecutingContext {
   void SetMutationScope(MemberMutationScope& mutation_scope);
   bool HasMutationScope() const { return active_mutation_scope != nullptr; }
   MemberMutationScope* mutationScope() const { return active_mutation_scope; }
+  // The frees recorded by the active mutation scopes, see MemberMutationScope.
+  std::vector<ScriptWrappable*>& mutationRecords() { return mutation_records_; }
   void ClearMutationScope();
 
   FORCE_INLINE Document* document() const { return document_; };
@@ -142,6 +147,9 @@ class ExecutingContext {
   FORCE_INLINE DartIsolateContext* dartIsolateContext() const { return dart_isolate_context_; };
   FORCE_INLINE Performance* performance() const { return performance_; }
   FORCE_INLINE SharedUICommand* uiCommandBuffer() { return &ui_command_buffer_; };
+  FORCE_INLINE CanvasDisplayList* canvasDisplayList() { return &canvas_display_list_; };
+  FORCE_INLINE GeometryCache* geometryCache() { return &geometry_cache_; };
+  EventCoalescer* eventCoalescer();
   FORCE_INLINE DartMethodPointer* dartMethodPtr() const {
     assert(dart_isolate_context_->valid());
     return dart_isolate_context_->dartMethodPtr();
@@ -175,6 +183,8 @@ class ExecutingContext {
   static std::unordered_map<std::string, NativeByteCode> plugin_byte_code;
   // Raw string codes which registered by webf plugins.
   static std::unordered_map<std::string, std::string> plugin_string_code;
+  // The first page evaluating a plugin code compiles it, the bytecode is shared by the pages created later.
+  static void RegisterPluginCode(const std::string& name, std::string code);
 
  private:
   std::chrono::time_point<std::chrono::system_clock> time_origin_;
@@ -182,7 +192,10 @@ class ExecutingContext {
 
   void InstallDocument();
   void InstallPerformance();
+  void EvaluatePluginCodes();
   void InstallNativeLoader();
+  // Compiles |code| without running it, reading the bytecode from the CodeCache when it was compiled before.
+  JSValue CompileJavaScript(const char* code, size_t code_len, const char* sourceURL);
 
   void DrainPendingPromiseJobs();
 
@@ -197,6 +210,8 @@ class ExecutingContext {
   // Keep uiCommandBuffer below dartMethod ptr to make sure we can flush all disposeEventTarget when UICommandBuffer
   // release.
   SharedUICommand ui_command_buffer_{this};
+  // Pending canvas 2D calls, committed into ui_command_buffer_ as a single command.
+  CanvasDisplayList canvas_display_list_{this};
   DartIsolateContext* dart_isolate_context_{nullptr};
   // Keep uiCommandBuffer above ScriptState to make sure we can collect all disposedEventTarget command when free
   // JSContext. When call JSFreeContext(ctx) inside ScriptState, all eventTargets will be finalized and UICommandBuffer
@@ -218,12 +233,15 @@ class ExecutingContext {
   NativeLoader* native_loader_{nullptr};
   Performance* performance_{nullptr};
   DOMTimerCoordinator timers_;
+  GeometryCache geometry_cache_{this};
+  std::unique_ptr<EventCoalescer> event_coalescer_;
   ModuleListenerContainer module_listener_container_;
   ModuleContextCoordinator module_contexts_;
   ExecutionContextData context_data_{this};
   bool in_dispatch_error_event_{false};
   RejectedPromises rejected_promises_;
   MemberMutationScope* active_mutation_scope{nullptr};
+  std::vector<ScriptWrappable*> mutation_records_;
   std::unordered_set<ScriptWrappable*> active_wrappers_;
   WebFValueStatus* executing_context_status_{new WebFValueStatus()};
   bool is_dedicated_;
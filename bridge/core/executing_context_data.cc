@@ -25,6 +25,16 @@ JSValue ExecutionContextData::prototypeForType(const WrapperTypeInfo* type) {
   return it != prototype_map_.end() ? it->second : JS_NULL;
 }
 
+JSValue ExecutionContextData::widgetElementPrototypeForTag(const AtomicString& tag_name) {
+  auto it = widget_element_prototype_map_.find(tag_name);
+  return it != widget_element_prototype_map_.end() ? it->second : JS_NULL;
+}
+
+void ExecutionContextData::SetWidgetElementPrototypeForTag(const AtomicString& tag_name, JSValue prototype) {
+  assert(widget_element_prototype_map_.count(tag_name) == 0);
+  widget_element_prototype_map_[tag_name] = prototype;
+}
+
 JSValue ExecutionContextData::constructorForIdSlowCase(const WrapperTypeInfo* type) {
   JSContext* ctx = m_context->ctx();
 
@@ -84,6 +94,10 @@ void ExecutionContextData::Dispose() {
   for (auto& entry : constructor_map_) {
     JS_FreeValueRT(m_context->dartIsolateContext()->runtime(), entry.second);
   }
+
+  for (auto& entry : widget_element_prototype_map_) {
+    JS_FreeValueRT(m_context->dartIsolateContext()->runtime(), entry.second);
+  }
 }
 
 }  // namespace webf
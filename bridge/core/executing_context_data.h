@@ -7,6 +7,7 @@
 
 #include <quickjs/quickjs.h>
 #include <unordered_map>
+#include "bindings/qjs/atomic_string.h"
 #include "bindings/qjs/wrapper_type_info.h"
 
 namespace webf {
@@ -25,6 +26,10 @@ class ExecutionContextData final {
   JSValue constructorForType(const WrapperTypeInfo* type);
   // Returns the prototype object that is appropriately initialized.
   JSValue prototypeForType(const WrapperTypeInfo* type);
+  // Returns the prototype of the WidgetElements with this tag name, or JS_NULL if it was not created yet.
+  JSValue widgetElementPrototypeForTag(const AtomicString& tag_name);
+  // Takes the ownership of |prototype|.
+  void SetWidgetElementPrototypeForTag(const AtomicString& tag_name, JSValue prototype);
 
   void Dispose();
 
@@ -32,6 +37,7 @@ class ExecutionContextData final {
   JSValue constructorForIdSlowCase(const WrapperTypeInfo* type);
   std::unordered_map<const WrapperTypeInfo*, JSValue> constructor_map_;
   std::unordered_map<const WrapperTypeInfo*, JSValue> prototype_map_;
+  std::unordered_map<AtomicString, JSValue, AtomicString::KeyHasher> widget_element_prototype_map_;
 
   ExecutingContext* m_context;
 };
@@ -4,6 +4,7 @@
  */
 #include "window_or_worker_global_scope.h"
 #include "core/frame/dom_timer.h"
+#include "multiple_threading/dispatcher.h"
 
 namespace webf {
 
@@ -24,6 +25,8 @@ static void handleTimerCallback(DOMTimer* timer, char* errmsg) {
   context->dartIsolateContext()->profiler()->StartTrackAsyncEvaluation();
   context->dartIsolateContext()->profiler()->StartTrackSteps("handleTimerCallback");
 
+  context->uiCommandBuffer()->BumpLayoutEpoch();
+
   // Trigger timer callbacks.
   timer->Fire();
 
@@ -104,6 +107,54 @@ static void handlePersistentCallbackWrapper(void* ptr, double contextId, char* e
                                                         webf::handlePersistentCallback, ptr, contextId, errmsg);
 }
 
+// In dedicated thread mode, timers are kept by the looper of the JS thread and fired there directly. Dart is only
+// involved to pause and resume them along with the page.
+// The looper is given the timer id, the timer is looked up and held while its callback runs since the callback may
+// clear it.
+static void handleNativeTimeoutCallback(ExecutingContext* context, double contextId, int32_t timer_id) {
+  if (!isContextValid(contextId))
+    return;
+
+  std::shared_ptr<DOMTimer> timer = context->Timers()->getTimerById(timer_id);
+  if (timer == nullptr)
+    return;
+
+  handleTransientCallback(timer.get(), contextId, nullptr);
+}
+
+static void handleNativeIntervalCallback(ExecutingContext* context,
+                                         double contextId,
+                                         int32_t timer_id,
+                                         int32_t timeout) {
+  if (!isContextValid(contextId))
+    return;
+
+  std::shared_ptr<DOMTimer> timer = context->Timers()->getTimerById(timer_id);
+  if (timer == nullptr)
+    return;
+
+  handlePersistentCallback(timer.get(), contextId, nullptr);
+
+  if (!isContextValid(contextId) || timer->status() != DOMTimer::TimerStatus::kFinished)
+    return;
+
+  context->dartIsolateContext()->dispatcher()->looper(context->contextId())->PostDelayedMessage(
+      timer_id, timeout, handleNativeIntervalCallback, context, contextId, timer_id, timeout);
+}
+
+static int32_t scheduleNativeTimer(ExecutingContext* context, DOMTimer* timer, int32_t timeout) {
+  int32_t timer_id = context->dartMethodPtr()->NewTimerId();
+  auto& looper = context->dartIsolateContext()->dispatcher()->looper(context->contextId());
+  if (timer->kind() == DOMTimer::TimerKind::kOnce) {
+    looper->PostDelayedMessage(timer_id, timeout, handleNativeTimeoutCallback, context, context->contextId(),
+                               timer_id);
+  } else {
+    looper->PostDelayedMessage(timer_id, timeout, handleNativeIntervalCallback, context, context->contextId(),
+                               timer_id, timeout);
+  }
+  return timer_id;
+}
+
 int WindowOrWorkerGlobalScope::setTimeout(ExecutingContext* context,
                                           const std::shared_ptr<Function>& handler,
                                           ExceptionState& exception) {
@@ -121,8 +172,11 @@ int WindowOrWorkerGlobalScope::setTimeout(ExecutingContext* context,
 
   // Create a timer object to keep track timer callback.
   auto timer = DOMTimer::create(context, handler, DOMTimer::TimerKind::kOnce);
-  auto timer_id = context->dartMethodPtr()->setTimeout(context->isDedicated(), timer.get(), context->contextId(),
-                                                       handleTransientCallbackWrapper, timeout);
+  auto timer_id = context->isDedicated()
+                      ? scheduleNativeTimer(context, timer.get(), timeout)
+                      : context->dartMethodPtr()->setTimeout(context->isDedicated(), timer.get(),
+                                                             context->contextId(), handleTransientCallbackWrapper,
+                                                             timeout);
 
   // Register timerId.
   timer->setTimerId(timer_id);
@@ -150,8 +204,11 @@ int WindowOrWorkerGlobalScope::setInterval(ExecutingContext* context,
   // Create a timer object to keep track timer callback.
   auto timer = DOMTimer::create(context, handler, DOMTimer::TimerKind::kMultiple);
 
-  int32_t timerId = context->dartMethodPtr()->setInterval(context->isDedicated(), timer.get(), context->contextId(),
-                                                          handlePersistentCallbackWrapper, timeout);
+  int32_t timerId = context->isDedicated()
+                        ? scheduleNativeTimer(context, timer.get(), timeout)
+                        : context->dartMethodPtr()->setInterval(context->isDedicated(), timer.get(),
+                                                                context->contextId(), handlePersistentCallbackWrapper,
+                                                                timeout);
 
   // Register timerId.
   timer->setTimerId(timerId);
@@ -160,14 +217,21 @@ int WindowOrWorkerGlobalScope::setInterval(ExecutingContext* context,
   return timerId;
 }
 
+static void clearTimer(ExecutingContext* context, int32_t timer_id) {
+  if (context->isDedicated()) {
+    context->dartIsolateContext()->dispatcher()->looper(context->contextId())->CancelDelayedMessage(timer_id);
+  } else {
+    context->dartMethodPtr()->clearTimeout(context->isDedicated(), context->contextId(), timer_id);
+  }
+  context->Timers()->forceStopTimeoutById(timer_id);
+}
+
 void WindowOrWorkerGlobalScope::clearTimeout(ExecutingContext* context, int32_t timerId, ExceptionState& exception) {
-  context->dartMethodPtr()->clearTimeout(context->isDedicated(), context->contextId(), timerId);
-  context->Timers()->forceStopTimeoutById(timerId);
+  clearTimer(context, timerId);
 }
 
 void WindowOrWorkerGlobalScope::clearInterval(ExecutingContext* context, int32_t timerId, ExceptionState& exception) {
-  context->dartMethodPtr()->clearTimeout(context->isDedicated(), context->contextId(), timerId);
-  context->Timers()->forceStopTimeoutById(timerId);
+  clearTimer(context, timerId);
 }
 
 void WindowOrWorkerGlobalScope::__gc__(ExecutingContext* context, ExceptionState& exception) {
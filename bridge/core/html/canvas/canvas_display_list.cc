@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "canvas_display_list.h"
+#include <cstring>
+#include "core/executing_context.h"
+
+namespace webf {
+
+// Release the memory of values which never reached dart.
+static void FreeUnconsumedNativeValue(NativeValue& value) {
+  if (value.tag == NativeTag::TAG_STRING) {
+    std::unique_ptr<AutoFreeNativeString> string(static_cast<AutoFreeNativeString*>(value.u.ptr));
+  } else if (value.tag == NativeTag::TAG_LIST) {
+    auto* list = static_cast<NativeValue*>(value.u.ptr);
+    for (uint32_t i = 0; i < value.uint32; i++) {
+      FreeUnconsumedNativeValue(list[i]);
+    }
+    delete[] list;
+  }
+}
+
+CanvasDisplayList::CanvasDisplayList(ExecutingContext* context) : context_(context) {}
+
+CanvasDisplayList::~CanvasDisplayList() {
+  // Entries which were not committed are never replayed, the context is going away.
+  Reset();
+}
+
+void CanvasDisplayList::RecordMethod(NativeBindingObject* target,
+                                     const AtomicString& method,
+                                     int32_t argc,
+                                     const NativeValue* argv) {
+  Record(target, OpKind::kInvokeMethod, method, argc, argv);
+}
+
+void CanvasDisplayList::RecordProperty(NativeBindingObject* target, const AtomicString& prop, NativeValue value) {
+  Record(target, OpKind::kSetProperty, prop, 1, &value);
+}
+
+void CanvasDisplayList::Record(NativeBindingObject* target,
+                               OpKind kind,
+                               const AtomicString& name,
+                               int32_t argc,
+                               const NativeValue* argv) {
+  NativeValue header = Native_NewInt64(NameIndex(name) << 1 | kind);
+  header.uint32 = static_cast<uint32_t>(argc);
+
+  commands_.reserve(commands_.size() + 2 + argc);
+  commands_.emplace_back(Native_NewPtr(JSPointerType::NativeBindingObject, target));
+  commands_.emplace_back(header);
+  commands_.insert(commands_.end(), argv, argv + argc);
+}
+
+int64_t CanvasDisplayList::NameIndex(const AtomicString& name) {
+  auto it = name_indexes_.find(name);
+  if (it != name_indexes_.end()) {
+    return it->second;
+  }
+
+  auto index = static_cast<int64_t>(names_.size());
+  names_.emplace_back(name);
+  name_indexes_[name] = index;
+  return index;
+}
+
+bool CanvasDisplayList::Commit() {
+  // Adding the commit command to the UI command buffer calls back into Commit().
+  if (commands_.empty() || committing_)
+    return false;
+
+  committing_ = true;
+
+  auto* display_list = new NativeCanvasDisplayList();
+  display_list->length = static_cast<int64_t>(commands_.size());
+  display_list->commands = static_cast<NativeValue*>(dart_malloc(sizeof(NativeValue) * commands_.size()));
+  memcpy(display_list->commands, commands_.data(), sizeof(NativeValue) * commands_.size());
+
+  display_list->names_length = static_cast<int64_t>(names_.size());
+  display_list->names = static_cast<NativeValue*>(dart_malloc(sizeof(NativeValue) * names_.size()));
+  for (size_t i = 0; i < names_.size(); i++) {
+    display_list->names[i] = Native_NewString(names_[i].ToNativeString(context_->ctx()).release());
+  }
+
+  // The ownership of argument values are transferred to dart.
+  commands_.clear();
+  names_.clear();
+  name_indexes_.clear();
+
+  context_->uiCommandBuffer()->AddCommand(UICommand::kCanvasDisplayList, nullptr, nullptr, display_list);
+  committing_ = false;
+  return true;
+}
+
+void CanvasDisplayList::Reset() {
+  for (auto& value : commands_) {
+    FreeUnconsumedNativeValue(value);
+  }
+  commands_.clear();
+  names_.clear();
+  name_indexes_.clear();
+}
+
+}  // namespace webf
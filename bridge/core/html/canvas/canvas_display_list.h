@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_CORE_HTML_CANVAS_CANVAS_DISPLAY_LIST_H_
+#define BRIDGE_CORE_HTML_CANVAS_CANVAS_DISPLAY_LIST_H_
+
+#include <unordered_map>
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
+#include "foundation/macros.h"
+#include "foundation/native_value.h"
+
+namespace webf {
+
+struct NativeBindingObject;
+
+// The committed display list, read by dart with the UICommand::kCanvasDisplayList command.
+struct NativeCanvasDisplayList : public DartReadable {
+  NativeValue* commands;
+  int64_t length;
+  NativeValue* names;
+  int64_t names_length;
+};
+
+// Records canvas 2D calls which have no return values, instead of sending each of them to dart synchronously.
+//
+// Each recorded entry in |commands_| is laid out as:
+//   [target: TAG_POINTER] [header: TAG_INT] [argv...]
+// header.u is (name_index << 1 | OpKind) where name_index refers to |names_|, and header.uint32 is argc.
+//
+// The list is shared by all canvases of one ExecutingContext, so the order of calls across canvases is kept. It is
+// committed to the UI command buffer as a single command when the current task finishes, before any other UI command
+// was added and before any synchronous call to dart.
+class CanvasDisplayList {
+ public:
+  enum OpKind : int64_t {
+    kInvokeMethod = 0,
+    kSetProperty = 1,
+  };
+
+  explicit CanvasDisplayList(ExecutingContext* context);
+  ~CanvasDisplayList();
+  WEBF_DISALLOW_COPY_ASSIGN_AND_MOVE(CanvasDisplayList);
+
+  void RecordMethod(NativeBindingObject* target, const AtomicString& method, int32_t argc, const NativeValue* argv);
+  void RecordProperty(NativeBindingObject* target, const AtomicString& prop, NativeValue value);
+
+  FORCE_INLINE bool empty() const { return commands_.empty(); }
+  FORCE_INLINE size_t size() const { return commands_.size(); }
+
+  // Move all recorded entries into the UI command buffer. Returns false if there is nothing to commit.
+  bool Commit();
+
+ private:
+  int64_t NameIndex(const AtomicString& name);
+  void Record(NativeBindingObject* target,
+              OpKind kind,
+              const AtomicString& name,
+              int32_t argc,
+              const NativeValue* argv);
+  void Reset();
+
+  ExecutingContext* context_;
+  std::vector<NativeValue> commands_;
+  std::vector<AtomicString> names_;
+  std::unordered_map<AtomicString, int64_t, AtomicString::KeyHasher> name_indexes_;
+  bool committing_{false};
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_HTML_CANVAS_CANVAS_DISPLAY_LIST_H_
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "canvas_display_list.h"
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+TEST(CanvasDisplayList, recordedCallsAreCommittedAsOneCommand) {
+  auto env = TEST_init();
+  auto* context = env->page()->executingContext();
+  auto* display_list = context->canvasDisplayList();
+  context->uiCommandBuffer()->clear();
+
+  // Never dereferenced by the bridge, dart resolves it at replay time.
+  auto* target = reinterpret_cast<NativeBindingObject*>(0x10);
+  AtomicString fill_rect = AtomicString(context->ctx(), "fillRect");
+  AtomicString line_width = AtomicString(context->ctx(), "lineWidth");
+
+  NativeValue rect[] = {Native_NewFloat64(0), Native_NewFloat64(0), Native_NewFloat64(10), Native_NewFloat64(10)};
+  display_list->RecordMethod(target, fill_rect, 4, rect);
+  display_list->RecordProperty(target, line_width, Native_NewFloat64(2));
+  display_list->RecordMethod(target, fill_rect, 4, rect);
+
+  EXPECT_EQ(display_list->size(), (2 + 4) + (2 + 1) + (2 + 4));
+  EXPECT_EQ(context->uiCommandBuffer()->size(), 0);
+
+  EXPECT_EQ(display_list->Commit(), true);
+  EXPECT_EQ(display_list->empty(), true);
+  EXPECT_EQ(display_list->Commit(), false);
+  EXPECT_EQ(context->uiCommandBuffer()->size(), 1);
+
+  auto* item = static_cast<UICommandItem*>(context->uiCommandBuffer()->data());
+  EXPECT_EQ(item->type, static_cast<int32_t>(UICommand::kCanvasDisplayList));
+
+  auto* committed = reinterpret_cast<NativeCanvasDisplayList*>(item->nativePtr2);
+  EXPECT_EQ(committed->length, 15);
+  // Method and property names are shared by all entries.
+  EXPECT_EQ(committed->names_length, 2);
+  EXPECT_EQ(committed->commands[0].u.ptr, target);
+  EXPECT_EQ(committed->commands[1].u.int64, 0 << 1 | CanvasDisplayList::kInvokeMethod);
+  EXPECT_EQ(committed->commands[1].uint32, 4);
+  EXPECT_EQ(committed->commands[7].u.int64, 1 << 1 | CanvasDisplayList::kSetProperty);
+  EXPECT_EQ(committed->commands[8].u.float64, 2);
+  EXPECT_EQ(committed->commands[10].u.int64, 0 << 1 | CanvasDisplayList::kInvokeMethod);
+
+  for (int i = 0; i < committed->names_length; i++) {
+    std::unique_ptr<AutoFreeNativeString> name(static_cast<AutoFreeNativeString*>(committed->names[i].u.ptr));
+  }
+  dart_free(committed->commands);
+  dart_free(committed->names);
+  delete committed;
+  context->uiCommandBuffer()->clear();
+}
+
+TEST(CanvasDisplayList, committedBeforeOtherUICommands) {
+  auto env = TEST_init();
+  auto* context = env->page()->executingContext();
+  context->uiCommandBuffer()->clear();
+
+  NativeValue argv[] = {Native_NewFloat64(1), Native_NewFloat64(1)};
+  context->canvasDisplayList()->RecordMethod(reinterpret_cast<NativeBindingObject*>(0x10),
+                                             AtomicString(context->ctx(), "moveTo"), 2, argv);
+  context->uiCommandBuffer()->AddCommand(UICommand::kClearStyle, nullptr, nullptr, nullptr);
+
+  EXPECT_EQ(context->canvasDisplayList()->empty(), true);
+  EXPECT_EQ(context->uiCommandBuffer()->size(), 2);
+  auto* items = static_cast<UICommandItem*>(context->uiCommandBuffer()->data());
+  EXPECT_EQ(items[0].type, static_cast<int32_t>(UICommand::kCanvasDisplayList));
+  EXPECT_EQ(items[1].type, static_cast<int32_t>(UICommand::kClearStyle));
+
+  auto* committed = reinterpret_cast<NativeCanvasDisplayList*>(items[0].nativePtr2);
+  std::unique_ptr<AutoFreeNativeString> name(static_cast<AutoFreeNativeString*>(committed->names[0].u.ptr));
+  dart_free(committed->commands);
+  dart_free(committed->names);
+  delete committed;
+  context->uiCommandBuffer()->clear();
+}
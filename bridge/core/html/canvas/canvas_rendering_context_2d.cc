@@ -113,7 +113,7 @@ void CanvasRenderingContext2D::setFillStyle(const std::shared_ptr<QJSUnionDomStr
   } else if (style->IsCanvasGradient()) {
     value = NativeValueConverter<NativeTypePointer<CanvasGradient>>::ToNativeValue(style->GetAsCanvasGradient());
   }
-  SetBindingProperty(binding_call_methods::kfillStyle, value, exception_state);
+  RecordBindingProperty(binding_call_methods::kfillStyle, value, exception_state);
 
   //  fill_style_ = style;
 }
@@ -132,7 +132,7 @@ void CanvasRenderingContext2D::setStrokeStyle(const std::shared_ptr<QJSUnionDomS
     value = NativeValueConverter<NativeTypePointer<CanvasGradient>>::ToNativeValue(style->GetAsCanvasGradient());
   }
 
-  SetBindingProperty(binding_call_methods::kstrokeStyle, value, exception_state);
+  RecordBindingProperty(binding_call_methods::kstrokeStyle, value, exception_state);
 
   stroke_style_ = style;
 }
@@ -157,13 +157,12 @@ void CanvasRenderingContext2D::roundRect(double x,
                              NativeValueConverter<NativeTypeDouble>::ToNativeValue(h),
                              NativeValueConverter<NativeTypeArray<NativeTypeDouble>>::ToNativeValue(radii_vector)};
 
-  InvokeBindingMethod(binding_call_methods::kroundRect, sizeof(arguments) / sizeof(NativeValue), arguments,
-                      FlushUICommandReason::kDependentsOnElement, exception_state);
+  RecordBindingMethod(binding_call_methods::kroundRect, sizeof(arguments) / sizeof(NativeValue), arguments,
+                      exception_state);
 }
 
 void CanvasRenderingContext2D::fill(webf::ExceptionState& exception_state) {
-  InvokeBindingMethod(binding_call_methods::kfill, 0, nullptr, FlushUICommandReason::kDependentsOnElement,
-                      exception_state);
+  RecordBindingMethod(binding_call_methods::kfill, 0, nullptr, exception_state);
 }
 
 void CanvasRenderingContext2D::fill(std::shared_ptr<const QJSUnionPath2DDomString> pathOrPattern,
@@ -171,13 +170,13 @@ void CanvasRenderingContext2D::fill(std::shared_ptr<const QJSUnionPath2DDomStrin
   if (pathOrPattern->IsDomString()) {
     NativeValue arguments[] = {
         NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), pathOrPattern->GetAsDomString())};
-    InvokeBindingMethod(binding_call_methods::kfill, sizeof(arguments) / sizeof(NativeValue), arguments,
-                        FlushUICommandReason::kDependentsOnElement, exception_state);
+    RecordBindingMethod(binding_call_methods::kfill, sizeof(arguments) / sizeof(NativeValue), arguments,
+                        exception_state);
   } else if (pathOrPattern->IsPath2D()) {
     NativeValue arguments[] = {
         NativeValueConverter<NativeTypePointer<Path2D>>::ToNativeValue(pathOrPattern->GetAsPath2D())};
-    InvokeBindingMethod(binding_call_methods::kfill, sizeof(arguments) / sizeof(NativeValue), arguments,
-                        FlushUICommandReason::kDependentsOnElement, exception_state);
+    RecordBindingMethod(binding_call_methods::kfill, sizeof(arguments) / sizeof(NativeValue), arguments,
+                        exception_state);
   }
 }
 
@@ -188,8 +187,34 @@ void CanvasRenderingContext2D::fill(std::shared_ptr<const QJSUnionPath2DDomStrin
   NativeValue arguments[] = {
       NativeValueConverter<NativeTypePointer<Path2D>>::ToNativeValue(pathOrPattern->GetAsPath2D()),
       NativeValueConverter<NativeTypeString>::ToNativeValue(ctx(), fillRule)};
-  InvokeBindingMethod(binding_call_methods::kfill, sizeof(arguments) / sizeof(NativeValue), arguments,
-                      FlushUICommandReason::kDependentsOnElement, exception_state);
+  RecordBindingMethod(binding_call_methods::kfill, sizeof(arguments) / sizeof(NativeValue), arguments, exception_state);
+}
+
+void CanvasRenderingContext2D::RecordBindingMethod(const AtomicString& method,
+                                                   int32_t argc,
+                                                   const NativeValue* argv,
+                                                   ExceptionState& exception_state) const {
+  if (UNLIKELY(bindingObject()->disposed_)) {
+    exception_state.ThrowException(
+        ctx(), ErrorType::InternalError,
+        "Can not record binding method on BindingObject, dart binding object had been disposed");
+    return;
+  }
+
+  GetExecutingContext()->canvasDisplayList()->RecordMethod(bindingObject(), method, argc, argv);
+}
+
+void CanvasRenderingContext2D::RecordBindingProperty(const AtomicString& prop,
+                                                     NativeValue value,
+                                                     ExceptionState& exception_state) const {
+  if (UNLIKELY(bindingObject()->disposed_)) {
+    exception_state.ThrowException(
+        ctx(), ErrorType::InternalError,
+        "Can not record binding property on BindingObject, dart binding object had been disposed");
+    return;
+  }
+
+  GetExecutingContext()->canvasDisplayList()->RecordProperty(bindingObject(), prop, value);
 }
 
 void CanvasRenderingContext2D::Trace(GCVisitor* visitor) const {
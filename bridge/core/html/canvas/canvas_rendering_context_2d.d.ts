@@ -3,51 +3,51 @@ import {HTMLCanvasElement} from "./html_canvas_element";
 
 interface CanvasRenderingContext2D extends CanvasRenderingContext {
     fillStyle: string | CanvasGradient | null;
-    direction: DartImpl<string>;
-    font: DartImpl<string>;
+    direction: DartImpl<Recordable<string>>;
+    font: DartImpl<Recordable<string>>;
     strokeStyle: string | CanvasGradient | null;
-    lineCap: DartImpl<string>;
-    lineDashOffset: DartImpl<double>;
-    lineJoin: DartImpl<string>;
-    lineWidth: DartImpl<double>;
-    miterLimit: DartImpl<double>;
-    textAlign: DartImpl<string>;
-    textBaseline: DartImpl<string>;
+    lineCap: DartImpl<Recordable<string>>;
+    lineDashOffset: DartImpl<Recordable<double>>;
+    lineJoin: DartImpl<Recordable<string>>;
+    lineWidth: DartImpl<Recordable<double>>;
+    miterLimit: DartImpl<Recordable<double>>;
+    textAlign: DartImpl<Recordable<string>>;
+    textBaseline: DartImpl<Recordable<string>>;
     // @TODO: Following number should be double.
     // Reference https://html.spec.whatwg.org/multipage/canvas.html
-    arc(x: number, y: number, radius: number, startAngle: number, endAngle: number, anticlockwise?: boolean): DartImpl<void>;
-    arcTo(x1: number, y1: number, x2: number, y2: number, radius: number): DartImpl<void>;
-    beginPath(): DartImpl<void>;
-    bezierCurveTo(cp1x: number, cp1y: number, cp2x: number, cp2y: number, x: number, y: number): DartImpl<void>;
-    clearRect(x: number, y: number, w: number, h: number): DartImpl<void>;
-    closePath(): DartImpl<void>;
-    clip(path?: Path2D, fillRule?: string): DartImpl<void>;
-    drawImage(image: HTMLImageElement, sx: number, sy: number, sw: number, sh: number, dx: number, dy: number, dw: number, dh: number): DartImpl<void>;
-    drawImage(image: HTMLImageElement, dx: number, dy: number, dw: number, dh: number): DartImpl<void>;
-    drawImage(image: HTMLImageElement, dx: number, dy: number): DartImpl<void>;
-    ellipse(x: number, y: number, radiusX: number, radiusY: number, rotation: number, startAngle: number, endAngle: number, anticlockwise?: boolean): DartImpl<void>;
+    arc(x: number, y: number, radius: number, startAngle: number, endAngle: number, anticlockwise?: boolean): DartImpl<Recordable<void>>;
+    arcTo(x1: number, y1: number, x2: number, y2: number, radius: number): DartImpl<Recordable<void>>;
+    beginPath(): DartImpl<Recordable<void>>;
+    bezierCurveTo(cp1x: number, cp1y: number, cp2x: number, cp2y: number, x: number, y: number): DartImpl<Recordable<void>>;
+    clearRect(x: number, y: number, w: number, h: number): DartImpl<Recordable<void>>;
+    closePath(): DartImpl<Recordable<void>>;
+    clip(path?: Path2D, fillRule?: string): DartImpl<Recordable<void>>;
+    drawImage(image: HTMLImageElement, sx: number, sy: number, sw: number, sh: number, dx: number, dy: number, dw: number, dh: number): DartImpl<Recordable<void>>;
+    drawImage(image: HTMLImageElement, dx: number, dy: number, dw: number, dh: number): DartImpl<Recordable<void>>;
+    drawImage(image: HTMLImageElement, dx: number, dy: number): DartImpl<Recordable<void>>;
+    ellipse(x: number, y: number, radiusX: number, radiusY: number, rotation: number, startAngle: number, endAngle: number, anticlockwise?: boolean): DartImpl<Recordable<void>>;
     fill(path?: Path2D | string, fillRule?: string): void;
-    fillRect(x: number, y: number, w: number, h: number): DartImpl<void>;
-    fillText(text: string, x: number, y: number, maxWidth?: number): DartImpl<void>;
-    lineTo(x: number, y: number): DartImpl<void>;
-    moveTo(x: number, y: number): DartImpl<void>;
-    rect(x: number, y: number, w: number, h: number): DartImpl<void>;
-    restore(): DartImpl<void>;
-    resetTransform(): DartImpl<void>;
-    rotate(angle: number): DartImpl<void>;
+    fillRect(x: number, y: number, w: number, h: number): DartImpl<Recordable<void>>;
+    fillText(text: string, x: number, y: number, maxWidth?: number): DartImpl<Recordable<void>>;
+    lineTo(x: number, y: number): DartImpl<Recordable<void>>;
+    moveTo(x: number, y: number): DartImpl<Recordable<void>>;
+    rect(x: number, y: number, w: number, h: number): DartImpl<Recordable<void>>;
+    restore(): DartImpl<Recordable<void>>;
+    resetTransform(): DartImpl<Recordable<void>>;
+    rotate(angle: number): DartImpl<Recordable<void>>;
     roundRect(x: number, y: number, w: number, h: number, radii: number | number[]): void;
-    quadraticCurveTo(cpx: number, cpy: number, x: number, y: number): DartImpl<void>;
-    stroke(path?: Path2D): DartImpl<void>;
-    strokeRect(x: number, y: number, w: number, h: number): DartImpl<void>;
-    save(): DartImpl<void>;
-    scale(x: number, y: number): DartImpl<void>;
-    strokeText(text: string, x: number, y: number, maxWidth?: number): DartImpl<void>;
-    setTransform(a: number, b: number, c: number, d: number, e: number, f: number): DartImpl<void>;
-    transform(a: number, b: number, c: number, d: number, e: number, f: number): DartImpl<void>;
-    translate(x: number, y: number): DartImpl<void>;
+    quadraticCurveTo(cpx: number, cpy: number, x: number, y: number): DartImpl<Recordable<void>>;
+    stroke(path?: Path2D): DartImpl<Recordable<void>>;
+    strokeRect(x: number, y: number, w: number, h: number): DartImpl<Recordable<void>>;
+    save(): DartImpl<Recordable<void>>;
+    scale(x: number, y: number): DartImpl<Recordable<void>>;
+    strokeText(text: string, x: number, y: number, maxWidth?: number): DartImpl<Recordable<void>>;
+    setTransform(a: number, b: number, c: number, d: number, e: number, f: number): DartImpl<Recordable<void>>;
+    transform(a: number, b: number, c: number, d: number, e: number, f: number): DartImpl<Recordable<void>>;
+    translate(x: number, y: number): DartImpl<Recordable<void>>;
     createLinearGradient(x0: number, y0: number, x1: number, y1: number): CanvasGradient;
     createRadialGradient(x0: number, y0: number, r0: number, x1: number, y1: number, r1: number): CanvasGradient;
     createPattern(image: HTMLImageElement | HTMLCanvasElement, repetition: string): CanvasPattern;
-    reset(): DartImpl<void>;
+    reset(): DartImpl<Recordable<void>>;
     new(): void;
 }
@@ -62,6 +62,14 @@ class CanvasRenderingContext2D : public CanvasRenderingContext {
                  std::shared_ptr<const QJSUnionDoubleSequenceDouble> radii,
                  ExceptionState& exception_state);
 
+  // Append calls without return values to the display list of the executing context. They are replayed by dart in
+  // the order they were recorded, together with the UI commands of the same frame.
+  void RecordBindingMethod(const AtomicString& method,
+                           int32_t argc,
+                           const NativeValue* argv,
+                           ExceptionState& exception_state) const;
+  void RecordBindingProperty(const AtomicString& prop, NativeValue value, ExceptionState& exception_state) const;
+
   void Trace(GCVisitor* visitor) const override;
 
  private:
@@ -11,6 +11,61 @@
 
 namespace webf {
 
+// Only the wrappers created by InitializeQuickJSObject() inherit the accessors of the shaped prototypes.
+static WidgetElement* ToShapedWidgetElement(JSValueConst this_val) {
+  if (!JS_IsObject(this_val))
+    return nullptr;
+  JSValue object = JS_IsProxy(this_val) ? JS_GetProxyTarget(this_val) : this_val;
+  if (JSValueGetClassId(object) != JS_CLASS_WIDGET_ELEMENT_WITH_SHAPE)
+    return nullptr;
+  return static_cast<WidgetElement*>(toScriptWrappable(object));
+}
+
+// func_data[0] is the name of the property defined in the Dart side.
+static JSValue HandleShapedPropertyGetter(JSContext* ctx,
+                                          JSValueConst this_val,
+                                          int argc,
+                                          JSValueConst* argv,
+                                          int magic,
+                                          JSValue* func_data) {
+  auto* element = ToShapedWidgetElement(this_val);
+  if (element == nullptr) {
+    return JS_ThrowTypeError(ctx, "Illegal invocation");
+  }
+
+  ExceptionState exception_state;
+  NativeValue result = element->GetBindingProperty(AtomicString(ctx, func_data[0]),
+                                                   FlushUICommandReason::kDependentsOnElement, exception_state);
+  if (UNLIKELY(exception_state.HasException())) {
+    return exception_state.ToQuickJS();
+  }
+  return JS_DupValue(ctx, ScriptValue(ctx, result).QJSValue());
+}
+
+static JSValue HandleShapedPropertySetter(JSContext* ctx,
+                                          JSValueConst this_val,
+                                          int argc,
+                                          JSValueConst* argv,
+                                          int magic,
+                                          JSValue* func_data) {
+  auto* element = ToShapedWidgetElement(this_val);
+  if (element == nullptr) {
+    return JS_ThrowTypeError(ctx, "Illegal invocation");
+  }
+
+  ExceptionState exception_state;
+  ScriptValue value = ScriptValue(ctx, argc > 0 ? argv[0] : JS_UNDEFINED);
+  NativeValue native_value = value.ToNative(ctx, exception_state);
+  if (UNLIKELY(exception_state.HasException())) {
+    return exception_state.ToQuickJS();
+  }
+  element->SetBindingProperty(AtomicString(ctx, func_data[0]), native_value, exception_state);
+  if (UNLIKELY(exception_state.HasException())) {
+    return exception_state.ToQuickJS();
+  }
+  return JS_UNDEFINED;
+}
+
 WidgetElement::WidgetElement(const AtomicString& tag_name, Document* document)
     : HTMLElement(tag_name, document, ConstructionType::kCreateWidgetElement) {}
 
@@ -163,6 +218,57 @@ void WidgetElement::CloneNonAttributePropertiesFrom(const Element& other, CloneC
   }
 }
 
+void WidgetElement::InitializeQuickJSObject() {
+  ExecutionContextData* context_data = GetExecutingContext()->contextData();
+  JSValue prototype = context_data->widgetElementPrototypeForTag(tagName());
+
+  // The first element of a tag asks the Dart side for the shape through the named property handlers.
+  if (JS_IsNull(prototype)) {
+    auto shape =
+        GetExecutingContext()->dartIsolateContext()->EnsureData()->GetWidgetElementShape(tagName().ToStdString(ctx()));
+    if (shape == nullptr) {
+      ScriptWrappable::InitializeQuickJSObject();
+      return;
+    }
+    prototype = CreateShapedPrototype(shape);
+    context_data->SetWidgetElementPrototypeForTag(tagName(), prototype);
+  }
+
+  InitializeQuickJSObjectWithPrototype(JS_CLASS_WIDGET_ELEMENT_WITH_SHAPE, "WidgetElement", prototype);
+}
+
+// The prototype inherits WidgetElement.prototype and defines the Dart properties as accessors and the Dart methods as
+// functions shared by all the elements of the tag.
+JSValue WidgetElement::CreateShapedPrototype(const WidgetElementShape* shape) {
+  JSValue parent = GetExecutingContext()->contextData()->prototypeForType(GetWrapperTypeInfo());
+  JSValue prototype = JS_NewObjectProto(ctx(), parent);
+
+  for (auto& property : shape->built_in_properties_) {
+    AtomicString key = AtomicString(ctx(), property);
+    JSValue name = key.ToQuickJS(ctx());
+    JSValue getter = JS_NewCFunctionData(ctx(), HandleShapedPropertyGetter, 0, 0, 1, &name);
+    JSValue setter = JS_NewCFunctionData(ctx(), HandleShapedPropertySetter, 1, 0, 1, &name);
+    JS_DefinePropertyGetSet(ctx(), prototype, key.Impl(), getter, setter, JS_PROP_CONFIGURABLE | JS_PROP_ENUMERABLE);
+    JS_FreeValue(ctx(), name);
+  }
+
+  for (auto& method : shape->built_in_methods_) {
+    AtomicString key = AtomicString(ctx(), method);
+    ScriptValue func = CreateSyncMethodFunc(key);
+    JS_DefinePropertyValue(ctx(), prototype, key.Impl(), JS_DupValue(ctx(), func.QJSValue()), JS_PROP_C_W_E);
+  }
+
+  for (auto& method : shape->built_in_async_methods_) {
+    AtomicString key = AtomicString(ctx(), method);
+    ScriptValue func = CreateAsyncMethodFunc(key);
+    JS_DefinePropertyValue(ctx(), prototype, key.Impl(), JS_DupValue(ctx(), func.QJSValue()), JS_PROP_C_W_E);
+  }
+
+  JS_DefinePropertyValue(ctx(), prototype, JS_ATOM_Symbol_toStringTag, tagName().ToQuickJS(ctx()),
+                         JS_PROP_CONFIGURABLE);
+  return prototype;
+}
+
 const WidgetElementShape* WidgetElement::SaveWidgetElementsShapeData(const NativeValue* argv) {
   AtomicString key = tagName();
   assert(!GetExecutingContext()->dartIsolateContext()->EnsureData()->HasWidgetElementShape(key.ToStdString(ctx())));
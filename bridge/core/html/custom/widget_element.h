@@ -37,7 +37,13 @@ class WidgetElement : public HTMLElement {
 
   void Trace(GCVisitor* visitor) const override;
 
+ protected:
+  // WidgetElements whose shape is already known get their properties and methods from a prototype per tag name
+  // instead of the named property handlers, so the engine can cache their lookups.
+  void InitializeQuickJSObject() override;
+
  private:
+  JSValue CreateShapedPrototype(const WidgetElementShape* shape);
   ScriptValue CreateSyncMethodFunc(const AtomicString& method_name);
   ScriptValue CreateAsyncMethodFunc(const AtomicString& method_name);
   const WidgetElementShape* SaveWidgetElementsShapeData(const NativeValue* argv);
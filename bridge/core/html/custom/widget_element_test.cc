@@ -49,3 +49,33 @@ TEST(WidgetElement, getPropertyWithSymbolToStringTag) {
 
   EXPECT_EQ(errorCalled, false);
 }
+
+TEST(WidgetElement, elementsWithKnownShapeShareTagPrototype) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    EXPECT_STREQ(message.c_str(), "function,true,true,[object FLUTTER-SHAPED-WIDGET],true,1,false");
+    logCalled = true;
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = env->page()->executingContext();
+  auto shape = std::make_shared<WidgetElementShape>();
+  shape->built_in_properties_.emplace("value");
+  shape->built_in_methods_.emplace("play");
+  shape->built_in_async_methods_.emplace("load");
+  context->dartIsolateContext()->EnsureData()->SetWidgetElementShape("FLUTTER-SHAPED-WIDGET", shape);
+
+  const char* code =
+      "let a = document.createElement('flutter-shaped-widget'); "
+      "let b = document.createElement('flutter-shaped-widget'); "
+      "a.foo = 1; "
+      "console.log([typeof a.play, a.play === b.play && a.load === b.load, 'value' in a, "
+      "Object.prototype.toString.call(a), a instanceof HTMLElement, a.foo, 'foo' in b].join(','));";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
@@ -3,11 +3,18 @@
  * Copyright (C) 2022-present The WebF authors. All rights reserved.
  */
 
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
 #include <utility>
 
+#include "core/dom/child_list_mutation_scope.h"
 #include "core/dom/document.h"
 #include "core/dom/element.h"
+#include "core/dom/subtree_stream.h"
 #include "core/dom/text.h"
+#include "core/executing_context.h"
 #include "element_namespace_uris.h"
 #include "foundation/logging.h"
 #include "html_names.h"
@@ -15,38 +22,20 @@
 
 namespace webf {
 
-std::string trim(const std::string& str) {
-  std::string tmp = str;
-  tmp.erase(0, tmp.find_first_not_of(' '));  // prefixing spaces
-  tmp.erase(tmp.find_last_not_of(' ') + 1);  // surfixing spaces
-  return tmp;
-}
-
 // Parse html,isHTMLFragment should be false if you need to automatically complete html, head, and body when they are
 // missing.
-GumboOutput* parse(const std::string& html, bool isHTMLFragment = false) {
+GumboOutput* parse(const char* code, size_t length, bool isHTMLFragment = false) {
   // Gumbo-parser parse HTML.
-  GumboOutput* htmlTree = gumbo_parse_with_options(&kGumboDefaultOptions, html.c_str(), html.length());
+  GumboOutput* htmlTree = gumbo_parse_with_options(&kGumboDefaultOptions, code, length);
 
   if (isHTMLFragment) {
     // Find body.
     const GumboVector* children = &htmlTree->root->v.element.children;
     for (int i = 0; i < children->length; ++i) {
       auto* child = (GumboNode*)children->data[i];
-      if (child->type == GUMBO_NODE_ELEMENT) {
-        std::string tagName;
-        if (child->v.element.tag != GUMBO_TAG_UNKNOWN) {
-          tagName = gumbo_normalized_tagname(child->v.element.tag);
-        } else {
-          GumboStringPiece piece = child->v.element.original_tag;
-          gumbo_tag_from_original_text(&piece);
-          tagName = std::string(piece.data, piece.length);
-        }
-
-        if (tagName.compare("body") == 0) {
-          htmlTree->root = child;
-          break;
-        }
+      if (child->type == GUMBO_NODE_ELEMENT && child->v.element.tag == GUMBO_TAG_BODY) {
+        htmlTree->root = child;
+        break;
       }
     }
   }
@@ -54,6 +43,417 @@ GumboOutput* parse(const std::string& html, bool isHTMLFragment = false) {
   return htmlTree;
 }
 
+static bool IsBlank(const char* code, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    if (code[i] != ' ')
+      return false;
+  }
+  return true;
+}
+
+// Names of the tags gumbo recognizes. The ones webf has an interface for are already interned in html_names.
+static AtomicString KnownTagName(JSContext* ctx, GumboTag tag) {
+  switch (tag) {
+    case GUMBO_TAG_HTML:
+      return html_names::khtml;
+    case GUMBO_TAG_HEAD:
+      return html_names::khead;
+    case GUMBO_TAG_BODY:
+      return html_names::kbody;
+    case GUMBO_TAG_DIV:
+      return html_names::kdiv;
+    case GUMBO_TAG_A:
+      return html_names::ka;
+    case GUMBO_TAG_LINK:
+      return html_names::klink;
+    case GUMBO_TAG_INPUT:
+      return html_names::kinput;
+    case GUMBO_TAG_TEXTAREA:
+      return html_names::ktextarea;
+    case GUMBO_TAG_FORM:
+      return html_names::kform;
+    case GUMBO_TAG_TEMPLATE:
+      return html_names::ktemplate;
+    case GUMBO_TAG_IMG:
+      return html_names::kimg;
+    case GUMBO_TAG_SCRIPT:
+      return html_names::kscript;
+    case GUMBO_TAG_IFRAME:
+      return html_names::kiframe;
+    case GUMBO_TAG_CANVAS:
+      return html_names::kcanvas;
+    default: {
+      const char* name = gumbo_normalized_tagname(tag);
+      return AtomicString(ctx, name, strlen(name));
+    }
+  }
+}
+
+static size_t SourceOffset(GumboNode* node) {
+  if (node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE)
+    return node->v.element.start_pos.offset;
+  return node->v.text.start_pos.offset;
+}
+
+static const GumboVector* Children(GumboNode* node) {
+  return node->type == GUMBO_NODE_DOCUMENT ? &node->v.document.children : &node->v.element.children;
+}
+
+// Gumbo closes the elements still open at the end of the input there, which is where a partial tag starts.
+static bool IsClosedBefore(GumboNode* node, size_t offset) {
+  return node->v.element.end_pos.offset < offset;
+}
+
+// Whether a streamed element may still receive children from the input after |end|.
+static bool MayStayOpen(GumboNode* node, size_t end) {
+  if (node->type != GUMBO_NODE_ELEMENT)
+    return false;
+  switch (node->v.element.tag) {
+    // Content after </body> or </html> still goes to the body, so does <meta> after </head> to the head.
+    case GUMBO_TAG_HTML:
+    case GUMBO_TAG_HEAD:
+    case GUMBO_TAG_BODY:
+      return true;
+    case GUMBO_TAG_AREA:
+    case GUMBO_TAG_BASE:
+    case GUMBO_TAG_BR:
+    case GUMBO_TAG_COL:
+    case GUMBO_TAG_EMBED:
+    case GUMBO_TAG_HR:
+    case GUMBO_TAG_IMG:
+    case GUMBO_TAG_INPUT:
+    case GUMBO_TAG_LINK:
+    case GUMBO_TAG_META:
+    case GUMBO_TAG_PARAM:
+    case GUMBO_TAG_SOURCE:
+    case GUMBO_TAG_TRACK:
+    case GUMBO_TAG_WBR:
+      return false;
+    default:
+      return !IsClosedBefore(node, end);
+  }
+}
+
+static bool IsRawText(GumboTag tag) {
+  switch (tag) {
+    case GUMBO_TAG_SCRIPT:
+    case GUMBO_TAG_STYLE:
+    case GUMBO_TAG_TITLE:
+    case GUMBO_TAG_TEXTAREA:
+    case GUMBO_TAG_XMP:
+    case GUMBO_TAG_IFRAME:
+    case GUMBO_TAG_NOEMBED:
+    case GUMBO_TAG_NOFRAMES:
+    case GUMBO_TAG_PLAINTEXT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// The node a partial input ends with, which the next chunks may complete: text or a comment reaching the end of the
+// input, or a raw text element or template whose end tag wasn't received yet. A script runs once dart receives it, so
+// it must not be built before its end tag.
+static GumboNode* FindHeldNode(GumboNode* node, size_t end_of_input) {
+  switch (node->type) {
+    case GUMBO_NODE_ELEMENT:
+      if (IsRawText(node->v.element.tag) && node->v.element.original_end_tag.length == 0)
+        return node;
+      break;
+    case GUMBO_NODE_TEMPLATE:
+      if (node->v.element.original_end_tag.length == 0)
+        return node;
+      break;
+    case GUMBO_NODE_DOCUMENT:
+      break;
+    default: {
+      // Text followed by a partial tag is held too, gumbo merges the text after an ignored tag into it.
+      GumboText* text = &node->v.text;
+      return text->start_pos.offset + text->original_text.length >= end_of_input ? node : nullptr;
+    }
+  }
+
+  const GumboVector* children = Children(node);
+  for (int i = 0; i < children->length; ++i) {
+    if (GumboNode* held = FindHeldNode((GumboNode*)children->data[i], end_of_input))
+      return held;
+  }
+  return nullptr;
+}
+
+// Whether a node was parsed from the input between |begin| and |end|.
+static bool HasNodeBetween(GumboNode* node, size_t begin, size_t end) {
+  const GumboVector* children = Children(node);
+  for (int i = 0; i < children->length; ++i) {
+    auto* child = (GumboNode*)children->data[i];
+    size_t offset = SourceOffset(child);
+    if (offset >= begin && offset < end)
+      return true;
+    if ((child->type == GUMBO_NODE_ELEMENT || child->type == GUMBO_NODE_TEMPLATE) && HasNodeBetween(child, begin, end))
+      return true;
+  }
+  return false;
+}
+
+// Copies of a formatting element made by error recovery, they start where the element they copy does.
+static bool IsClone(GumboNode* node) {
+  return node->parse_flags &
+         (GUMBO_INSERTION_RECONSTRUCTED_FORMATTING_ELEMENT | GUMBO_INSERTION_ADOPTION_AGENCY_CLONED);
+}
+
+// An element of a streamed document which may still receive children, kept alive until the parser is done with it.
+struct HTMLOpenElement {
+  explicit HTMLOpenElement(ContainerNode* node) : node(node) { node->KeepAlive(); }
+  ~HTMLOpenElement() { node->ReleaseAlive(); }
+
+  ContainerNode* node;
+  // Reopens the element in front of the next chunk: its start tag as received, followed by the end tag of a <head>
+  // which was closed.
+  std::string markup;
+  // Offset of |markup| in the input of the current parse.
+  size_t offset{0};
+};
+
+using HTMLOpenElements = std::vector<std::unique_ptr<HTMLOpenElement>>;
+
+// Builds the DOM of a gumbo tree natively. Nodes are linked without mutation records and without UI commands of
+// their own, dart receives the new children of the root and everything below them with a single command.
+class HTMLTreeBuilder {
+ public:
+  explicit HTMLTreeBuilder(ExecutingContext* context)
+      : context_(context), ctx_(context->ctx()), document_(context->document()), stream_(context) {}
+
+  void Build(ContainerNode* root, GumboNode* node) {
+    context_->uiCommandBuffer()->BeginSubtreeConstruction();
+    const GumboVector* children = &node->v.element.children;
+    for (int i = 0; i < children->length; ++i) {
+      Node* child = BuildNode(root, (GumboNode*)children->data[i]);
+      if (child == nullptr)
+        continue;
+      root->ParserAppendChild(child);
+      // The root may be observed, its descendants were created by this parse and can't be.
+      ChildListMutationScope(*root).ChildAdded(*child);
+    }
+    context_->uiCommandBuffer()->EndSubtreeConstruction();
+
+    stream_.Commit(root);
+  }
+
+  // Builds the nodes of a streamed document parsed from the input between the markup reopening |open_elements| and
+  // |end|, the input after |end| is parsed again with the next chunk. Returns the elements the next chunk continues in.
+  HTMLOpenElements Sync(HTMLOpenElements& open_elements, GumboNode* node, size_t reopened_length, size_t end) {
+    open_elements_ = &open_elements;
+    reopened_length_ = reopened_length;
+    end_ = end;
+    FindOpenPath(node);
+
+    ContainerNode* root = open_elements[0]->node;
+    context_->uiCommandBuffer()->BeginSubtreeConstruction();
+    SyncElement(root, node);
+    context_->uiCommandBuffer()->EndSubtreeConstruction();
+    stream_.Commit(root);
+
+    HTMLOpenElements result;
+    for (size_t i = 0; i < open_path_.size() && open_path_nodes_[i] != nullptr; ++i) {
+      auto it = std::find_if(open_elements.begin(), open_elements.end(),
+                             [this, i](const auto& open_element) {
+                               return open_element != nullptr && open_element->node == open_path_nodes_[i];
+                             });
+      std::unique_ptr<HTMLOpenElement> open_element =
+          it != open_elements.end() ? std::move(*it) : std::make_unique<HTMLOpenElement>(open_path_nodes_[i]);
+      open_element->markup = ReopeningMarkup(open_path_[i]);
+      result.emplace_back(std::move(open_element));
+    }
+    return result;
+  }
+
+ private:
+  // The elements the input after |end_| continues in, from the root down. They end the rightmost path of the tree, the
+  // nodes after |end_| only exist because of the input gumbo wasn't given yet.
+  void FindOpenPath(GumboNode* node) {
+    open_path_.push_back(node);
+    while (true) {
+      const GumboVector* children = &node->v.element.children;
+      GumboNode* last_child = nullptr;
+      for (int i = static_cast<int>(children->length) - 1; i >= 0 && last_child == nullptr; --i) {
+        auto* child = (GumboNode*)children->data[i];
+        // The whitespace after </head> is a child of <html>.
+        if (SourceOffset(child) < end_ && (node != open_path_[0] || child->type == GUMBO_NODE_ELEMENT)) {
+          last_child = child;
+        }
+      }
+      if (last_child == nullptr || !MayStayOpen(last_child, end_))
+        break;
+      open_path_.push_back(last_child);
+      if (IsClosedBefore(last_child, end_))
+        break;
+      node = last_child;
+    }
+    open_path_nodes_.assign(open_path_.size(), nullptr);
+  }
+
+  std::string ReopeningMarkup(GumboNode* node) {
+    GumboElement* element = &node->v.element;
+    // Implied elements are known tags.
+    std::string markup = element->original_tag.length > 0
+                             ? std::string(element->original_tag.data, element->original_tag.length)
+                             : std::string("<") + gumbo_normalized_tagname(element->tag) + ">";
+    if (element->tag == GUMBO_TAG_HEAD && IsClosedBefore(node, end_)) {
+      markup += "</head>";
+    }
+    return markup;
+  }
+
+  void TrackOpenPath(GumboNode* node, ContainerNode* container) {
+    auto it = std::find(open_path_.begin(), open_path_.end(), node);
+    if (it != open_path_.end()) {
+      open_path_nodes_[it - open_path_.begin()] = container;
+    }
+  }
+
+  // Whether a node is parsed from the input no node was built from.
+  bool IsNew(GumboNode* node) const {
+    size_t offset = SourceOffset(node);
+    return offset < end_ && (offset >= reopened_length_ || IsClone(node));
+  }
+
+  HTMLOpenElement* FindReopenedElement(GumboNode* node) {
+    if (node->type != GUMBO_NODE_ELEMENT)
+      return nullptr;
+    for (size_t i = 1; i < open_elements_->size(); ++i) {
+      HTMLOpenElement* open_element = (*open_elements_)[i].get();
+      if (open_element->offset == node->v.element.start_pos.offset)
+        return open_element;
+    }
+    return nullptr;
+  }
+
+  void SyncElement(ContainerNode* container, GumboNode* node) {
+    TrackOpenPath(node, container);
+    SyncAttributes(container, &node->v.element);
+
+    const GumboVector* children = &node->v.element.children;
+    for (int i = 0; i < children->length; ++i) {
+      auto* child = (GumboNode*)children->data[i];
+      if (IsNew(child)) {
+        Node* built = BuildNode(container, child);
+        if (built == nullptr)
+          continue;
+        container->ParserAppendChild(built);
+        ChildListMutationScope(*container).ChildAdded(*built);
+        continue;
+      }
+
+      if (SourceOffset(child) >= reopened_length_)
+        continue;
+      // Parsed from the markup reopening the open elements. The ones gumbo implied for it, like the <head> in front of a
+      // reopened <body>, were built before.
+      if (HTMLOpenElement* open_element = FindReopenedElement(child)) {
+        SyncElement(open_element->node, child);
+      }
+    }
+  }
+
+  // Attributes gumbo merged into an element dart already has, like the ones of a second <body> tag. They are set the
+  // regular way, outside of the subtree construction.
+  void SyncAttributes(ContainerNode* container, GumboElement* gumbo_element) {
+    const GumboVector* attributes = &gumbo_element->attributes;
+    auto* element = DynamicTo<Element>(container);
+    if (element == nullptr)
+      return;
+
+    bool constructing = true;
+    for (int i = 0; i < attributes->length; ++i) {
+      auto* attribute = (GumboAttribute*)attributes->data[i];
+      // The ones of the reopening markup were set already.
+      if (attribute->name_start.offset < reopened_length_ || attribute->name_start.offset >= end_)
+        continue;
+      if (constructing) {
+        context_->uiCommandBuffer()->EndSubtreeConstruction();
+        constructing = false;
+      }
+      element->setAttribute(AtomicString(ctx_, attribute->name, strlen(attribute->name)),
+                            AtomicString(ctx_, attribute->value, strlen(attribute->value)), ASSERT_NO_EXCEPTION());
+    }
+    if (!constructing) {
+      context_->uiCommandBuffer()->BeginSubtreeConstruction();
+    }
+  }
+
+  Node* BuildNode(Node* parent, GumboNode* node) {
+    if (!IsNew(node))
+      return nullptr;
+    if (node->type == GUMBO_NODE_TEXT) {
+      const char* data = node->v.text.text;
+      Text* text = document_->createTextNode(String(ctx_, data, strlen(data)), ASSERT_NO_EXCEPTION());
+      stream_.AddText(text, parent, text->data());
+      return text;
+    }
+    if (node->type != GUMBO_NODE_ELEMENT)
+      return nullptr;
+
+    GumboElement* gumbo_element = &node->v.element;
+    Element* element;
+    SubtreeStream::NodeKind kind;
+    if (gumbo_element->tag_namespace == GUMBO_NAMESPACE_SVG) {
+      element = document_->createElementNS(element_namespace_uris::ksvg, TagName(gumbo_element), ASSERT_NO_EXCEPTION());
+      kind = SubtreeStream::kSVGElement;
+    } else {
+      element = document_->createElement(TagName(gumbo_element), ASSERT_NO_EXCEPTION());
+      kind = SubtreeStream::kElement;
+    }
+    stream_.AddElement(element, parent, kind, element->localName());
+    TrackOpenPath(node, element);
+
+    const GumboVector* attributes = &gumbo_element->attributes;
+    for (int i = 0; i < attributes->length; ++i) {
+      auto* attribute = (GumboAttribute*)attributes->data[i];
+      AtomicString name(ctx_, attribute->name, strlen(attribute->name));
+      AtomicString value(ctx_, attribute->value, strlen(attribute->value));
+      if (element->ParserSetAttribute(name, value)) {
+        stream_.AddAttribute(name, value);
+      }
+    }
+
+    const GumboVector* children = &gumbo_element->children;
+    for (int i = 0; i < children->length; ++i) {
+      if (Node* child = BuildNode(element, (GumboNode*)children->data[i])) {
+        element->ParserAppendChild(child);
+      }
+    }
+
+    return element;
+  }
+
+  const AtomicString& TagName(GumboElement* element) {
+    if (element->tag == GUMBO_TAG_UNKNOWN) {
+      GumboStringPiece piece = element->original_tag;
+      gumbo_tag_from_original_text(&piece);
+      unknown_tag_name_ = AtomicString(ctx_, piece.data, piece.length);
+      return unknown_tag_name_;
+    }
+
+    AtomicString& name = tag_names_[element->tag];
+    if (name.IsNull()) {
+      name = KnownTagName(ctx_, element->tag);
+    }
+    return name;
+  }
+
+  ExecutingContext* context_;
+  JSContext* ctx_;
+  Document* document_;
+  SubtreeStream stream_;
+  std::array<AtomicString, GUMBO_TAG_UNKNOWN> tag_names_;
+  AtomicString unknown_tag_name_;
+  // Only nodes parsed from the input between these offsets are built, a full parse builds all of them.
+  size_t reopened_length_{0};
+  size_t end_{SIZE_MAX};
+  HTMLOpenElements* open_elements_{nullptr};
+  std::vector<GumboNode*> open_path_;
+  std::vector<ContainerNode*> open_path_nodes_;
+};
+
 void transToSVG(GumboNode* node) {
   if (node->type == GUMBO_NODE_ELEMENT) {
     auto element = &node->v.element;
@@ -93,56 +493,7 @@ GumboNode* findSVGRoot(GumboNode* node) {
   return nullptr;
 }
 
-void HTMLParser::traverseHTML(Node* root_node, GumboNode* node) {
-  auto* context = root_node->GetExecutingContext();
-  JSContext* ctx = root_node->GetExecutingContext()->ctx();
-
-  auto* html_element = DynamicTo<Element>(root_node);
-  if (html_element != nullptr && html_element->localName() == html_names::khtml) {
-    parseProperty(html_element, &node->v.element);
-  }
-
-  const GumboVector* children = &node->v.element.children;
-  for (int i = 0; i < children->length; ++i) {
-    auto* child = (GumboNode*)children->data[i];
-
-    if (auto* root_container = DynamicTo<ContainerNode>(root_node)) {
-      if (child->type == GUMBO_NODE_ELEMENT) {
-        std::string tagName;
-        if (child->v.element.tag != GUMBO_TAG_UNKNOWN) {
-          tagName = gumbo_normalized_tagname(child->v.element.tag);
-        } else {
-          GumboStringPiece piece = child->v.element.original_tag;
-          gumbo_tag_from_original_text(&piece);
-          tagName = std::string(piece.data, piece.length);
-        }
-
-        Element* element;
-
-        switch (child->v.element.tag_namespace) {
-          case ::GUMBO_NAMESPACE_SVG: {
-            element = context->document()->createElementNS(element_namespace_uris::ksvg, AtomicString(ctx, tagName),
-                                                           ASSERT_NO_EXCEPTION());
-            break;
-          }
-
-          default: {
-            element = context->document()->createElement(AtomicString(ctx, tagName), ASSERT_NO_EXCEPTION());
-          }
-        }
-
-        traverseHTML(element, child);
-        root_container->AppendChild(element);
-        parseProperty(element, &child->v.element);
-      } else if (child->type == GUMBO_NODE_TEXT) {
-        auto* text = context->document()->createTextNode(AtomicString(ctx, child->v.text.text), ASSERT_NO_EXCEPTION());
-        root_container->AppendChild(text);
-      }
-    }
-  }
-}
-
-bool HTMLParser::parseHTML(const std::string& html, Node* root_node, bool isHTMLFragment) {
+bool HTMLParser::parseHTML(const char* code, size_t length, Node* root_node, bool isHTMLFragment) {
   if (root_node != nullptr) {
     if (auto* root_container_node = DynamicTo<ContainerNode>(root_node)) {
       {
@@ -150,19 +501,24 @@ bool HTMLParser::parseHTML(const std::string& html, Node* root_node, bool isHTML
         root_container_node->RemoveChildren();
       }
 
-      if (!trim(html).empty()) {
-        root_node->GetExecutingContext()->dartIsolateContext()->profiler()->StartTrackSteps("HTMLParser::parse");
+      if (!IsBlank(code, length)) {
+        ExecutingContext* context = root_node->GetExecutingContext();
+        context->dartIsolateContext()->profiler()->StartTrackSteps("HTMLParser::parse");
 
-        GumboOutput* htmlTree = parse(html, isHTMLFragment);
+        GumboOutput* htmlTree = parse(code, length, isHTMLFragment);
 
-        root_node->GetExecutingContext()->dartIsolateContext()->profiler()->FinishTrackSteps();
-        root_node->GetExecutingContext()->dartIsolateContext()->profiler()->StartTrackSteps("HTMLParser::traverseHTML");
+        context->dartIsolateContext()->profiler()->FinishTrackSteps();
+        context->dartIsolateContext()->profiler()->StartTrackSteps("HTMLParser::traverseHTML");
 
-        traverseHTML(root_container_node, htmlTree->root);
+        auto* html_element = DynamicTo<Element>(root_node);
+        if (html_element != nullptr && html_element->localName() == html_names::khtml) {
+          parseProperty(html_element, &htmlTree->root->v.element);
+        }
+        HTMLTreeBuilder(context).Build(root_container_node, htmlTree->root);
         // Free gumbo parse nodes.
         gumbo_destroy_output(&kGumboDefaultOptions, htmlTree);
 
-        root_node->GetExecutingContext()->dartIsolateContext()->profiler()->FinishTrackSteps();
+        context->dartIsolateContext()->profiler()->FinishTrackSteps();
       }
     }
   } else {
@@ -173,17 +529,15 @@ bool HTMLParser::parseHTML(const std::string& html, Node* root_node, bool isHTML
 }
 
 bool HTMLParser::parseHTML(const std::string& html, Node* root_node) {
-  return parseHTML(html, root_node, false);
+  return parseHTML(html.c_str(), html.length(), root_node, false);
 }
 
 bool HTMLParser::parseHTML(const char* code, size_t codeLength, Node* root_node) {
-  std::string html = std::string(code, codeLength);
-  return parseHTML(html, root_node, false);
+  return parseHTML(code, codeLength, root_node, false);
 }
 
 bool HTMLParser::parseHTMLFragment(const char* code, size_t codeLength, Node* rootNode) {
-  std::string html = std::string(code, codeLength);
-  return parseHTML(html, rootNode, true);
+  return parseHTML(code, codeLength, rootNode, true);
 }
 
 GumboOutput* HTMLParser::parseSVGResult(const char* code, size_t codeLength) {
@@ -197,6 +551,101 @@ GumboOutput* HTMLParser::parseSVGResult(const char* code, size_t codeLength) {
   return result;
 }
 
+HTMLStreamParser::HTMLStreamParser(ContainerNode* root_node) : context_(root_node->GetExecutingContext()) {
+  root_node->RemoveChildren();
+  open_elements_.emplace_back(std::make_unique<HTMLOpenElement>(root_node));
+}
+
+HTMLStreamParser::~HTMLStreamParser() = default;
+
+void HTMLStreamParser::Feed(const char* chunk, size_t length) {
+  if (open_elements_.empty())
+    return;
+  blank_ = blank_ && IsBlank(chunk, length);
+  size_t offset = pending_.size();
+  pending_.append(chunk, length);
+  if (MayCompleteNode(offset)) {
+    Parse(false);
+  }
+}
+
+void HTMLStreamParser::Finish() {
+  if (open_elements_.empty())
+    return;
+  if (!blank_) {
+    Parse(true);
+  }
+  pending_.clear();
+  open_elements_.clear();
+}
+
+// Whether the input received from |offset| on may complete a node. Until a tag starts or ends, the input left by the
+// previous chunk stays text, a partial tag or a comment, and a held back raw text element needs its end tag.
+bool HTMLStreamParser::MayCompleteNode(size_t offset) const {
+  if (awaited_end_tag_.empty())
+    return pending_.find_first_of("<>", offset) != std::string::npos;
+
+  // The previous chunk may end inside the end tag.
+  offset = offset > awaited_end_tag_.size() ? offset - awaited_end_tag_.size() : 0;
+  return std::search(pending_.begin() + offset, pending_.end(), awaited_end_tag_.begin(), awaited_end_tag_.end(),
+                     [](char c, char lower) { return std::tolower(static_cast<unsigned char>(c)) == lower; }) !=
+         pending_.end();
+}
+
+void HTMLStreamParser::Parse(bool is_final) {
+  auto* profiler = context_->dartIsolateContext()->profiler();
+  profiler->StartTrackSteps("HTMLStreamParser::parse");
+
+  std::string input = doctype_;
+  for (size_t i = 1; i < open_elements_.size(); ++i) {
+    open_elements_[i]->offset = input.size();
+    input += open_elements_[i]->markup;
+  }
+  size_t reopened_length = input.size();
+  input += pending_;
+  GumboOutput* html_tree = gumbo_parse_with_options(&kGumboDefaultOptions, input.data(), input.size());
+
+  // Gumbo drops a partial tag, the input ends where it starts.
+  size_t end = SIZE_MAX;
+  GumboNode* held = nullptr;
+  if (!is_final) {
+    end = html_tree->root->v.element.end_pos.offset;
+    held = FindHeldNode(html_tree->document, end);
+    if (held != nullptr) {
+      end = SourceOffset(held);
+    }
+  }
+  awaited_end_tag_.clear();
+  if (held != nullptr && held->type != GUMBO_NODE_TEXT && held->type != GUMBO_NODE_WHITESPACE &&
+      held->type != GUMBO_NODE_COMMENT && held->type != GUMBO_NODE_CDATA) {
+    awaited_end_tag_ = std::string("</") + gumbo_normalized_tagname(held->v.element.tag);
+  }
+
+  profiler->FinishTrackSteps();
+  // The input left is parsed again behind the same open elements, tokens gumbo ignored or merged keep their effect.
+  if (!is_final && !HasNodeBetween(html_tree->document, reopened_length, end)) {
+    gumbo_destroy_output(&kGumboDefaultOptions, html_tree);
+    return;
+  }
+
+  profiler->StartTrackSteps("HTMLStreamParser::build");
+  open_elements_ = HTMLTreeBuilder(context_).Sync(open_elements_, html_tree->root, reopened_length, end);
+  switch (html_tree->document->v.document.doc_type_quirks_mode) {
+    case GUMBO_DOCTYPE_NO_QUIRKS:
+      doctype_ = "<!DOCTYPE html>";
+      break;
+    case GUMBO_DOCTYPE_LIMITED_QUIRKS:
+      doctype_ = "<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.0 Transitional//\">";
+      break;
+    case GUMBO_DOCTYPE_QUIRKS:
+      doctype_.clear();
+      break;
+  }
+  pending_.erase(0, std::min(end, input.size()) - reopened_length);
+  gumbo_destroy_output(&kGumboDefaultOptions, html_tree);
+  profiler->FinishTrackSteps();
+}
+
 void HTMLParser::freeSVGResult(GumboOutput* svgTree) {
   gumbo_destroy_output(&kGumboDefaultOptions, svgTree);
 }
@@ -209,9 +658,8 @@ void HTMLParser::parseProperty(Element* element, GumboElement* gumboElement) {
   for (int j = 0; j < attributes->length; ++j) {
     auto* attribute = (GumboAttribute*)attributes->data[j];
 
-    std::string strName = attribute->name;
-    std::string strValue = attribute->value;
-    element->setAttribute(AtomicString(ctx, strName), AtomicString(ctx, strValue), ASSERT_NO_EXCEPTION());
+    element->setAttribute(AtomicString(ctx, attribute->name, strlen(attribute->name)),
+                          AtomicString(ctx, attribute->value, strlen(attribute->value)), ASSERT_NO_EXCEPTION());
   }
 }
 
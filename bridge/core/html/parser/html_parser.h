@@ -6,16 +6,18 @@
 #define BRIDGE_HTML_PARSER_H
 
 #include <third_party/gumbo-parser/src/gumbo.h>
+#include <memory>
 #include <string>
+#include <vector>
 #include "foundation/native_string.h"
 
 namespace webf {
 
 class Node;
+class ContainerNode;
 class Element;
 class ExecutingContext;
-
-std::string trim(const std::string& str);
+struct HTMLOpenElement;
 
 class HTMLParser {
  public:
@@ -28,10 +30,45 @@ class HTMLParser {
 
  private:
   ExecutingContext* context_;
-  static void traverseHTML(Node* root, GumboNode* node);
   static void parseProperty(Element* element, GumboElement* gumboElement);
 
-  static bool parseHTML(const std::string& html, Node* rootNode, bool isHTMLFragment);
+  static bool parseHTML(const char* code, size_t length, Node* rootNode, bool isHTMLFragment);
+};
+
+// Parses a document which arrives in chunks. The nodes each chunk completes are appended to the root and sent to dart
+// before the next chunk is fed, elements which may still receive children stay open until Finish().
+//
+// Gumbo can't suspend, so the input no node was built from is parsed again with the next chunk, behind the start tags
+// of the open elements which put gumbo back where the previous chunk left off. Text which may continue, a partial tag
+// and an unterminated <script> or other raw text element are left for the chunks to come.
+//
+// Error recovery which depends on more than the open elements, like reconstructing a formatting element closed before
+// the chunk boundary, places nodes as if the document started there. Text foster parented out of a <table> built by a
+// previous chunk is appended after it.
+class HTMLStreamParser {
+ public:
+  explicit HTMLStreamParser(ContainerNode* root_node);
+  ~HTMLStreamParser();
+
+  void Feed(const char* chunk, size_t length);
+  // Builds everything left, the parser can't be fed anymore.
+  void Finish();
+
+ private:
+  bool MayCompleteNode(size_t offset) const;
+  void Parse(bool is_final);
+
+  ExecutingContext* context_;
+  // The input no node was built from yet.
+  std::string pending_;
+  // The root followed by the elements the next chunk continues in.
+  std::vector<std::unique_ptr<HTMLOpenElement>> open_elements_;
+  // Puts gumbo in the quirks mode of the document in front of the open elements.
+  std::string doctype_;
+  // Start of the end tag of the raw text element |pending_| ends with, no node is complete before it arrives.
+  std::string awaited_end_tag_;
+  // Like parseHTML(), nothing is built for a blank document.
+  bool blank_{true};
 };
 }  // namespace webf
 
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+TEST(HTMLStreamParser, chunksAreBuiltIncrementally) {
+  bool static errorCalled = false;
+  static std::vector<std::string> logs;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logs.emplace_back(message);
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto* page = env->page();
+  const char* code =
+      "var a = document.getElementById('a'), p = document.querySelector('p');"
+      "console.log(JSON.stringify([document.head.firstChild.textContent, a && a.textContent,"
+      "  !!document.querySelector('script'), p && p.textContent]));";
+  auto feed = [page](const char* chunk) { page->parseHTMLChunk(chunk, strlen(chunk)); };
+
+  page->parseHTMLBegin();
+  feed("<html><head><title>t</title></head><body class=\"b\"><div id=\"a\">hel");
+  page->evaluateScript(code, strlen(code), "vm://", 0);
+  // The script is held back until its end tag arrives.
+  feed("lo</div><script>var s = '</di");
+  page->evaluateScript(code, strlen(code), "vm://", 0);
+  // The text at the end of the chunk may continue in the next one.
+  feed("v>';</script><p>x");
+  page->evaluateScript(code, strlen(code), "vm://", 0);
+  page->parseHTMLEnd();
+  page->evaluateScript(code, strlen(code), "vm://", 0);
+
+  const char* check = "console.log(document.body.className, document.body.childNodes.length)";
+  page->evaluateScript(check, strlen(check), "vm://", 0);
+
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logs, (std::vector<std::string>{R"(["t","",false,null])", R"(["t","hello",false,null])",
+                                            R"(["t","hello",true,""])", R"(["t","hello",true,"x"])", "b 3"}));
+}
+
+TEST(HTMLStreamParser, chunkBoundariesInsideTextAndTags) {
+  bool static errorCalled = false;
+  static std::vector<std::string> logs;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logs.emplace_back(message);
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto* page = env->page();
+  const char* code =
+      "var a = document.getElementById('a'), span = document.querySelector('span');"
+      "console.log(JSON.stringify([a.childNodes.length, a.textContent, span && span.title]));";
+  auto feed = [page](const char* chunk) { page->parseHTMLChunk(chunk, strlen(chunk)); };
+
+  page->parseHTMLBegin();
+  feed("<div id=\"a\">hel");
+  feed("lo wor");
+  page->evaluateScript(code, strlen(code), "vm://", 0);
+  feed("ld<sp");
+  feed("an title=\"x>");
+  page->evaluateScript(code, strlen(code), "vm://", 0);
+  feed("y\">t</span></d");
+  page->evaluateScript(code, strlen(code), "vm://", 0);
+  feed("iv>");
+  page->parseHTMLEnd();
+  page->evaluateScript(code, strlen(code), "vm://", 0);
+
+  EXPECT_EQ(errorCalled, false);
+  // The text waits for the tag after it, which ends after the quoted '>'.
+  EXPECT_EQ(logs, (std::vector<std::string>{"[0,\"\",null]", "[0,\"\",null]", "[2,\"hello worldt\",\"x>y\"]",
+                                            "[2,\"hello worldt\",\"x>y\"]"}));
+}
+
+TEST(HTMLStreamParser, textAfterAnIgnoredEndTagIsKept) {
+  bool static errorCalled = false;
+  static std::vector<std::string> logs;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logs.emplace_back(message);
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto* page = env->page();
+  auto feed = [page](const char* chunk) { page->parseHTMLChunk(chunk, strlen(chunk)); };
+
+  page->parseHTMLBegin();
+  feed("<p>abc</foo>");
+  feed("def");
+  page->parseHTMLEnd();
+
+  const char* code = "var p = document.querySelector('p'); console.log(p.childNodes.length, p.textContent)";
+  page->evaluateScript(code, strlen(code), "vm://", 0);
+
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logs, (std::vector<std::string>{"1 abcdef"}));
+}
@@ -61,6 +61,47 @@ bool WebFPage::parseHTML(const char* code, size_t length) {
   return true;
 }
 
+bool WebFPage::parseHTMLBegin() {
+  if (!context_->IsContextValid())
+    return false;
+
+  MemberMutationScope scope{context_};
+  auto document_element = context_->document()->documentElement();
+  if (!document_element) {
+    return false;
+  }
+  html_stream_parser_ = std::make_unique<HTMLStreamParser>(document_element);
+  return true;
+}
+
+bool WebFPage::parseHTMLChunk(const char* code, size_t length) {
+  if (!context_->IsContextValid() || html_stream_parser_ == nullptr)
+    return false;
+
+  {
+    MemberMutationScope scope{context_};
+    html_stream_parser_->Feed(code, length);
+  }
+
+  // Scripts of the chunk run once dart received the nodes, before the next chunk is parsed.
+  context_->uiCommandBuffer()->AddCommand(UICommand::kFinishRecordingCommand, nullptr, nullptr, nullptr);
+  return true;
+}
+
+bool WebFPage::parseHTMLEnd() {
+  if (!context_->IsContextValid() || html_stream_parser_ == nullptr)
+    return false;
+
+  {
+    MemberMutationScope scope{context_};
+    html_stream_parser_->Finish();
+    html_stream_parser_ = nullptr;
+  }
+
+  context_->uiCommandBuffer()->AddCommand(UICommand::kFinishRecordingCommand, nullptr, nullptr, nullptr);
+  return true;
+}
+
 NativeValue* WebFPage::invokeModuleEvent(SharedNativeString* native_module_name,
                                          const char* eventType,
                                          void* ptr,
@@ -70,6 +111,8 @@ NativeValue* WebFPage::invokeModuleEvent(SharedNativeString* native_module_name,
 
   MemberMutationScope scope{context_};
 
+  context_->uiCommandBuffer()->BumpLayoutEpoch();
+
   JSContext* ctx = context_->ctx();
   Event* event = nullptr;
   if (ptr != nullptr) {
@@ -166,6 +209,8 @@ WebFPage::~WebFPage() {
     disposeCallback(this);
   }
 #endif
+  // Releases the elements the parser kept alive.
+  html_stream_parser_ = nullptr;
   delete context_;
 }
 
@@ -257,6 +302,49 @@ void WebFPage::ParseHTMLInternal(void* page_,
                                                        result_callback);
 }
 
+void WebFPage::ParseHTMLBeginInternal(void* page_) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  page->parseHTMLBegin();
+}
+
+void WebFPage::ParseHTMLChunkInternal(void* page_,
+                                      char* code,
+                                      int32_t length,
+                                      int64_t profile_id,
+                                      Dart_PersistentHandle dart_handle,
+                                      ParseHTMLCallback result_callback) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+
+  page->dartIsolateContext()->profiler()->StartTrackEvaluation(profile_id);
+
+  page->parseHTMLChunk(code, length);
+  dart_free(code);
+
+  page->dartIsolateContext()->profiler()->FinishTrackEvaluation(profile_id);
+
+  page->dartIsolateContext()->dispatcher()->PostToDart(page->isDedicated(), ReturnParseHTMLToDart, dart_handle,
+                                                       result_callback);
+}
+
+void WebFPage::ParseHTMLEndInternal(void* page_,
+                                    int64_t profile_id,
+                                    Dart_PersistentHandle dart_handle,
+                                    ParseHTMLCallback result_callback) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+
+  page->dartIsolateContext()->profiler()->StartTrackEvaluation(profile_id);
+
+  page->parseHTMLEnd();
+
+  page->dartIsolateContext()->profiler()->FinishTrackEvaluation(profile_id);
+
+  page->dartIsolateContext()->dispatcher()->PostToDart(page->isDedicated(), ReturnParseHTMLToDart, dart_handle,
+                                                       result_callback);
+}
+
 static void ReturnInvokeEventResultToDart(Dart_Handle persistent_handle,
                                           InvokeModuleEventCallback result_callback,
                                           webf::NativeValue* result) {
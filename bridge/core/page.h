@@ -9,6 +9,7 @@
 #include <quickjs/quickjs.h>
 #include <atomic>
 #include <deque>
+#include <memory>
 #include <thread>
 #include <vector>
 
@@ -19,6 +20,7 @@ namespace webf {
 
 class WebFPage;
 class DartContext;
+class HTMLStreamParser;
 
 using JSBridgeDisposeCallback = void (*)(WebFPage* bridge);
 using ConsoleMessageHandler = std::function<void(void* ctx, const std::string& message, int logLevel)>;
@@ -64,6 +66,17 @@ class WebFPage final {
                                 int64_t profile_id,
                                 Dart_PersistentHandle dart_handle,
                                 ParseHTMLCallback result_callback);
+  static void ParseHTMLBeginInternal(void* page_);
+  static void ParseHTMLChunkInternal(void* page_,
+                                     char* code,
+                                     int32_t length,
+                                     int64_t profile_id,
+                                     Dart_PersistentHandle dart_handle,
+                                     ParseHTMLCallback result_callback);
+  static void ParseHTMLEndInternal(void* page_,
+                                   int64_t profile_id,
+                                   Dart_PersistentHandle dart_handle,
+                                   ParseHTMLCallback result_callback);
 
   static void InvokeModuleEventInternal(void* page_,
                                         void* module_name,
@@ -91,6 +104,10 @@ class WebFPage final {
                       const char* url,
                       int startLine);
   bool parseHTML(const char* code, size_t length);
+  // Parse a document received in chunks, the nodes of each chunk are flushed to dart before the next one.
+  bool parseHTMLBegin();
+  bool parseHTMLChunk(const char* code, size_t length);
+  bool parseHTMLEnd();
   void evaluateScript(const char* script, size_t length, const char* url, int startLine);
   uint8_t* dumpByteCode(const char* script, size_t length, const char* url, uint64_t* byteLength);
   bool evaluateByteCode(uint8_t* bytes, size_t byteLength);
@@ -122,6 +139,7 @@ class WebFPage final {
   DartIsolateContext* dart_isolate_context_;
   ExecutingContext* context_;
   JSExceptionHandler handler_;
+  std::unique_ptr<HTMLStreamParser> html_stream_parser_;
 };
 
 }  // namespace webf
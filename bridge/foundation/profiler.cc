@@ -4,6 +4,9 @@
  */
 
 #include "profiler.h"
+#include <atomic>
+#include <cstdio>
+#include <thread>
 #include "bindings/qjs/exception_state.h"
 #include "core/executing_context.h"
 #include "foundation/macros.h"
@@ -14,6 +17,11 @@
 namespace webf {
 
 static int64_t unique_profile_step_id_ = 0;
+static std::atomic<uint64_t> unique_profiler_id_{1};
+// Records kept for each thread, 24 bytes each.
+static constexpr size_t kTraceRingCapacity = 1 << 16;
+// Rings cached by each thread, a power of two.
+static constexpr size_t kCachedTraceRings = 4;
 
 ProfileStep::ProfileStep(ProfileOpItem* owner, std::string label)
     : owner_(owner), label_(std::move(label)), id_(unique_profile_step_id_++) {
@@ -111,7 +119,7 @@ ScriptValue ProfileOpItem::ToJSON(JSContext* ctx, const std::string& path, bool
   return result;
 }
 
-WebFProfiler::WebFProfiler(bool enable) : enabled_(enable) {}
+WebFProfiler::WebFProfiler(bool enable) : enabled_(enable), id_(unique_profiler_id_++) {}
 
 void WebFProfiler::StartTrackInitialize() {
   if (UNLIKELY(enabled_)) {
@@ -162,7 +170,7 @@ void WebFProfiler::FinishTrackAsyncEvaluation() {
   }
 }
 
-void WebFProfiler::StartTrackSteps(const std::string& label) {
+void WebFProfiler::StartTrackSteps(const char* label) {
   if (UNLIKELY(enabled_)) {
     assert_m(!profile_stacks_.empty(), "Tracks not started");
 
@@ -180,7 +188,7 @@ void WebFProfiler::FinishTrackSteps() {
   }
 }
 
-void WebFProfiler::StartTrackLinkSteps(const std::string& label) {
+void WebFProfiler::StartTrackLinkSteps(const char* label) {
   if (UNLIKELY(enabled_)) {
     auto&& current_profile = profile_stacks_.top();
 
@@ -198,6 +206,54 @@ void WebFProfiler::FinishTrackLinkSteps() {
   }
 }
 
+TraceRing* WebFProfiler::CurrentThreadTraceRing() {
+  // Keyed by the profiler id, the address of a destroyed profiler may be reused. A thread recording for a few
+  // profilers in turn keeps each of their rings cached.
+  struct CachedTraceRing {
+    uint64_t profiler_id;
+    TraceRing* ring;
+  };
+  thread_local CachedTraceRing cached_rings[kCachedTraceRings] = {};
+  CachedTraceRing& cached = cached_rings[id_ & (kCachedTraceRings - 1)];
+  if (cached.profiler_id == id_)
+    return cached.ring;
+
+  std::lock_guard<std::mutex> lock(trace_rings_mutex_);
+  TraceRing*& ring = thread_trace_rings_[std::this_thread::get_id()];
+  if (ring == nullptr) {
+    auto index = static_cast<int32_t>(trace_rings_.size());
+    ring = trace_rings_.emplace_back(std::make_unique<TraceRing>(kTraceRingCapacity, index)).get();
+  }
+  cached = CachedTraceRing{id_, ring};
+  return ring;
+}
+
+std::string WebFProfiler::TraceEventsToJSON() {
+  std::string result = "[";
+  char buffer[256];
+  std::lock_guard<std::mutex> lock(trace_rings_mutex_);
+  for (auto&& ring : trace_rings_) {
+    for (const TraceRecord& record : ring->Snapshot()) {
+      const char* name = TraceLabelName(record.label_id);
+      if (result.size() > 1) {
+        result += ',';
+      }
+      result += "{\"name\":\"";
+      if (name != nullptr) {
+        result += name;
+      } else {
+        snprintf(buffer, sizeof(buffer), "0x%016llx", static_cast<unsigned long long>(record.label_id));
+        result += buffer;
+      }
+      snprintf(buffer, sizeof(buffer), R"(","cat":"webf","ph":"X","ts":%.3f,"dur":%.3f,"pid":0,"tid":%d})",
+               record.start_ns / 1000.0, (record.end_ns - record.start_ns) / 1000.0, ring->thread_index());
+      result += buffer;
+    }
+  }
+  result += ']';
+  return result;
+}
+
 std::string WebFProfiler::ToJSON() {
   JSRuntime* runtime = JS_NewRuntime();
   JSContext* ctx = JS_NewContext(runtime);
@@ -245,6 +301,12 @@ std::string WebFProfiler::ToJSON() {
       JS_SetPropertyStr(ctx, object, "link", link_path_object);
     }
 
+    {
+      std::string trace_events = TraceEventsToJSON();
+      JS_SetPropertyStr(ctx, object, "traceEvents",
+                        JS_ParseJSON(ctx, trace_events.c_str(), trace_events.size(), "traceEvents"));
+    }
+
     ExceptionState exception_state;
     ScriptValue result_value = ScriptValue(ctx, object).ToJSONStringify(ctx, &exception_state);
 
@@ -265,6 +327,11 @@ void WebFProfiler::clear() {
   link_paths_.clear();
   async_evaluate_profile_items.clear();
   evaluate_profile_items_.clear();
+
+  std::lock_guard<std::mutex> lock(trace_rings_mutex_);
+  for (auto&& ring : trace_rings_) {
+    ring->Clear();
+  }
 }
 
 }  // namespace webf
\ No newline at end of file
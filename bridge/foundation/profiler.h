@@ -7,12 +7,15 @@
 #define WEBF_FOUNDATION_PROFILER_H_
 
 #include <memory>
+#include <mutex>
 #include <stack>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 #include "bindings/qjs/script_value.h"
 #include "foundation/stop_watch.h"
+#include "foundation/trace_event.h"
 
 namespace webf {
 
@@ -88,12 +91,16 @@ class WebFProfiler {
   void StartTrackAsyncEvaluation();
   void FinishTrackAsyncEvaluation();
 
-  void StartTrackSteps(const std::string& label);
+  void StartTrackSteps(const char* label);
   void FinishTrackSteps();
 
-  void StartTrackLinkSteps(const std::string& label);
+  void StartTrackLinkSteps(const char* label);
   void FinishTrackLinkSteps();
 
+  FORCE_INLINE bool enabled() const { return enabled_; }
+  // The ring TraceScope records to on the calling thread.
+  TraceRing* CurrentThreadTraceRing();
+
   int64_t link_id() {
     if (UNLIKELY(enabled_)) {
       return profile_stacks_.top()->current_step()->id();
@@ -101,11 +108,18 @@ class WebFProfiler {
     return 0;
   }
 
+  // Also carries the trace rings as Chrome trace events, under "traceEvents".
   std::string ToJSON();
   void clear();
 
  private:
+  std::string TraceEventsToJSON();
+
   bool enabled_{false};
+  uint64_t id_;
+  std::mutex trace_rings_mutex_;
+  std::vector<std::unique_ptr<TraceRing>> trace_rings_;
+  std::unordered_map<std::thread::id, TraceRing*> thread_trace_rings_;
   std::stack<std::shared_ptr<ProfileOpItem>> profile_stacks_;
   std::vector<std::shared_ptr<ProfileOpItem>> initialize_profile_items_;
   std::unordered_map<int64_t, std::string> link_paths_;
@@ -117,6 +131,32 @@ class WebFProfiler {
   friend LinkProfileStep;
 };
 
+// A tracepoint for the duration of a scope, recorded to the trace ring of the current thread. It costs a branch when
+// profiling is disabled.
+//
+//   TraceScope trace_scope(profiler, WEBF_TRACE_LABEL("Element::getAttribute"));
+class TraceScope {
+ public:
+  FORCE_INLINE TraceScope(WebFProfiler* profiler, uint64_t label_id) {
+    if (UNLIKELY(profiler->enabled())) {
+      ring_ = profiler->CurrentThreadTraceRing();
+      label_id_ = label_id;
+      start_ns_ = TraceClockNow();
+    }
+  }
+  FORCE_INLINE ~TraceScope() {
+    if (UNLIKELY(ring_ != nullptr)) {
+      ring_->Add(label_id_, start_ns_, TraceClockNow());
+    }
+  }
+  WEBF_DISALLOW_COPY_ASSIGN_AND_MOVE(TraceScope);
+
+ private:
+  TraceRing* ring_{nullptr};
+  uint64_t label_id_{0};
+  int64_t start_ns_{0};
+};
+
 }  // namespace webf
 
 #endif  // WEBF_FOUNDATION_PROFILER_H_
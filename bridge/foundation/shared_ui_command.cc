@@ -9,19 +9,53 @@
 
 namespace webf {
 
+static bool IsSubtreeConstructionCommand(UICommand type) {
+  switch (type) {
+    case UICommand::kCreateElement:
+    case UICommand::kCreateTextNode:
+    case UICommand::kCreateSVGElement:
+    case UICommand::kCreateElementNS:
+    case UICommand::kInsertAdjacentNode:
+    case UICommand::kSetAttribute:
+    case UICommand::kSetStyle:
+    case UICommand::kSetStyleById:
+    case UICommand::kClearStyle:
+      return true;
+    default:
+      return false;
+  }
+}
+
 SharedUICommand::SharedUICommand(ExecutingContext* context)
     : context_(context),
       active_buffer(std::make_unique<UICommandBuffer>(context)),
       reserve_buffer_(std::make_unique<UICommandBuffer>(context)),
       waiting_buffer_(std::make_unique<UICommandBuffer>(context)),
-      ui_command_sync_strategy_(std::make_unique<UICommandSyncStrategy>(this)),
-      is_blocking_writing_(false) {}
+      ring_buffer_(context),
+      ui_command_sync_strategy_(std::make_unique<UICommandSyncStrategy>(this)) {}
 
 void SharedUICommand::AddCommand(UICommand type,
                                  std::unique_ptr<SharedNativeString>&& args_01,
                                  NativeBindingObject* native_binding_object,
                                  void* nativePtr2,
                                  bool request_ui_update) {
+  if (UNLIKELY(subtree_construction_depth_ > 0) && IsSubtreeConstructionCommand(type)) {
+    UICommandCoalescer::FreePayload(
+        UICommandItem{static_cast<int32_t>(type), args_01.get(), native_binding_object, nativePtr2});
+    return;
+  }
+
+  // Recorded canvas calls must reach dart before any command added after them.
+  if (type != UICommand::kCanvasDisplayList) {
+    context_->canvasDisplayList()->Commit();
+  }
+
+  if (type == UICommand::kFinishRecordingCommand ||
+      (GetKindFromUICommand(type) & (UICommandKind::kNodeCreation | UICommandKind::kNodeMutation |
+                                     UICommandKind::kStyleUpdate | UICommandKind::kAttributeUpdate)) != 0) {
+    layout_epoch_++;
+  }
+
   if (!context_->isDedicated()) {
     active_buffer->addCommand(type, std::move(args_01), native_binding_object, nativePtr2, request_ui_update);
     if (type == UICommand::kFinishRecordingCommand && active_buffer->size() > 0) {
@@ -44,33 +78,48 @@ void SharedUICommand::AddCommand(UICommand type,
 }
 
 // first called by dart to being read commands.
+// In dedicated mode, each call pair of data() and clear() consumes one published segment. Dart keeps reading until
+// size() returns 0.
 void* SharedUICommand::data() {
-  // simply spin wait for the swapBuffers to finish.
-  while (is_blocking_writing_.load(std::memory_order::memory_order_acquire)) {
+  if (!context_->isDedicated()) {
+    return active_buffer->data();
   }
 
-  return active_buffer->data();
+  UICommandBuffer* segment = ring_buffer_.Front();
+  return segment != nullptr ? segment->data() : nullptr;
 }
 
 uint32_t SharedUICommand::kindFlag() {
-  // simply spin wait for the swapBuffers to finish.
-  while (is_blocking_writing_.load(std::memory_order::memory_order_acquire)) {
+  if (!context_->isDedicated()) {
+    return active_buffer->kindFlag();
   }
 
-  return active_buffer->kindFlag();
+  UICommandBuffer* segment = ring_buffer_.Front();
+  return segment != nullptr ? segment->kindFlag() : 0;
 }
 
 // second called by dart to get the size of commands.
 int64_t SharedUICommand::size() {
-  return active_buffer->size();
+  if (!context_->isDedicated()) {
+    return active_buffer->size();
+  }
+
+  UICommandBuffer* segment = ring_buffer_.Front();
+  return segment != nullptr ? segment->size() : 0;
 }
 
 // third called by dart to clear commands.
 void SharedUICommand::clear() {
-  // simply spin wait for the swapBuffers to finish.
-  while (is_blocking_writing_.load(std::memory_order::memory_order_acquire)) {
+  if (!context_->isDedicated()) {
+    active_buffer->clear();
+    return;
+  }
+
+  // The commands kept in reserve while the ring was full are published by the JS thread now a slot is free.
+  if (ring_buffer_.Pop()) {
+    context_->dartIsolateContext()->dispatcher()->PostToJs(true, static_cast<int32_t>(context_->contextId()),
+                                                           HandleSlotFreed, context_, context_->contextId());
   }
-  active_buffer->clear();
 }
 
 // called by c++ to check if there are commands.
@@ -86,6 +135,10 @@ void SharedUICommand::SyncToReserve() {
   if (waiting_buffer_->empty())
     return;
 
+#if ENABLE_UI_COMMAND_COALESCING
+  coalescer_.Coalesce(*waiting_buffer_);
+#endif
+
   size_t waiting_size = waiting_buffer_->size();
   size_t origin_reserve_size = reserve_buffer_->size();
 
@@ -113,29 +166,37 @@ void SharedUICommand::SyncToActive() {
 
   ui_command_sync_strategy_->Reset();
 
-  size_t reserve_size = reserve_buffer_->size();
-  size_t origin_active_size = active_buffer->size();
-  appendCommand(active_buffer, reserve_buffer_);
-  assert(reserve_buffer_->empty());
-  assert(active_buffer->size() == reserve_size + origin_active_size);
+  // Hand the whole reserve buffer over to the Dart side without copying. When every slot of the ring is still
+  // waiting to be consumed, the commands stay in reserve until the Dart side frees a slot, see HandleSlotFreed().
+  ring_buffer_.Publish(reserve_buffer_);
+}
+
+void SharedUICommand::HandleSlotFreed(ExecutingContext* context, double context_id) {
+  if (!isContextValid(context_id))
+    return;
+
+  SharedUICommand* ui_command_buffer = context->uiCommandBuffer();
+  if (ui_command_buffer->reserve_buffer_->empty())
+    return;
+
+  size_t published_count = ui_command_buffer->ring_buffer_.published_count();
+  ui_command_buffer->SyncToActive();
+  if (ui_command_buffer->ring_buffer_.published_count() != published_count) {
+    context->dartMethodPtr()->requestBatchUpdate(true, context->contextId());
+  }
 }
 
 void SharedUICommand::swap(std::unique_ptr<UICommandBuffer>& target, std::unique_ptr<UICommandBuffer>& original) {
-  is_blocking_writing_.store(true, std::memory_order::memory_order_release);
   std::swap(target, original);
-  is_blocking_writing_.store(false, std::memory_order::memory_order_release);
 }
 
 void SharedUICommand::appendCommand(std::unique_ptr<UICommandBuffer>& target,
                                     std::unique_ptr<UICommandBuffer>& original) {
-  is_blocking_writing_.store(true, std::memory_order::memory_order_release);
-
   UICommandItem* command_item = original->data();
   target->addCommands(command_item, original->size());
+  target->kind_flag |= original->kind_flag;
 
   original->clear();
-
-  is_blocking_writing_.store(false, std::memory_order::memory_order_release);
 }
 
 }  // namespace webf
\ No newline at end of file
@@ -9,6 +9,8 @@
 #include <memory>
 #include "foundation/native_type.h"
 #include "foundation/ui_command_buffer.h"
+#include "foundation/ui_command_coalescer.h"
+#include "foundation/ui_command_ring_buffer.h"
 #include "foundation/ui_command_strategy.h"
 
 namespace webf {
@@ -35,14 +37,33 @@ class SharedUICommand : public DartReadable {
 
   void ConfigureSyncCommandBufferSize(size_t size);
 
+  // Starts a new epoch each time a command which may affect layout is recorded, and each time dart calls back into JS
+  // (timers, animation frames, events, module events) since dart may have laid out the page, resized or scrolled
+  // it in between. Geometry read from dart stays valid until the epoch changes.
+  uint64_t layoutEpoch() const { return layout_epoch_; }
+  void BumpLayoutEpoch() { layout_epoch_++; }
+
+  // While a subtree is under construction, the commands creating its nodes, inserting them and setting their
+  // attributes and styles are dropped. The builder describes the whole subtree with one kInsertSubtree command.
+  void BeginSubtreeConstruction() { subtree_construction_depth_++; }
+  void EndSubtreeConstruction() { subtree_construction_depth_--; }
+
+  // Commands dropped before reaching dart, always zero unless built with ENABLE_UI_COMMAND_COALESCING.
+  const UICommandCoalescingStats& coalescingStats() const { return coalescer_.stats(); }
+
  private:
+  static void HandleSlotFreed(ExecutingContext* context, double context_id);
   void swap(std::unique_ptr<UICommandBuffer>& original, std::unique_ptr<UICommandBuffer>& target);
   void appendCommand(std::unique_ptr<UICommandBuffer>& original, std::unique_ptr<UICommandBuffer>& target);
-  std::unique_ptr<UICommandBuffer> active_buffer = nullptr;    // The ui commands which accessible from Dart side
-  std::unique_ptr<UICommandBuffer> reserve_buffer_ = nullptr;  // The ui commands which are ready to swap to active.
+  std::unique_ptr<UICommandBuffer> active_buffer =
+      nullptr;  // The ui commands which accessible from Dart side when JS runs on the Dart thread.
+  std::unique_ptr<UICommandBuffer> reserve_buffer_ = nullptr;  // The ui commands which are ready to publish to Dart.
   std::unique_ptr<UICommandBuffer> waiting_buffer_ =
       nullptr;  // The ui commands which recorded from JS operations and sync to reserve_buffer by once.
-  std::atomic<bool> is_blocking_writing_;
+  UICommandRingBuffer ring_buffer_;  // The published segments which consumed by the Dart side in dedicated mode.
+  UICommandCoalescer coalescer_;  // Drops redundant commands of the waiting buffer before they are synced.
+  uint64_t layout_epoch_{0};
+  int32_t subtree_construction_depth_{0};
   ExecutingContext* context_;
   std::unique_ptr<UICommandSyncStrategy> ui_command_sync_strategy_ = nullptr;
   friend class UICommandBuffer;
@@ -51,4 +72,4 @@ class SharedUICommand : public DartReadable {
 
 }  // namespace webf
 
-#endif  // MULTI_THREADING_DOUBULE_UI_COMMAND_H_
\ No newline at end of file
+#endif  // MULTI_THREADING_DOUBULE_UI_COMMAND_H_
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "trace_event.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace webf {
+
+namespace {
+
+struct TraceLabelRegistry {
+  std::mutex mutex;
+  std::unordered_map<uint64_t, const char*> names;
+};
+
+TraceLabelRegistry& GetTraceLabelRegistry() {
+  static TraceLabelRegistry registry;
+  return registry;
+}
+
+}  // namespace
+
+TraceLabelRegistrar::TraceLabelRegistrar(std::initializer_list<const char*> labels) {
+  TraceLabelRegistry& registry = GetTraceLabelRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const char* label : labels) {
+    auto result = registry.names.emplace(TraceLabelId(label), label);
+    assert_m(result.second || strcmp(result.first->second, label) == 0, "Trace label ids collide.");
+  }
+}
+
+const char* TraceLabelName(uint64_t label_id) {
+  TraceLabelRegistry& registry = GetTraceLabelRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto it = registry.names.find(label_id);
+  return it != registry.names.end() ? it->second : nullptr;
+}
+
+TraceRing::TraceRing(size_t capacity, int32_t thread_index)
+    : slots_(new Slot[capacity]), mask_(capacity - 1), thread_index_(thread_index) {
+  assert((capacity & (capacity - 1)) == 0);
+}
+
+std::vector<TraceRecord> TraceRing::Snapshot() const {
+  uint64_t capacity = mask_ + 1;
+  uint64_t count = count_.load(std::memory_order_acquire);
+  uint64_t begin = std::max(count > capacity ? count - capacity : 0, cleared_count_.load(std::memory_order_acquire));
+
+  std::vector<TraceRecord> records;
+  records.reserve(count > begin ? count - begin : 0);
+  for (uint64_t i = begin; i < count; i++) {
+    const Slot& slot = slots_[i & mask_];
+    records.emplace_back(TraceRecord{slot.label_id.load(std::memory_order_relaxed),
+                                     slot.start_ns.load(std::memory_order_relaxed),
+                                     slot.end_ns.load(std::memory_order_relaxed)});
+  }
+
+  // Like a seqlock read: the owner may have overwritten the oldest slots meanwhile.
+  std::atomic_thread_fence(std::memory_order_acquire);
+  uint64_t claimed = claimed_count_.load(std::memory_order_relaxed);
+  if (claimed > begin + capacity) {
+    records.erase(records.begin(), records.begin() + std::min<uint64_t>(claimed - begin - capacity, records.size()));
+  }
+  return records;
+}
+
+}  // namespace webf
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef WEBF_FOUNDATION_TRACE_EVENT_H_
+#define WEBF_FOUNDATION_TRACE_EVENT_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "foundation/macros.h"
+
+namespace webf {
+
+// FNV-1a hash of a tracepoint label.
+constexpr uint64_t TraceLabelId(const char* label) {
+  uint64_t hash = 14695981039346656037ull;
+  for (; *label != '\0'; ++label) {
+    hash ^= static_cast<uint8_t>(*label);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+// The id of a label, computed at compile time.
+#define WEBF_TRACE_LABEL(label) std::integral_constant<uint64_t, ::webf::TraceLabelId(label)>::value
+
+// Makes the names of labels known to the exported traces, declared at namespace scope by every file with
+// tracepoints.
+class TraceLabelRegistrar {
+ public:
+  TraceLabelRegistrar(std::initializer_list<const char*> labels);
+};
+
+// Returns nullptr for a label no registrar declared.
+const char* TraceLabelName(uint64_t label_id);
+
+FORCE_INLINE int64_t TraceClockNow() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+struct TraceRecord {
+  uint64_t label_id;
+  int64_t start_ns;
+  int64_t end_ns;
+};
+
+// Fixed size ring of the trace records of one thread, the oldest records are overwritten once it's full.
+// Only the owner thread adds records. Snapshot() and Clear() may run on other threads; a snapshot drops the records
+// the owner overwrote while they were copied.
+class TraceRing {
+ public:
+  // |capacity| must be a power of two.
+  TraceRing(size_t capacity, int32_t thread_index);
+  WEBF_DISALLOW_COPY_ASSIGN_AND_MOVE(TraceRing);
+
+  FORCE_INLINE void Add(uint64_t label_id, int64_t start_ns, int64_t end_ns) {
+    uint64_t count = count_.load(std::memory_order_relaxed);
+    claimed_count_.store(count + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    Slot& slot = slots_[count & mask_];
+    slot.label_id.store(label_id, std::memory_order_relaxed);
+    slot.start_ns.store(start_ns, std::memory_order_relaxed);
+    slot.end_ns.store(end_ns, std::memory_order_relaxed);
+    count_.store(count + 1, std::memory_order_release);
+  }
+
+  // The records kept, oldest first.
+  std::vector<TraceRecord> Snapshot() const;
+  // Drops the records added so far. Only the owner writes |count_|, so it may keep adding meanwhile.
+  void Clear() { cleared_count_.store(count_.load(std::memory_order_acquire), std::memory_order_release); }
+
+  int32_t thread_index() const { return thread_index_; }
+
+ private:
+  // Relaxed atomics, so a slot being overwritten can be read without a data race.
+  struct Slot {
+    std::atomic<uint64_t> label_id{0};
+    std::atomic<int64_t> start_ns{0};
+    std::atomic<int64_t> end_ns{0};
+  };
+
+  std::unique_ptr<Slot[]> slots_;
+  uint64_t mask_;
+  std::atomic<uint64_t> count_{0};
+  // Ahead of |count_| while the owner writes a slot.
+  std::atomic<uint64_t> claimed_count_{0};
+  // Records before this count were cleared.
+  std::atomic<uint64_t> cleared_count_{0};
+  int32_t thread_index_;
+};
+
+}  // namespace webf
+
+#endif  // WEBF_FOUNDATION_TRACE_EVENT_H_
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "trace_event.h"
+#include <thread>
+#include "gtest/gtest.h"
+#include "profiler.h"
+
+using namespace webf;
+
+static TraceLabelRegistrar trace_label_registrar{"TraceEvent::scope"};
+
+TEST(TraceEvent, ringKeepsTheLatestRecords) {
+  TraceRing ring(4, 0);
+  for (int i = 0; i < 6; i++) {
+    ring.Add(i, i * 10, i * 10 + 5);
+  }
+
+  std::vector<TraceRecord> records = ring.Snapshot();
+  ASSERT_EQ(records.size(), 4);
+  EXPECT_EQ(records.front().label_id, 2);
+  EXPECT_EQ(records.back().label_id, 5);
+
+  ring.Clear();
+  EXPECT_EQ(ring.Snapshot().size(), 0);
+}
+
+TEST(TraceEvent, snapshotsWhileRecordingKeepWholeRecords) {
+  TraceRing ring(4, 0);
+  std::atomic<bool> done{false};
+  std::thread writer([&]() {
+    for (int64_t i = 0; i < 1000000; i++) {
+      ring.Add(i, i, i);
+    }
+    done = true;
+  });
+
+  while (!done) {
+    std::vector<TraceRecord> records = ring.Snapshot();
+    for (size_t i = 0; i < records.size(); i++) {
+      ASSERT_EQ(records[i].start_ns, records[i].label_id);
+      ASSERT_EQ(records[i].end_ns, records[i].label_id);
+      ASSERT_EQ(records[i].label_id, records[0].label_id + i);
+    }
+    ring.Clear();
+  }
+  writer.join();
+
+  ring.Clear();
+  ring.Add(1, 1, 1);
+  EXPECT_EQ(ring.Snapshot().size(), 1);
+}
+
+TEST(TraceEvent, scopesAreExportedAsChromeTraceEvents) {
+  WebFProfiler disabled(false);
+  { TraceScope trace_scope(&disabled, WEBF_TRACE_LABEL("TraceEvent::scope")); }
+  EXPECT_EQ(disabled.ToJSON().find("TraceEvent::scope"), std::string::npos);
+
+  WebFProfiler profiler(true);
+  { TraceScope trace_scope(&profiler, WEBF_TRACE_LABEL("TraceEvent::scope")); }
+  std::string json = profiler.ToJSON();
+  EXPECT_NE(json.find(R"("traceEvents":[{"name":"TraceEvent::scope","cat":"webf","ph":"X")"), std::string::npos);
+
+  profiler.clear();
+  EXPECT_NE(profiler.ToJSON().find(R"("traceEvents":[])"), std::string::npos);
+}
+
+TEST(TraceEvent, threadAlternatingProfilersKeepsOneRingEach) {
+  WebFProfiler first(true);
+  WebFProfiler second(true);
+  for (int i = 0; i < 8; i++) {
+    { TraceScope trace_scope(&first, WEBF_TRACE_LABEL("TraceEvent::scope")); }
+    { TraceScope trace_scope(&second, WEBF_TRACE_LABEL("TraceEvent::scope")); }
+  }
+  EXPECT_EQ(first.CurrentThreadTraceRing(), first.CurrentThreadTraceRing());
+  EXPECT_EQ(first.CurrentThreadTraceRing()->Snapshot().size(), 8);
+  EXPECT_EQ(second.CurrentThreadTraceRing()->Snapshot().size(), 8);
+  EXPECT_EQ(first.ToJSON().find(R"("tid":1)"), std::string::npos);
+}
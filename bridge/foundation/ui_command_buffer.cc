@@ -25,11 +25,13 @@ UICommandKind GetKindFromUICommand(UICommand command) {
     case UICommand::kCloneNode:
       return UICommandKind::kNodeCreation;
     case UICommand::kInsertAdjacentNode:
+    case UICommand::kInsertSubtree:
       return UICommandKind::kNodeMutation;
     case UICommand::kAddEvent:
     case UICommand::kRemoveEvent:
       return UICommandKind::kEvent;
     case UICommand::kSetStyle:
+    case UICommand::kSetStyleById:
     case UICommand::kClearStyle:
       return UICommandKind::kStyleUpdate;
     case UICommand::kSetAttribute:
@@ -37,6 +39,8 @@ UICommandKind GetKindFromUICommand(UICommand command) {
       return UICommandKind::kAttributeUpdate;
     case UICommand::kDisposeBindingObject:
       return UICommandKind::kDisposeBindingObject;
+    case UICommand::kCanvasDisplayList:
+      return UICommandKind::kCanvasUpdate;
     case UICommand::kStartRecordingCommand:
     case UICommand::kFinishRecordingCommand:
       return UICommandKind::kOperation;
@@ -21,7 +21,8 @@ enum UICommandKind : uint32_t {
   kAttributeUpdate = 1 << 5,
   kDisposeBindingObject = 1 << 6,
   kOperation = 1 << 7,
-  kUknownCommand = 1 << 8
+  kUknownCommand = 1 << 8,
+  kCanvasUpdate = 1 << 9
 };
 
 enum class UICommand {
@@ -44,6 +45,11 @@ enum class UICommand {
   kCreateDocumentFragment,
   kCreateSVGElement,
   kCreateElementNS,
+  // Same as kSetStyle, but nativePtr2 carries the CSSPropertyID and args_01 the value.
+  kSetStyleById,
+  kCanvasDisplayList,
+  // Creates and attaches a whole subtree under nativePtr, nativePtr2 points to a NativeSubtreeStream.
+  kInsertSubtree,
   kFinishRecordingCommand,
 };
 
@@ -94,6 +100,7 @@ class UICommandBuffer {
   int64_t size_{0};
   int64_t max_size_{MAXIMUM_UI_COMMAND_SIZE};
   friend class SharedUICommand;
+  friend class UICommandCoalescer;
 };
 
 }  // namespace webf
@@ -0,0 +1,298 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "ui_command_coalescer.h"
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include "core/dom/subtree_stream.h"
+#include "core/html/canvas/canvas_display_list.h"
+#include "foundation/dart_readable.h"
+#include "foundation/native_string.h"
+
+namespace webf {
+
+namespace {
+
+// Identifies a style property or an attribute of a binding object. |slot| separates the kinds of names and carries
+// the CSSPropertyID of kSetStyleById.
+struct WriteKey {
+  int64_t target;
+  int64_t slot;
+  std::u16string_view name;
+
+  bool operator==(const WriteKey& other) const {
+    return target == other.target && slot == other.slot && name == other.name;
+  }
+};
+
+struct WriteKeyHasher {
+  std::size_t operator()(const WriteKey& key) const {
+    std::size_t hash = std::hash<int64_t>()(key.target);
+    hash ^= std::hash<int64_t>()(key.slot) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<std::u16string_view>()(key.name) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+  }
+};
+
+enum WriteSlot : int64_t {
+  kStyleSlot = 0,
+  kAttributeSlot = 1,
+  // kSetStyleById uses kStyleByIdSlot + CSSPropertyID.
+  kStyleByIdSlot = 2,
+};
+
+std::u16string_view ArgsView(const UICommandItem& item) {
+  if (item.string_01 == 0)
+    return {};
+  return {reinterpret_cast<const char16_t*>(item.string_01), static_cast<size_t>(item.args_01_length)};
+}
+
+std::u16string_view NativeStringView(int64_t pointer) {
+  auto* string = reinterpret_cast<const SharedNativeString*>(pointer);
+  if (string == nullptr || string->string() == nullptr)
+    return {};
+  return {reinterpret_cast<const char16_t*>(string->string()), string->length()};
+}
+
+void FreeNativeString(int64_t pointer) {
+  auto* string = reinterpret_cast<SharedNativeString*>(pointer);
+  if (string == nullptr)
+    return;
+  dart_free(const_cast<uint16_t*>(string->string()));
+  delete string;
+}
+
+// Releases a dart_malloc'ed array of values along with the strings it owns.
+void FreeNativeValues(NativeValue* values, int64_t length) {
+  if (values == nullptr)
+    return;
+  for (int64_t i = 0; i < length; i++) {
+    if (values[i].tag == NativeTag::TAG_STRING)
+      FreeNativeString(reinterpret_cast<int64_t>(values[i].u.ptr));
+  }
+  dart_free(values);
+}
+
+bool IsNodeCreation(UICommand command) {
+  switch (command) {
+    case UICommand::kCreateElement:
+    case UICommand::kCreateTextNode:
+    case UICommand::kCreateComment:
+    case UICommand::kCreateDocumentFragment:
+    case UICommand::kCreateSVGElement:
+    case UICommand::kCreateElementNS:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Commands which only change the state of their own target and can be dropped along with it.
+bool IsLocalToTarget(UICommand command) {
+  switch (command) {
+    case UICommand::kSetStyle:
+    case UICommand::kSetStyleById:
+    case UICommand::kClearStyle:
+    case UICommand::kSetAttribute:
+    case UICommand::kRemoveAttribute:
+    case UICommand::kAddEvent:
+    case UICommand::kRemoveEvent:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+int64_t UICommandCoalescer::Coalesce(UICommandBuffer& buffer) {
+  int64_t size = buffer.size_;
+  if (size < 2)
+    return 0;
+
+  UICommandItem* items = buffer.buffer_;
+  elided_.assign(size, false);
+
+  CancelDisposedNodes(items, size);
+  CancelEventListenerPairs(items, size);
+  DropOverwrittenWrites(items, size);
+
+  int64_t kept = 0;
+  for (int64_t i = 0; i < size; i++) {
+    if (elided_[i]) {
+      FreePayload(items[i]);
+      continue;
+    }
+    if (kept != i) {
+      items[kept] = items[i];
+    }
+    kept++;
+  }
+
+  buffer.size_ = kept;
+  return size - kept;
+}
+
+void UICommandCoalescer::CancelDisposedNodes(const UICommandItem* items, int64_t size) {
+  // Index of the creation command of every node created in this batch which is still a candidate.
+  std::unordered_map<int64_t, int64_t> created;
+  std::unordered_set<int64_t> pinned;
+
+  for (int64_t i = 0; i < size; i++) {
+    auto command = static_cast<UICommand>(items[i].type);
+    if (IsNodeCreation(command)) {
+      created[items[i].nativePtr] = i;
+      continue;
+    }
+
+    if (command == UICommand::kDisposeBindingObject) {
+      int64_t pointer = items[i].nativePtr;
+      auto it = created.find(pointer);
+      if (it == created.end() || pinned.count(pointer))
+        continue;
+
+      for (int64_t j = it->second; j <= i; j++) {
+        if (items[j].nativePtr == pointer && !elided_[j])
+          Elide(j, stats_.nodes);
+      }
+      created.erase(it);
+      continue;
+    }
+
+    if (created.count(items[i].nativePtr) && !IsLocalToTarget(command)) {
+      pinned.insert(items[i].nativePtr);
+    }
+    if ((command == UICommand::kInsertAdjacentNode || command == UICommand::kCloneNode) &&
+        created.count(items[i].nativePtr2)) {
+      pinned.insert(items[i].nativePtr2);
+    }
+
+    // Dart resolves the binding objects listed in these payloads, the nodes they refer to must be kept.
+    const NativeValue* values = nullptr;
+    int64_t length = 0;
+    if (command == UICommand::kInsertSubtree && items[i].nativePtr2 != 0) {
+      auto* stream = reinterpret_cast<const NativeSubtreeStream*>(items[i].nativePtr2);
+      values = stream->nodes;
+      length = stream->length;
+    } else if (command == UICommand::kCanvasDisplayList && items[i].nativePtr2 != 0) {
+      auto* display_list = reinterpret_cast<const NativeCanvasDisplayList*>(items[i].nativePtr2);
+      values = display_list->commands;
+      length = display_list->length;
+    }
+    for (int64_t j = 0; j < length; j++) {
+      if (values[j].tag != NativeTag::TAG_POINTER)
+        continue;
+      auto pointer = reinterpret_cast<int64_t>(values[j].u.ptr);
+      if (created.count(pointer))
+        pinned.insert(pointer);
+    }
+  }
+}
+
+void UICommandCoalescer::CancelEventListenerPairs(const UICommandItem* items, int64_t size) {
+  // Index of the pending kAddEvent of each (target, capture, type).
+  std::unordered_map<WriteKey, int64_t, WriteKeyHasher> pending;
+
+  for (int64_t i = 0; i < size; i++) {
+    if (elided_[i])
+      continue;
+    auto command = static_cast<UICommand>(items[i].type);
+    if (command == UICommand::kAddEvent) {
+      // nativePtr2 points to DartAddEventListenerOptions, which starts with the capture flag.
+      bool capture = items[i].nativePtr2 != 0 && *reinterpret_cast<const bool*>(items[i].nativePtr2);
+      pending[WriteKey{items[i].nativePtr, capture, ArgsView(items[i])}] = i;
+    } else if (command == UICommand::kRemoveEvent) {
+      bool capture = items[i].nativePtr2 != 0;
+      auto it = pending.find(WriteKey{items[i].nativePtr, capture, ArgsView(items[i])});
+      if (it == pending.end())
+        continue;
+      Elide(it->second, stats_.events);
+      Elide(i, stats_.events);
+      pending.erase(it);
+    }
+  }
+}
+
+void UICommandCoalescer::DropOverwrittenWrites(const UICommandItem* items, int64_t size) {
+  std::unordered_set<WriteKey, WriteKeyHasher> written;
+
+  for (int64_t i = size - 1; i >= 0; i--) {
+    if (elided_[i])
+      continue;
+
+    const UICommandItem& item = items[i];
+    WriteKey key{item.nativePtr, 0, {}};
+    uint64_t* counter = nullptr;
+    switch (static_cast<UICommand>(item.type)) {
+      case UICommand::kSetStyle:
+        key.slot = kStyleSlot;
+        key.name = ArgsView(item);
+        counter = &stats_.styles;
+        break;
+      case UICommand::kSetStyleById:
+        key.slot = kStyleByIdSlot + item.nativePtr2;
+        counter = &stats_.styles;
+        break;
+      case UICommand::kSetAttribute:
+        key.slot = kAttributeSlot;
+        key.name = NativeStringView(item.nativePtr2);
+        counter = &stats_.attributes;
+        break;
+      case UICommand::kRemoveAttribute:
+        // Overrides earlier writes, but is never dropped itself.
+        written.insert(WriteKey{item.nativePtr, kAttributeSlot, ArgsView(item)});
+        continue;
+      case UICommand::kCloneNode:
+        // The clone copies the styles and attributes of the original at this point of the batch.
+        written.clear();
+        continue;
+      default:
+        continue;
+    }
+
+    if (!written.insert(key).second) {
+      Elide(i, *counter);
+    }
+  }
+}
+
+void UICommandCoalescer::Elide(int64_t index, uint64_t& counter) {
+  elided_[index] = true;
+  counter++;
+}
+
+void UICommandCoalescer::FreePayload(const UICommandItem& item) {
+  if (item.string_01 != 0) {
+    dart_free(reinterpret_cast<void*>(item.string_01));
+  }
+
+  switch (static_cast<UICommand>(item.type)) {
+    case UICommand::kSetStyle:
+    case UICommand::kSetAttribute:
+    case UICommand::kCreateElementNS:
+      FreeNativeString(item.nativePtr2);
+      break;
+    case UICommand::kAddEvent:
+      dart_free(reinterpret_cast<void*>(item.nativePtr2));
+      break;
+    case UICommand::kDisposeBindingObject:
+      // Dart never saw this binding object, release it the same way as it would.
+      dart_free(reinterpret_cast<void*>(item.nativePtr));
+      break;
+    case UICommand::kInsertSubtree: {
+      auto* stream = reinterpret_cast<NativeSubtreeStream*>(item.nativePtr2);
+      if (stream == nullptr)
+        break;
+      FreeNativeValues(stream->nodes, stream->length);
+      FreeNativeValues(stream->names, stream->names_length);
+      delete stream;
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+}  // namespace webf
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef WEBF_FOUNDATION_UI_COMMAND_COALESCER_H_
+#define WEBF_FOUNDATION_UI_COMMAND_COALESCER_H_
+
+#include <cstdint>
+#include <vector>
+#include "foundation/ui_command_buffer.h"
+
+namespace webf {
+
+// Counters of the commands elided by the coalescer, accumulated over the lifetime of a context.
+struct UICommandCoalescingStats {
+  uint64_t styles{0};      // kSetStyle / kSetStyleById overwritten by a later write of the same property.
+  uint64_t attributes{0};  // kSetAttribute overwritten by a later write of the same attribute.
+  uint64_t nodes{0};       // Commands of nodes created and disposed in the same batch without being attached.
+  uint64_t events{0};      // kAddEvent / kRemoveEvent pairs of the same listener.
+
+  uint64_t Total() const { return styles + attributes + nodes + events; }
+};
+
+// Drops UI commands whose effect is not observable by dart once the whole batch has been applied:
+//   - For each (target, style property) and (target, attribute), only the last write is kept. kCloneNode copies
+//     the current style and attributes, so no write before a clone is dropped.
+//   - A node created and disposed within the batch, which never took part in insertAdjacentNode, removeNode or
+//     cloneNode and is not listed in a subtree or canvas display list, is dropped together with every command
+//     targeting it.
+//   - kAddEvent followed by the kRemoveEvent of the same (target, type, capture) are both dropped, the bridge only
+//     sends them when the first listener is added and the last one is removed.
+// The payloads of the elided commands are freed here, as dart will never see them.
+class UICommandCoalescer {
+ public:
+  // Compacts |buffer| in place and returns the number of elided commands.
+  int64_t Coalesce(UICommandBuffer& buffer);
+
+  const UICommandCoalescingStats& stats() const { return stats_; }
+
+  // Releases the memory |item| hands over to dart, for commands which are dropped before dart reads them.
+  static void FreePayload(const UICommandItem& item);
+
+ private:
+  void CancelDisposedNodes(const UICommandItem* items, int64_t size);
+  void CancelEventListenerPairs(const UICommandItem* items, int64_t size);
+  void DropOverwrittenWrites(const UICommandItem* items, int64_t size);
+  void Elide(int64_t index, uint64_t& counter);
+
+  std::vector<bool> elided_;
+  UICommandCoalescingStats stats_;
+};
+
+}  // namespace webf
+
+#endif  // WEBF_FOUNDATION_UI_COMMAND_COALESCER_H_
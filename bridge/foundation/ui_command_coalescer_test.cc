@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "ui_command_coalescer.h"
+#include "core/dom/subtree_stream.h"
+#include "foundation/dart_readable.h"
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+namespace {
+
+void* TargetPointer(intptr_t value) {
+  return reinterpret_cast<void*>(value);
+}
+
+}  // namespace
+
+TEST(UICommandCoalescer, lastStyleAndAttributeWriteWins) {
+  auto env = TEST_init();
+  auto* context = env->page()->executingContext();
+  UICommandBuffer buffer(context);
+  UICommandCoalescer coalescer;
+
+  for (int i = 0; i < 60; i++) {
+    buffer.addCommand(UICommand::kSetStyleById, stringToNativeString(std::to_string(i)), TargetPointer(0x10),
+                      reinterpret_cast<void*>(1));
+  }
+  buffer.addCommand(UICommand::kSetStyle, stringToNativeString("--gap"), TargetPointer(0x10),
+                    stringToNativeString("1px").release());
+  buffer.addCommand(UICommand::kSetStyle, stringToNativeString("--gap"), TargetPointer(0x10),
+                    stringToNativeString("2px").release());
+  buffer.addCommand(UICommand::kSetAttribute, stringToNativeString("a"), TargetPointer(0x10),
+                    stringToNativeString("title").release());
+  // Other targets and other keys are kept.
+  buffer.addCommand(UICommand::kSetAttribute, stringToNativeString("b"), TargetPointer(0x20),
+                    stringToNativeString("title").release());
+  buffer.addCommand(UICommand::kSetAttribute, stringToNativeString("c"), TargetPointer(0x10),
+                    stringToNativeString("title").release());
+
+  EXPECT_EQ(coalescer.Coalesce(buffer), 59 + 1 + 1);
+  EXPECT_EQ(buffer.size(), 4);
+  EXPECT_EQ(coalescer.stats().styles, 60);
+  EXPECT_EQ(coalescer.stats().attributes, 1);
+
+  UICommandItem* items = buffer.data();
+  EXPECT_EQ(items[0].type, static_cast<int32_t>(UICommand::kSetStyleById));
+  EXPECT_EQ(std::u16string(reinterpret_cast<const char16_t*>(items[0].string_01), items[0].args_01_length), u"59");
+  EXPECT_EQ(items[1].type, static_cast<int32_t>(UICommand::kSetStyle));
+  EXPECT_EQ(reinterpret_cast<webf::SharedNativeString*>(items[1].nativePtr2)->length(), 3);
+  EXPECT_EQ(items[2].nativePtr, 0x20);
+  EXPECT_EQ(std::u16string(reinterpret_cast<const char16_t*>(items[3].string_01), items[3].args_01_length), u"c");
+}
+
+TEST(UICommandCoalescer, cloneNodeKeepsEarlierWrites) {
+  auto env = TEST_init();
+  auto* context = env->page()->executingContext();
+  UICommandBuffer buffer(context);
+  UICommandCoalescer coalescer;
+
+  buffer.addCommand(UICommand::kSetAttribute, stringToNativeString("a"), TargetPointer(0x10),
+                    stringToNativeString("title").release());
+  buffer.addCommand(UICommand::kCloneNode, nullptr, TargetPointer(0x10), TargetPointer(0x20));
+  buffer.addCommand(UICommand::kSetAttribute, stringToNativeString("b"), TargetPointer(0x10),
+                    stringToNativeString("title").release());
+
+  EXPECT_EQ(coalescer.Coalesce(buffer), 0);
+  EXPECT_EQ(buffer.size(), 3);
+}
+
+TEST(UICommandCoalescer, cancelsNodesDisposedBeforeAttached) {
+  auto env = TEST_init();
+  auto* context = env->page()->executingContext();
+  UICommandBuffer buffer(context);
+  UICommandCoalescer coalescer;
+
+  // The binding objects of dropped nodes are released by the coalescer, as dart would do.
+  void* detached = dart_malloc(16);
+  void* attached = dart_malloc(16);
+
+  buffer.addCommand(UICommand::kCreateElement, stringToNativeString("div"), detached, nullptr);
+  buffer.addCommand(UICommand::kCreateElement, stringToNativeString("div"), attached, nullptr);
+  buffer.addCommand(UICommand::kSetStyleById, stringToNativeString("10px"), detached, reinterpret_cast<void*>(1));
+  buffer.addCommand(UICommand::kInsertAdjacentNode, stringToNativeString("beforeend"), TargetPointer(0x10), attached);
+  buffer.addCommand(UICommand::kDisposeBindingObject, nullptr, detached, nullptr);
+  buffer.addCommand(UICommand::kDisposeBindingObject, nullptr, attached, nullptr);
+
+  EXPECT_EQ(coalescer.Coalesce(buffer), 3);
+  EXPECT_EQ(coalescer.stats().nodes, 3);
+  EXPECT_EQ(buffer.size(), 3);
+
+  UICommandItem* items = buffer.data();
+  EXPECT_EQ(items[0].type, static_cast<int32_t>(UICommand::kCreateElement));
+  EXPECT_EQ(items[0].nativePtr, reinterpret_cast<int64_t>(attached));
+  EXPECT_EQ(items[1].type, static_cast<int32_t>(UICommand::kInsertAdjacentNode));
+  EXPECT_EQ(items[2].type, static_cast<int32_t>(UICommand::kDisposeBindingObject));
+
+  dart_free(reinterpret_cast<void*>(items[0].string_01));
+  dart_free(reinterpret_cast<void*>(items[1].string_01));
+  dart_free(attached);
+}
+
+TEST(UICommandCoalescer, keepsNodesListedInSubtrees) {
+  auto env = TEST_init();
+  auto* context = env->page()->executingContext();
+  UICommandBuffer buffer(context);
+  UICommandCoalescer coalescer;
+
+  // A text node appended by the subtree to a node created and disposed in the same batch.
+  void* parent = dart_malloc(16);
+  auto* stream = new NativeSubtreeStream();
+  stream->length = 4;
+  stream->nodes = static_cast<webf::NativeValue*>(dart_malloc(sizeof(webf::NativeValue) * stream->length));
+  stream->nodes[0] = Native_NewPtr(JSPointerType::NativeBindingObject, TargetPointer(0x30));
+  stream->nodes[1] = Native_NewPtr(JSPointerType::NativeBindingObject, parent);
+  stream->nodes[2] = Native_NewInt64(SubtreeStream::kText);
+  stream->nodes[2].uint32 = 1;
+  stream->nodes[3] = Native_NewString(stringToNativeString("text").release());
+  stream->names_length = 0;
+  stream->names = nullptr;
+
+  buffer.addCommand(UICommand::kCreateElement, stringToNativeString("div"), parent, nullptr);
+  buffer.addCommand(UICommand::kInsertSubtree, nullptr, TargetPointer(0x20), stream);
+  buffer.addCommand(UICommand::kDisposeBindingObject, nullptr, parent, nullptr);
+
+  EXPECT_EQ(coalescer.Coalesce(buffer), 0);
+  EXPECT_EQ(coalescer.stats().nodes, 0);
+  EXPECT_EQ(buffer.size(), 3);
+
+  // Also releases the subtree, as dart would once it has been read.
+  for (int64_t i = 0; i < buffer.size(); i++) {
+    UICommandCoalescer::FreePayload(buffer.data()[i]);
+  }
+}
+
+TEST(UICommandCoalescer, dropsEventListenerPairs) {
+  auto env = TEST_init();
+  auto* context = env->page()->executingContext();
+  UICommandBuffer buffer(context);
+  UICommandCoalescer coalescer;
+
+  // Matches the layout of the listener options, which starts with the capture flag.
+  auto* bubble_options = static_cast<bool*>(dart_malloc(3));
+  auto* capture_options = static_cast<bool*>(dart_malloc(3));
+  memset(bubble_options, 0, 3);
+  memset(capture_options, 0, 3);
+  capture_options[0] = true;
+
+  buffer.addCommand(UICommand::kAddEvent, stringToNativeString("click"), TargetPointer(0x10), bubble_options);
+  buffer.addCommand(UICommand::kAddEvent, stringToNativeString("click"), TargetPointer(0x10), capture_options);
+  buffer.addCommand(UICommand::kRemoveEvent, stringToNativeString("click"), TargetPointer(0x10), nullptr);
+
+  EXPECT_EQ(coalescer.Coalesce(buffer), 2);
+  EXPECT_EQ(coalescer.stats().events, 2);
+  EXPECT_EQ(buffer.size(), 1);
+  EXPECT_EQ(buffer.data()[0].nativePtr2, reinterpret_cast<int64_t>(capture_options));
+
+  dart_free(reinterpret_cast<void*>(buffer.data()[0].string_01));
+  dart_free(capture_options);
+}
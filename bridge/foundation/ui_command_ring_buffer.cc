@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "ui_command_ring_buffer.h"
+
+namespace webf {
+
+UICommandRingBuffer::UICommandRingBuffer(ExecutingContext* context) : context_(context) {}
+
+bool UICommandRingBuffer::Publish(std::unique_ptr<UICommandBuffer>& segment) {
+  size_t head = head_.load(std::memory_order_relaxed);
+
+  if (head - cached_tail_ >= kCapacity) {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    if (head - cached_tail_ >= kCapacity) {
+      producer_waiting_.store(true, std::memory_order_relaxed);
+      // Pairs with the fence in Pop(): either the consumer sees the flag, or the slot it freed meanwhile is seen here.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head - cached_tail_ >= kCapacity) {
+        overflow_count_++;
+        return false;
+      }
+      producer_waiting_.store(false, std::memory_order_relaxed);
+    }
+  }
+
+  std::unique_ptr<UICommandBuffer>& slot = slots_[head % kCapacity];
+  // Slots are allocated lazily, most pages never have more than a couple of segments in flight.
+  if (slot == nullptr) {
+    slot = std::make_unique<UICommandBuffer>(context_);
+  }
+  std::swap(slot, segment);
+
+  head_.store(head + 1, std::memory_order_release);
+  published_count_++;
+  return true;
+}
+
+UICommandBuffer* UICommandRingBuffer::Front() {
+  size_t tail = tail_.load(std::memory_order_relaxed);
+
+  if (tail == cached_head_) {
+    cached_head_ = head_.load(std::memory_order_acquire);
+    if (tail == cached_head_) {
+      return nullptr;
+    }
+  }
+
+  return slots_[tail % kCapacity].get();
+}
+
+bool UICommandRingBuffer::Pop() {
+  UICommandBuffer* segment = Front();
+  if (segment == nullptr)
+    return false;
+
+  segment->clear();
+  tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  return producer_waiting_.load(std::memory_order_relaxed) &&
+         producer_waiting_.exchange(false, std::memory_order_relaxed);
+}
+
+bool UICommandRingBuffer::Empty() const {
+  return tail_.load(std::memory_order_acquire) == head_.load(std::memory_order_acquire);
+}
+
+}  // namespace webf
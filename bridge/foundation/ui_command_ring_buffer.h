@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_FOUNDATION_UI_COMMAND_RING_BUFFER_H_
+#define BRIDGE_FOUNDATION_UI_COMMAND_RING_BUFFER_H_
+
+#include <atomic>
+#include <memory>
+#include "foundation/macros.h"
+#include "foundation/ui_command_buffer.h"
+
+namespace webf {
+
+// A bounded single-producer/single-consumer ring of UICommandBuffer segments.
+//
+// The JS thread (producer) publishes a whole segment at a time with a release store on |head_|, and the Dart UI
+// thread (consumer) reads published segments in order and returns them with a release store on |tail_|. Segments
+// are handed over by swapping ownership, so commands are never copied and neither side spins on the other.
+class UICommandRingBuffer {
+ public:
+  static constexpr size_t kCapacity = 64;
+
+  explicit UICommandRingBuffer(ExecutingContext* context);
+  WEBF_DISALLOW_COPY_ASSIGN_AND_MOVE(UICommandRingBuffer);
+
+  // Producer side, JS thread only.
+  // Moves |segment| into the ring and replaces it with an empty recycled buffer. Returns false and leaves |segment|
+  // untouched when every slot is still waiting to be consumed, the next Pop() then tells the consumer to wake the
+  // producer up.
+  bool Publish(std::unique_ptr<UICommandBuffer>& segment);
+
+  // Consumer side, Dart UI thread only.
+  // Returns the oldest published segment, or nullptr if nothing has been published.
+  UICommandBuffer* Front();
+  // Clears the segment returned by Front() and gives its slot back to the producer. Returns true when a Publish()
+  // failed since the last time it did, the producer has to be asked to publish again.
+  bool Pop();
+
+  bool Empty() const;
+  size_t published_count() const { return published_count_; }
+  size_t overflow_count() const { return overflow_count_; }
+
+ private:
+  // Keep producer and consumer indexes on separate cache lines. The padding is explicit instead of alignas() so the
+  // owning ExecutingContext does not become over-aligned on platforms built with -fno-aligned-allocation.
+  static constexpr size_t kCacheLineSize = 64;
+
+  ExecutingContext* context_;
+  std::unique_ptr<UICommandBuffer> slots_[kCapacity];
+
+  char padding_0_[kCacheLineSize];
+  // Written by the producer, read by the consumer.
+  std::atomic<size_t> head_{0};
+  // Producer local snapshot of |tail_|.
+  size_t cached_tail_{0};
+  // Set by the producer when the ring is full, cleared by the consumer which frees a slot.
+  std::atomic<bool> producer_waiting_{false};
+  size_t published_count_{0};
+  size_t overflow_count_{0};
+
+  char padding_1_[kCacheLineSize];
+  // Written by the consumer, read by the producer.
+  std::atomic<size_t> tail_{0};
+  // Consumer local snapshot of |head_|.
+  size_t cached_head_{0};
+  char padding_2_[kCacheLineSize];
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_FOUNDATION_UI_COMMAND_RING_BUFFER_H_
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "ui_command_ring_buffer.h"
+#include "gtest/gtest.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+TEST(UICommandRingBuffer, fullRingAsksForAnotherPublish) {
+  auto env = TEST_init();
+  auto* context = env->page()->executingContext();
+  UICommandRingBuffer ring_buffer(context);
+  auto segment = std::make_unique<UICommandBuffer>(context);
+
+  for (size_t i = 0; i < UICommandRingBuffer::kCapacity; i++) {
+    segment->addCommand(UICommand::kSetStyle, nullptr, nullptr, nullptr);
+    EXPECT_TRUE(ring_buffer.Publish(segment));
+    EXPECT_TRUE(segment->empty());
+  }
+
+  // Every slot is waiting to be consumed, the commands stay with the producer.
+  segment->addCommand(UICommand::kSetStyle, nullptr, nullptr, nullptr);
+  EXPECT_FALSE(ring_buffer.Publish(segment));
+  EXPECT_FALSE(ring_buffer.Publish(segment));
+  EXPECT_EQ(segment->size(), 1);
+  EXPECT_EQ(ring_buffer.overflow_count(), 2);
+
+  // Freeing a slot asks the producer to publish again, once.
+  EXPECT_TRUE(ring_buffer.Pop());
+  EXPECT_TRUE(ring_buffer.Publish(segment));
+  EXPECT_TRUE(segment->empty());
+
+  size_t consumed = 1;
+  while (ring_buffer.Front() != nullptr) {
+    // No publish failed since.
+    EXPECT_FALSE(ring_buffer.Pop());
+    consumed++;
+  }
+  EXPECT_EQ(consumed, UICommandRingBuffer::kCapacity + 1);
+  EXPECT_TRUE(ring_buffer.Empty());
+}
@@ -81,10 +81,12 @@ void UICommandSyncStrategy::RecordUICommand(UICommand type,
       break;
     }
     case UICommand::kSetStyle:
+    case UICommand::kSetStyleById:
     case UICommand::kClearStyle:
     case UICommand::kSetAttribute:
     case UICommand::kRemoveEvent:
     case UICommand::kAddEvent:
+    case UICommand::kCanvasDisplayList:
     case UICommand::kDisposeBindingObject: {
       host_->waiting_buffer_->addCommand(type, std::move(args_01), native_binding_object, native_ptr2,
                                          request_ui_update);
@@ -100,6 +102,14 @@ void UICommandSyncStrategy::RecordUICommand(UICommand type,
       SyncToReserveIfNecessary();
       break;
     }
+    case UICommand::kInsertSubtree: {
+      host_->waiting_buffer_->addCommand(type, std::move(args_01), native_binding_object, native_ptr2,
+                                         request_ui_update);
+
+      RecordOperationForPointer(native_binding_object);
+      SyncToReserveIfNecessary();
+      break;
+    }
     case UICommand::kFinishRecordingCommand:
       break;
   }
@@ -24,6 +24,8 @@ using PublicElementToBlobWithDevicePixelRatio = void (*)(Element*,
                                                          double,
                                                          WebFNativeFunctionContext*,
                                                          SharedExceptionState*);
+using PublicElementOuterHTML = const char* (*)(Element*);
+using PublicElementInnerHTML = const char* (*)(Element*);
 
 struct ElementPublicMethods : WebFPublicMethods {
   static WebFValue<CSSStyleDeclaration, CSSStyleDeclarationPublicMethods> Style(Element* element);
@@ -32,12 +34,17 @@ struct ElementPublicMethods : WebFPublicMethods {
                                          double device_pixel_ratio,
                                          WebFNativeFunctionContext* context,
                                          SharedExceptionState* exception_state);
+  // The returned markup is allocated with malloc() and owned by the caller.
+  static const char* OuterHTML(Element* element);
+  static const char* InnerHTML(Element* element);
 
   double version{1.0};
   ContainerNodePublicMethods container_node;
   PublicElementGetStyle element_get_style{Style};
   PublicElementToBlob element_to_blob{ToBlob};
   PublicElementToBlobWithDevicePixelRatio element_to_blob_with_device_pixel_ratio{ToBlobWithDevicePixelRatio};
+  PublicElementOuterHTML element_outer_html{OuterHTML};
+  PublicElementInnerHTML element_inner_html{InnerHTML};
 };
 
 }  // namespace webf
@@ -107,6 +107,17 @@ void parseHTML(void* page,
                Dart_Handle dart_handle,
                ParseHTMLCallback result_callback);
 WEBF_EXPORT_C
+void parseHTMLBegin(void* page);
+WEBF_EXPORT_C
+void parseHTMLChunk(void* page,
+                    char* code,
+                    int32_t length,
+                    int64_t profile_id,
+                    Dart_Handle dart_handle,
+                    ParseHTMLCallback result_callback);
+WEBF_EXPORT_C
+void parseHTMLEnd(void* page, int64_t profile_id, Dart_Handle dart_handle, ParseHTMLCallback result_callback);
+WEBF_EXPORT_C
 void* parseSVGResult(const char* code, int32_t length);
 WEBF_EXPORT_C
 void freeSVGResult(void* svgTree);
@@ -143,13 +154,29 @@ int64_t getUICommandItemSize(void* page);
 WEBF_EXPORT_C
 void clearUICommandItems(void* page);
 WEBF_EXPORT_C
+const char* const* getCSSPropertyNames();
+WEBF_EXPORT_C
 void registerPluginByteCode(uint8_t* bytes, int32_t length, const char* pluginName);
 WEBF_EXPORT_C
 void registerPluginCode(const char* code, int32_t length, const char* pluginName);
+WEBF_EXPORT_C
+void setCodeCacheDirectory(const char* directory, int64_t max_bytes);
+// Fills |stats| with the hits, misses, rejected entries, stores, evictions and total bytes of the code cache.
+WEBF_EXPORT_C
+void getCodeCacheStats(int64_t* stats);
+// Fills |stats| with the full collection, slice, completed pass and freed object counts of the JS runtime of the page,
+// its longest full collection and slice and its total pause in microseconds, followed by the histograms of the full
+// collection and slice pauses, JS_GC_PAUSE_BUCKET_COUNT buckets each, then the count and longest pause of the young
+// object collections and their histogram.
+WEBF_EXPORT_C
+void getGCStats(void* page, int64_t* stats);
 
 WEBF_EXPORT_C int8_t isJSThreadBlocked(void* dart_isolate_context, double context_id);
+WEBF_EXPORT_C void pauseJSThreadTimers(void* dart_isolate_context, double context_id);
+WEBF_EXPORT_C void resumeJSThreadTimers(void* dart_isolate_context, double context_id);
 
 WEBF_EXPORT_C void executeNativeCallback(DartWork* work_ptr);
+WEBF_EXPORT_C void executeNativeCallbacks(void* dispatcher);
 WEBF_EXPORT_C
 void init_dart_dynamic_linking(void* data);
 WEBF_EXPORT_C
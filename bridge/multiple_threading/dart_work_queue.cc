@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "dart_work_queue.h"
+
+namespace webf {
+
+namespace multi_threading {
+
+DartWorkQueue::~DartWorkQueue() {
+  // The dart isolate is gone, the pending works can not run anymore.
+  DartWorkItem* item = head_.exchange(nullptr, std::memory_order_acquire);
+  while (item != nullptr) {
+    DartWorkItem* next = item->next_;
+    item->Discard();
+    delete item;
+    item = next;
+  }
+
+  while (pool_ != nullptr) {
+    DartWorkItem* next = pool_->next_;
+    delete pool_;
+    pool_ = next;
+  }
+}
+
+size_t DartWorkQueue::Drain() {
+  DartWorkItem* item = head_.exchange(nullptr, std::memory_order_acquire);
+  if (item == nullptr)
+    return 0;
+
+  // The stack holds the latest work first.
+  DartWorkItem* first = nullptr;
+  DartWorkItem* last = item;
+  size_t count = 0;
+  while (item != nullptr) {
+    DartWorkItem* next = item->next_;
+    item->next_ = first;
+    first = item;
+    item = next;
+    count++;
+  }
+
+  for (item = first; item != nullptr; item = item->next_) {
+    item->Run();
+  }
+
+  Recycle(first, last, count);
+  return count;
+}
+
+size_t DartWorkQueue::PooledItemCount() {
+  std::lock_guard<std::mutex> lock(pool_mutex_);
+  return pool_size_;
+}
+
+DartWorkItem* DartWorkQueue::Allocate() {
+  {
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    if (pool_ != nullptr) {
+      DartWorkItem* item = pool_;
+      pool_ = item->next_;
+      pool_size_--;
+      return item;
+    }
+  }
+  return new DartWorkItem();
+}
+
+void DartWorkQueue::Recycle(DartWorkItem* first, DartWorkItem* last, size_t count) {
+  std::lock_guard<std::mutex> lock(pool_mutex_);
+  // Keep the pool bounded after a burst.
+  while (count > 0 && pool_size_ + count > kMaxPooledItems) {
+    DartWorkItem* next = first->next_;
+    delete first;
+    first = next;
+    count--;
+  }
+  if (count == 0)
+    return;
+
+  last->next_ = pool_;
+  pool_ = first;
+  pool_size_ += count;
+}
+
+}  // namespace multi_threading
+
+}  // namespace webf
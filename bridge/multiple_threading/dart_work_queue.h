@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef MULTI_THREADING_DART_WORK_QUEUE_H_
+#define MULTI_THREADING_DART_WORK_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace webf {
+
+namespace multi_threading {
+
+/**
+ * @brief A work posted to the dart thread without waiting for its result.
+ * Callables which fit in the item are stored inline, larger ones are allocated on the heap.
+ */
+class DartWorkItem {
+ public:
+  static constexpr size_t kInlineCapacity = 64;
+
+  template <typename Callable>
+  void Set(Callable&& callable) {
+    using Stored = std::decay_t<Callable>;
+    if constexpr (sizeof(Stored) <= kInlineCapacity && alignof(Stored) <= alignof(std::max_align_t)) {
+      new (storage_) Stored(std::forward<Callable>(callable));
+      invoke_ = [](DartWorkItem* item, bool run) {
+        auto* stored = std::launder(reinterpret_cast<Stored*>(item->storage_));
+        if (run)
+          (*stored)();
+        stored->~Stored();
+      };
+    } else {
+      new (storage_) Stored*(new Stored(std::forward<Callable>(callable)));
+      invoke_ = [](DartWorkItem* item, bool run) {
+        Stored* stored = *std::launder(reinterpret_cast<Stored**>(item->storage_));
+        if (run)
+          (*stored)();
+        delete stored;
+      };
+    }
+  }
+
+  // Runs the work once and releases what it captured.
+  void Run() { invoke_(this, true); }
+  // Releases what the work captured without running it.
+  void Discard() { invoke_(this, false); }
+
+ private:
+  DartWorkItem* next_{nullptr};
+  void (*invoke_)(DartWorkItem* item, bool run){nullptr};
+  alignas(std::max_align_t) unsigned char storage_[kInlineCapacity];
+  friend class DartWorkQueue;
+};
+
+/**
+ * @brief Lock free queue of the works posted from the JS threads to the dart thread.
+ * Producers push onto an intrusive stack, the dart thread takes the whole stack at once and runs it in posting order.
+ * Only the push which finds the queue empty has to wake up dart, see Dispatcher::PostToDart().
+ * Finished items are kept in a pool and reused by the next pushes.
+ */
+class DartWorkQueue {
+ public:
+  DartWorkQueue() = default;
+  ~DartWorkQueue();
+  DartWorkQueue(const DartWorkQueue&) = delete;
+  DartWorkQueue& operator=(const DartWorkQueue&) = delete;
+
+  // Returns true if the queue was empty, the dart thread then needs to be notified.
+  template <typename Callable>
+  bool Push(Callable&& callable) {
+    DartWorkItem* item = Allocate();
+    item->Set(std::forward<Callable>(callable));
+
+    DartWorkItem* head = head_.load(std::memory_order_relaxed);
+    do {
+      item->next_ = head;
+    } while (!head_.compare_exchange_weak(head, item, std::memory_order_release, std::memory_order_relaxed));
+    return head == nullptr;
+  }
+
+  // Runs the works pushed so far, in the order they were pushed. Must be called from the dart thread.
+  // Returns the number of works run.
+  size_t Drain();
+
+  size_t PooledItemCount();
+
+ private:
+  // Enough for the works posted during a frame of an event storm.
+  static constexpr size_t kMaxPooledItems = 256;
+
+  DartWorkItem* Allocate();
+  void Recycle(DartWorkItem* first, DartWorkItem* last, size_t count);
+
+  std::atomic<DartWorkItem*> head_{nullptr};
+  std::mutex pool_mutex_;
+  DartWorkItem* pool_{nullptr};
+  size_t pool_size_{0};
+};
+
+}  // namespace multi_threading
+
+}  // namespace webf
+
+#endif  // MULTI_THREADING_DART_WORK_QUEUE_H_
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "dart_work_queue.h"
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace webf::multi_threading;
+
+TEST(DartWorkQueue, onlyTheFirstPushRingsTheDoorbell) {
+  DartWorkQueue queue;
+  std::vector<int> ran;
+
+  EXPECT_EQ(queue.Push([&ran]() { ran.emplace_back(1); }), true);
+  EXPECT_EQ(queue.Push([&ran]() { ran.emplace_back(2); }), false);
+  EXPECT_EQ(queue.Push([&ran]() { ran.emplace_back(3); }), false);
+
+  EXPECT_EQ(queue.Drain(), 3);
+  EXPECT_EQ(ran, (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(queue.Drain(), 0);
+
+  // Empty again, the next push has to wake up dart.
+  EXPECT_EQ(queue.Push([&ran]() { ran.emplace_back(4); }), true);
+  EXPECT_EQ(queue.Drain(), 1);
+  EXPECT_EQ(ran, (std::vector<int>{1, 2, 3, 4}));
+}
+
+TEST(DartWorkQueue, recyclesItems) {
+  DartWorkQueue queue;
+  int sum = 0;
+  for (int i = 0; i < 8; i++) {
+    queue.Push([&sum, i]() { sum += i; });
+  }
+  queue.Drain();
+  EXPECT_EQ(queue.PooledItemCount(), 8);
+
+  queue.Push([&sum]() { sum += 100; });
+  EXPECT_EQ(queue.PooledItemCount(), 7);
+  queue.Drain();
+  EXPECT_EQ(sum, 128);
+  EXPECT_EQ(queue.PooledItemCount(), 8);
+
+  // A burst does not grow the pool without bound.
+  for (int i = 0; i < 1000; i++) {
+    queue.Push([]() {});
+  }
+  queue.Drain();
+  EXPECT_EQ(queue.PooledItemCount(), 256);
+}
+
+TEST(DartWorkQueue, releasesCapturesOfLargeAndDiscardedWorks) {
+  auto value = std::make_shared<int>(0);
+  {
+    DartWorkQueue queue;
+    std::array<int64_t, 32> large{};
+    large[31] = 1;
+    queue.Push([value, large]() { *value += static_cast<int>(large[31]); });
+    queue.Drain();
+    EXPECT_EQ(*value, 1);
+    EXPECT_EQ(value.use_count(), 1);
+
+    queue.Push([value]() { *value += 1; });
+    EXPECT_EQ(value.use_count(), 2);
+  }
+  // Works still pending when the queue is destroyed are not run.
+  EXPECT_EQ(*value, 1);
+  EXPECT_EQ(value.use_count(), 1);
+}
+
+TEST(DartWorkQueue, keepsTheOrderOfEachProducer) {
+  constexpr int kProducers = 4;
+  constexpr int kWorks = 10000;
+  DartWorkQueue queue;
+  std::array<std::vector<int>, kProducers> ran;
+  std::atomic<int> doorbells{0};
+
+  std::vector<std::thread> producers;
+  for (int producer = 0; producer < kProducers; producer++) {
+    producers.emplace_back([&, producer]() {
+      for (int i = 0; i < kWorks; i++) {
+        if (queue.Push([&ran, producer, i]() { ran[producer].emplace_back(i); })) {
+          doorbells++;
+        }
+      }
+    });
+  }
+
+  size_t drained = 0;
+  int drains = 0;
+  while (drained < kProducers * kWorks) {
+    size_t count = queue.Drain();
+    drained += count;
+    if (count > 0)
+      drains++;
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  for (auto& works : ran) {
+    ASSERT_EQ(works.size(), kWorks);
+    for (int i = 0; i < kWorks; i++) {
+      ASSERT_EQ(works[i], i);
+    }
+  }
+  // Each drain which found works was announced by exactly one doorbell.
+  EXPECT_EQ(doorbells.load(), drains);
+}
@@ -96,49 +96,48 @@ std::unique_ptr<Looper>& Dispatcher::looper(int32_t js_context_id) {
   return js_threads_[js_context_id];
 }
 
-// run in the cpp thread
-bool Dispatcher::NotifyDart(const DartWork* work_ptr, bool is_sync) {
-  const intptr_t work_addr = reinterpret_cast<intptr_t>(work_ptr);
-
-  Dart_CObject** array = new Dart_CObject*[3];
-
-  array[0] = new Dart_CObject();
-  array[0]->type = Dart_CObject_Type::Dart_CObject_kInt64;
-  array[0]->value.as_int64 = is_sync ? 1 : 0;
-
-  array[1] = new Dart_CObject();
-  array[1]->type = Dart_CObject_Type::Dart_CObject_kInt64;
-  array[1]->value.as_int64 = work_addr;
-
-  array[2] = new Dart_CObject();
-  array[2]->type = Dart_CObject_Type ::Dart_CObject_kInt64;
-  size_t thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
-  array[2]->value.as_int64 = thread_id;
-
-  Dart_CObject dart_object;
-  dart_object.type = Dart_CObject_kArray;
-  dart_object.value.as_array.length = 3;
-  dart_object.value.as_array.values = array;
+// The kinds of messages posted to dart, keep in sync with requestExecuteCallback() in to_native.dart.
+constexpr int64_t kSyncDartWorkMessage = 1;
+constexpr int64_t kDartWorkDoorbellMessage = 2;
 
+// run in the cpp thread
+bool Dispatcher::NotifyDart(const DartWork* work_ptr) {
 #if ENABLE_LOG
-  if (is_sync) {
-    WEBF_LOG(WARN) << " SYNC BLOCK THREAD " << std::this_thread::get_id() << " FOR A DART CALLBACK TO RECOVER";
-  }
+  WEBF_LOG(WARN) << " SYNC BLOCK THREAD " << std::this_thread::get_id() << " FOR A DART CALLBACK TO RECOVER";
 #endif
 
-  const bool result = Dart_PostCObject_DL(dart_port_, &dart_object);
+  const bool result = PostMessageToDart(kSyncDartWorkMessage, reinterpret_cast<intptr_t>(work_ptr));
   if (!result) {
     delete work_ptr;
     return false;
   }
-
-  delete array[0];
-  delete array[1];
-  delete array[2];
-  delete[] array;
   return true;
 }
 
+// run in the cpp thread
+void Dispatcher::RingDartDoorbell() {
+  PostMessageToDart(kDartWorkDoorbellMessage, reinterpret_cast<intptr_t>(this));
+}
+
+bool Dispatcher::PostMessageToDart(int64_t kind, intptr_t address) {
+  // The message is copied by Dart_PostCObject_DL, nothing has to outlive the call.
+  Dart_CObject values[3];
+  values[0].type = Dart_CObject_Type::Dart_CObject_kInt64;
+  values[0].value.as_int64 = kind;
+  values[1].type = Dart_CObject_Type::Dart_CObject_kInt64;
+  values[1].value.as_int64 = address;
+  values[2].type = Dart_CObject_Type::Dart_CObject_kInt64;
+  values[2].value.as_int64 = static_cast<int64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+  Dart_CObject* array[3] = {&values[0], &values[1], &values[2]};
+  Dart_CObject dart_object;
+  dart_object.type = Dart_CObject_kArray;
+  dart_object.value.as_array.length = 3;
+  dart_object.value.as_array.values = array;
+
+  return Dart_PostCObject_DL(dart_port_, &dart_object);
+}
+
 void Dispatcher::FinalizeAllJSThreads(webf::multi_threading::Callback callback) {
   std::atomic<size_t> unfinished_thread = js_threads_.size();
 
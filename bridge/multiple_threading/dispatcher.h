@@ -11,8 +11,10 @@
 #include <functional>
 #include <memory>
 #include <set>
+#include <tuple>
 #include <unordered_map>
 
+#include "dart_work_queue.h"
 #include "logging.h"
 #include "looper.h"
 #include "task.h"
@@ -56,11 +58,11 @@ class Dispatcher {
     }
 
 #if FLUTTER_BACKEND
-    auto task = std::make_shared<ConcreteTask<Func, Args...>>(std::forward<Func>(func), std::forward<Args>(args)...);
-    DartWork work = [task](bool cancel) { (*task)(); };
-
-    const DartWork* work_ptr = new DartWork(work);
-    NotifyDart(work_ptr, false);
+    if (dart_works_.Push([func = std::forward<Func>(func), args = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+          std::apply(func, args);
+        })) {
+      RingDartDoorbell();
+    }
 #endif
   }
 
@@ -72,14 +74,18 @@ class Dispatcher {
       return;
     }
 
-    auto task = std::make_shared<ConcreteCallbackTask<Func, Args...>>(
-        std::forward<Func>(func), std::forward<Args>(args)..., std::forward<Callback>(callback));
-    const DartWork work = [task]() { (*task)(); };
-
-    const DartWork* work_ptr = new DartWork(work);
-    NotifyDart(work_ptr, false);
+    if (dart_works_.Push([func = std::forward<Func>(func), callback = std::move(callback),
+                          args = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+          std::apply(func, args);
+          callback();
+        })) {
+      RingDartDoorbell();
+    }
   }
 
+  // Runs the works posted by PostToDart() so far, called by dart once it received the doorbell message.
+  void DrainDartWorks() { dart_works_.Drain(); }
+
   template <typename Func, typename... Args>
   auto PostToDartSync(bool dedicated_thread, double js_context_id, Func&& func, Args&&... args)
       -> std::invoke_result_t<Func, bool, Args...> {
@@ -104,7 +110,7 @@ class Dispatcher {
     DartWork* work_ptr = new DartWork(work);
     pending_dart_tasks_.insert(work_ptr);
 
-    bool success = NotifyDart(work_ptr, true);
+    bool success = NotifyDart(work_ptr);
     if (!success) {
       pending_dart_tasks_.erase(work_ptr);
       return std::invoke(std::forward<Func>(func), true, std::forward<Args>(args)...);
@@ -176,7 +182,11 @@ class Dispatcher {
   }
 
  private:
-  bool NotifyDart(const DartWork* work_ptr, bool is_sync);
+  // Sends |work_ptr| to dart in its own message, the blocked JS thread waits for it.
+  bool NotifyDart(const DartWork* work_ptr);
+  // Asks dart to drain |dart_works_|, only posted when the queue was empty.
+  void RingDartDoorbell();
+  bool PostMessageToDart(int64_t kind, intptr_t address);
 
   void FinalizeAllJSThreads(Callback callback);
   void StopAllJSThreads();
@@ -185,6 +195,8 @@ class Dispatcher {
   Dart_Port dart_port_;
   std::unordered_map<int32_t, std::unique_ptr<Looper>> js_threads_;
   std::set<DartWork*> pending_dart_tasks_;
+  // Fire and forget works, one doorbell message wakes dart up for all the works posted until it drains them.
+  DartWorkQueue dart_works_;
   friend Looper;
 };
 
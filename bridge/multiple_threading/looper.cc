@@ -5,6 +5,7 @@
 #include "looper.h"
 #include <pthread.h>
 
+#include <algorithm>
 #include <cstddef>
 
 #include "logging.h"
@@ -13,6 +14,9 @@ namespace webf {
 
 namespace multi_threading {
 
+// Short enough to not delay a task posted meanwhile by more than a frame.
+constexpr auto kIdleSliceDuration = std::chrono::milliseconds(4);
+
 static void setThreadName(const std::string& name) {
 #if defined(__APPLE__) && defined(__MACH__)  // Apple OSX and iOS (Darwin)
   pthread_setname_np(name.c_str());
@@ -48,26 +52,144 @@ void Looper::Stop() {
   }
 }
 
+void Looper::CancelDelayedMessage(int32_t timer_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  active_timers_.erase(timer_id);
+}
+
+void Looper::PauseTimers() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  timers_paused_ = true;
+}
+
+void Looper::ResumeTimers() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    timers_paused_ = false;
+  }
+  cv_.notify_one();
+}
+
+void Looper::SetIdleHandler(IdleHandler handler) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    idle_handler_ = std::move(handler);
+    idle_work_pending_ = idle_handler_ != nullptr;
+  }
+  cv_.notify_one();
+}
+
 // private methods
 void Looper::Run() {
+  std::vector<std::shared_ptr<Task>> expired_timers;
   while (true) {
     std::shared_ptr<Task> task = nullptr;
     {
       std::unique_lock<std::mutex> lock(mutex_);
-      cv_.wait(lock, [this] { return !running_ || (!tasks_.empty() && !paused_); });
+      while (running_ && (tasks_.empty() || paused_)) {
+        bool has_timer = HasPendingTimer();
+        // Copied, the heap may be reallocated by other threads while the lock is released below.
+        TimerClock::time_point timer_deadline = has_timer ? timers_.top().deadline : TimerClock::time_point::max();
+        if (has_timer && TimerClock::now() >= timer_deadline)
+          break;
+        if (idle_work_pending_) {
+          TimerClock::time_point idle_deadline = TimerClock::now() + kIdleSliceDuration;
+          if (has_timer)
+            idle_deadline = std::min(idle_deadline, timer_deadline);
+          IdleHandler handler = idle_handler_;
+          lock.unlock();
+          bool more = handler(idle_deadline);
+          lock.lock();
+          idle_work_pending_ = more && idle_handler_ != nullptr;
+          continue;
+        }
+        if (!has_timer) {
+          cv_.wait(lock);
+          continue;
+        }
+        // Recomputed after each wake up, a timer posted meanwhile may expire earlier.
+        if (cv_.wait_until(lock, timer_deadline) == std::cv_status::timeout)
+          break;
+      }
 
       if (!running_) {
         return;
       }
 
+      if (HasPendingTimer()) {
+        TakeExpiredTimers(TimerClock::now(), expired_timers);
+      }
+
       if (!paused_ && !tasks_.empty()) {
         task = std::move(tasks_.front());
         tasks_.pop();
       }
     }
+
+    for (auto& timer : expired_timers) {
+      if (!running_)
+        return;
+      (*timer)(false);
+    }
+
     if (task != nullptr && running_) {
       (*task)(false);
     }
+
+    if (task != nullptr || !expired_timers.empty()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      idle_work_pending_ = idle_handler_ != nullptr;
+    }
+    expired_timers.clear();
+  }
+}
+
+void Looper::ScheduleTimer(int32_t timer_id, int64_t delay_ms, std::shared_ptr<Task>&& task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t sequence = timer_sequence_++;
+    active_timers_[timer_id] = sequence;
+    timers_.push(PendingTimer{TimerClock::now() + std::chrono::milliseconds(std::max<int64_t>(delay_ms, 0)), sequence,
+                              timer_id, std::move(task)});
+
+    // Polling code keeps canceling and posting timers, don't let the canceled entries pile up until their deadline.
+    if (timers_.size() > 64 && timers_.size() > active_timers_.size() * 2) {
+      std::vector<PendingTimer> live_timers;
+      live_timers.reserve(active_timers_.size());
+      while (!timers_.empty()) {
+        PendingTimer top = timers_.top();
+        timers_.pop();
+        auto it = active_timers_.find(top.timer_id);
+        if (it != active_timers_.end() && it->second == top.sequence)
+          live_timers.emplace_back(std::move(top));
+      }
+      timers_ = decltype(timers_)(PendingTimerLater(), std::move(live_timers));
+    }
+  }
+  cv_.notify_one();
+}
+
+bool Looper::HasPendingTimer() {
+  if (timers_paused_)
+    return false;
+
+  // Drop the canceled and replaced timers on top of the heap.
+  while (!timers_.empty()) {
+    int32_t timer_id = timers_.top().timer_id;
+    uint64_t sequence = timers_.top().sequence;
+    auto it = active_timers_.find(timer_id);
+    if (it != active_timers_.end() && it->second == sequence)
+      return true;
+    timers_.pop();
+  }
+  return false;
+}
+
+void Looper::TakeExpiredTimers(TimerClock::time_point now, std::vector<std::shared_ptr<Task>>& expired) {
+  while (HasPendingTimer() && timers_.top().deadline <= now) {
+    active_timers_.erase(timers_.top().timer_id);
+    expired.emplace_back(timers_.top().task);
+    timers_.pop();
   }
 }
 
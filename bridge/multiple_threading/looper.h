@@ -5,11 +5,14 @@
 #ifndef MULTI_THREADING_LOOPER_H_
 #define MULTI_THREADING_LOOPER_H_
 
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <future>
 #include <queue>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "foundation/logging.h"
 #include "task.h"
@@ -28,6 +31,10 @@ class Dispatcher;
  */
 class Looper {
  public:
+  using TimerClock = std::chrono::steady_clock;
+  // Runs deferrable work until |deadline|, returns true if some is left for the next idle period.
+  using IdleHandler = std::function<bool(TimerClock::time_point deadline)>;
+
   Looper(int32_t js_id);
   ~Looper();
 
@@ -69,6 +76,30 @@ class Looper {
     return task_copy->getResult();
   }
 
+  /**
+   * @brief Run a task on this thread once |delay_ms| has elapsed, without any roundtrip to dart.
+   * Timers are kept in a min-heap ordered by deadline. All timers which expired by the time the thread wakes up are
+   * fired together, in deadline order, before the next posted task.
+   * Posting with the |timer_id| of a pending timer replaces it.
+   */
+  template <typename Func, typename... Args>
+  void PostDelayedMessage(int32_t timer_id, int64_t delay_ms, Func&& func, Args&&... args) {
+    auto task = std::make_shared<ConcreteTask<Func, Args...>>(std::forward<Func>(func), std::forward<Args>(args)...);
+    ScheduleTimer(timer_id, delay_ms, std::move(task));
+  }
+
+  void CancelDelayedMessage(int32_t timer_id);
+
+  // Paused timers keep their deadlines, the ones expired meanwhile are fired once resumed.
+  void PauseTimers();
+  void ResumeTimers();
+
+  /**
+   * @brief Give |handler| the time the thread would otherwise spend waiting, in slices ending before the next timer
+   * is due. It runs again once it returned true, or once another task or timer ran on this thread.
+   */
+  void SetIdleHandler(IdleHandler handler);
+
   void Stop();
 
   void SetOpaque(void* p, OpaqueFinalizer finalizer);
@@ -79,11 +110,37 @@ class Looper {
   void ExecuteOpaqueFinalizer();
 
  private:
+  struct PendingTimer {
+    TimerClock::time_point deadline;
+    // Keeps timers with the same deadline in scheduling order, and tells stale entries apart.
+    uint64_t sequence;
+    int32_t timer_id;
+    std::shared_ptr<Task> task;
+  };
+
+  struct PendingTimerLater {
+    bool operator()(const PendingTimer& a, const PendingTimer& b) const {
+      return a.deadline > b.deadline || (a.deadline == b.deadline && a.sequence > b.sequence);
+    }
+  };
+
   void Run();
+  void ScheduleTimer(int32_t timer_id, int64_t delay_ms, std::shared_ptr<Task>&& task);
+  // The following methods must be called with |mutex_| held.
+  bool HasPendingTimer();
+  void TakeExpiredTimers(TimerClock::time_point now, std::vector<std::shared_ptr<Task>>& expired);
 
   std::condition_variable cv_;
   std::mutex mutex_;
   std::queue<std::shared_ptr<Task>> tasks_;
+  // Canceled timers are removed lazily, |active_timers_| maps each live timer to the sequence of its heap entry.
+  std::priority_queue<PendingTimer, std::vector<PendingTimer>, PendingTimerLater> timers_;
+  std::unordered_map<int32_t, uint64_t> active_timers_;
+  uint64_t timer_sequence_{0};
+  bool timers_paused_{false};
+  IdleHandler idle_handler_;
+  // Set once a task or timer ran, cleared once the idle handler has nothing left to do.
+  bool idle_work_pending_{false};
   std::thread worker_;
   bool paused_;
   bool running_;
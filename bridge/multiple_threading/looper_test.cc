@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "looper.h"
+#include "gtest/gtest.h"
+
+using namespace webf::multi_threading;
+
+namespace {
+
+struct TimerLog {
+  std::mutex mutex;
+  std::vector<int> fired;
+  std::promise<void> done;
+};
+
+void LogTimer(TimerLog* log, int value, bool last) {
+  std::lock_guard<std::mutex> lock(log->mutex);
+  log->fired.emplace_back(value);
+  if (last)
+    log->done.set_value();
+}
+
+}  // namespace
+
+TEST(Looper, delayedMessagesFireInDeadlineOrder) {
+  Looper looper(1);
+  looper.Start();
+  TimerLog log;
+
+  looper.PostDelayedMessage(1, 30, LogTimer, &log, 3, true);
+  looper.PostDelayedMessage(2, 10, LogTimer, &log, 2, false);
+  // Same deadline as far as the clock resolution goes, fired in posting order.
+  looper.PostDelayedMessage(3, 0, LogTimer, &log, 0, false);
+  looper.PostDelayedMessage(4, 0, LogTimer, &log, 1, false);
+
+  EXPECT_EQ(log.done.get_future().wait_for(std::chrono::seconds(2)), std::future_status::ready);
+  looper.Stop();
+
+  EXPECT_EQ(log.fired, (std::vector<int>{0, 1, 2, 3}));
+}
+
+TEST(Looper, canceledAndReplacedMessagesDoNotFire) {
+  Looper looper(1);
+  looper.Start();
+  TimerLog log;
+
+  looper.PostDelayedMessage(1, 5, LogTimer, &log, 1, false);
+  looper.CancelDelayedMessage(1);
+  // Replaces the pending timer 2.
+  looper.PostDelayedMessage(2, 5, LogTimer, &log, 2, false);
+  looper.PostDelayedMessage(2, 10, LogTimer, &log, 3, false);
+  // Enough canceled entries to trigger the compaction of the heap.
+  for (int i = 0; i < 200; i++) {
+    looper.PostDelayedMessage(100 + i, 10000, LogTimer, &log, -1, false);
+    looper.CancelDelayedMessage(100 + i);
+  }
+  looper.PostDelayedMessage(3, 20, LogTimer, &log, 4, true);
+
+  EXPECT_EQ(log.done.get_future().wait_for(std::chrono::seconds(2)), std::future_status::ready);
+  looper.Stop();
+
+  EXPECT_EQ(log.fired, (std::vector<int>{3, 4}));
+}
+
+TEST(Looper, pausedTimersFireOnceResumed) {
+  Looper looper(1);
+  looper.Start();
+  TimerLog log;
+  auto done = log.done.get_future();
+
+  looper.PauseTimers();
+  looper.PostDelayedMessage(1, 0, LogTimer, &log, 1, false);
+  looper.PostDelayedMessage(2, 5, LogTimer, &log, 2, true);
+
+  // Posted tasks still run while timers are paused.
+  std::promise<void> task_done;
+  looper.PostMessage([&task_done]() { task_done.set_value(); });
+  EXPECT_EQ(task_done.get_future().wait_for(std::chrono::seconds(2)), std::future_status::ready);
+
+  EXPECT_EQ(done.wait_for(std::chrono::milliseconds(30)), std::future_status::timeout);
+  looper.ResumeTimers();
+  EXPECT_EQ(done.wait_for(std::chrono::seconds(2)), std::future_status::ready);
+  looper.Stop();
+
+  EXPECT_EQ(log.fired, (std::vector<int>{1, 2}));
+}
+
+TEST(Looper, idleHandlerRunsUntilDoneAfterEachTask) {
+  Looper looper(1);
+  looper.Start();
+  std::atomic<int> calls{0};
+  std::promise<void> first_done;
+  std::promise<void> second_done;
+  std::promise<void> third_done;
+  Looper::TimerClock::time_point timer_deadline = Looper::TimerClock::time_point::max();
+  Looper::TimerClock::time_point second_deadline;
+
+  looper.SetIdleHandler([&](Looper::TimerClock::time_point deadline) {
+    int call = ++calls;
+    if (call == 3)
+      first_done.set_value();
+    if (call == 4) {
+      second_deadline = deadline;
+      second_done.set_value();
+    }
+    if (call == 5)
+      third_done.set_value();
+    // Runs three times, then once after each task or timer.
+    return call < 3;
+  });
+
+  EXPECT_EQ(first_done.get_future().wait_for(std::chrono::seconds(2)), std::future_status::ready);
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(calls, 3);
+
+  std::promise<void> timer_fired;
+  looper.PostMessage([&]() {
+    looper.PostDelayedMessage(1, 2, [&timer_fired]() { timer_fired.set_value(); });
+    timer_deadline = Looper::TimerClock::now() + std::chrono::milliseconds(2);
+  });
+  EXPECT_EQ(second_done.get_future().wait_for(std::chrono::seconds(2)), std::future_status::ready);
+  // Idle slices end before the pending timer is due.
+  EXPECT_LE(second_deadline, timer_deadline);
+
+  EXPECT_EQ(timer_fired.get_future().wait_for(std::chrono::seconds(2)), std::future_status::ready);
+  EXPECT_EQ(third_done.get_future().wait_for(std::chrono::seconds(2)), std::future_status::ready);
+  looper.Stop();
+  EXPECT_EQ(calls, 5);
+}
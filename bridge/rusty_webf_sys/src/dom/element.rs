@@ -4,6 +4,7 @@
 
 use std::ffi::*;
 use crate::*;
+use crate::memory_utils::safe_free_cpp_ptr;
 
 #[repr(C)]
 pub struct ElementRustMethods {
@@ -12,6 +13,8 @@ pub struct ElementRustMethods {
   pub style: extern "C" fn(*const OpaquePtr) -> RustValue<CSSStyleDeclarationRustMethods>,
   pub to_blob: extern "C" fn(*const OpaquePtr, *const WebFNativeFunctionContext, *const OpaquePtr) -> c_void,
   pub to_blob_with_device_pixel_ratio: extern "C" fn(*const OpaquePtr, c_double, *const WebFNativeFunctionContext, *const OpaquePtr) -> c_void,
+  pub outer_html: extern "C" fn(*const OpaquePtr) -> *const c_char,
+  pub inner_html: extern "C" fn(*const OpaquePtr) -> *const c_char,
 }
 
 impl RustMethods for ElementRustMethods {}
@@ -105,12 +108,34 @@ impl Element {
     }
     future_for_return
   }
+
+  pub fn outer_html(&self) -> String {
+    let event_target: &EventTarget = &self.container_node.node.event_target;
+    let value = unsafe {
+      ((*self.method_pointer).outer_html)(event_target.ptr)
+    };
+    let result = unsafe { CStr::from_ptr(value) }.to_str().unwrap().to_string();
+    safe_free_cpp_ptr(value);
+    result
+  }
+
+  pub fn inner_html(&self) -> String {
+    let event_target: &EventTarget = &self.container_node.node.event_target;
+    let value = unsafe {
+      ((*self.method_pointer).inner_html)(event_target.ptr)
+    };
+    let result = unsafe { CStr::from_ptr(value) }.to_str().unwrap().to_string();
+    safe_free_cpp_ptr(value);
+    result
+  }
 }
 
 pub trait ElementMethods: ContainerNodeMethods {
   fn style(&self) -> CSSStyleDeclaration;
   fn to_blob(&self, exception_state: &ExceptionState) -> WebFNativeFuture<Vec<u8>>;
   fn to_blob_with_device_pixel_ratio(&self, device_pixel_ratio: f64, exception_state: &ExceptionState) -> WebFNativeFuture<Vec<u8>>;
+  fn outer_html(&self) -> String;
+  fn inner_html(&self) -> String;
 }
 
 impl ContainerNodeMethods for Element {}
@@ -178,4 +203,10 @@ impl ElementMethods for Element {
   fn to_blob_with_device_pixel_ratio(&self, device_pixel_ratio: f64, exception_state: &ExceptionState) -> WebFNativeFuture<Vec<u8>> {
     self.to_blob_with_device_pixel_ratio(device_pixel_ratio, exception_state)
   }
+  fn outer_html(&self) -> String {
+    self.outer_html()
+  }
+  fn inner_html(&self) -> String {
+    self.inner_html()
+  }
 }
@@ -32,6 +32,14 @@ impl ElementMethods for HTMLElement {
   fn to_blob_with_device_pixel_ratio(&self, device_pixel_ratio: f64, exception_state: &ExceptionState) -> WebFNativeFuture<Vec<u8>> {
     self.element.to_blob_with_device_pixel_ratio(device_pixel_ratio, exception_state)
   }
+
+  fn outer_html(&self) -> String {
+    self.element.outer_html()
+  }
+
+  fn inner_html(&self) -> String {
+    self.element.inner_html()
+  }
 }
 
 impl ContainerNodeMethods for HTMLElement {}
@@ -210,6 +210,15 @@ const pluginApiList = [
   'events/ui_event.d.ts',
 ];
 
+// Sequences have no representation in the plugin API yet, the methods returning them are left out.
+function removeMethodsReturningSequences(blob) {
+  blob.objects.forEach(object => {
+    if (object instanceof ClassObject) {
+      object.methods = object.methods.filter(method => !method.returnType.isArray);
+    }
+  });
+}
+
 genCodeFromTypeDefine();
 genCodeFromJSONData();
 genPluginAPICodeFromTypeDefine();
@@ -233,6 +242,7 @@ function genPluginAPICodeFromTypeDefine() {
   for (let i = 0; i < blobs.length; i ++) {
     let b = blobs[i];
     analyzer(b, definedPropertyCollector, unionTypeCollector);
+    removeMethodsReturningSequences(b);
   }
 
   buildClassRelationship();
@@ -271,6 +281,7 @@ function genRustCodeFromTypeDefine() {
   for (let i = 0; i < blobs.length; i ++) {
     let b = blobs[i];
     analyzer(b, definedPropertyCollector, unionTypeCollector);
+    removeMethodsReturningSequences(b);
   }
 
   buildClassRelationship();
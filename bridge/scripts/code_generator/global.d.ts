@@ -10,6 +10,8 @@ declare function Dictionary() : any;
 declare type JSEventListener = void;
 
 declare type LegacyNullToEmptyString = string | null;
+// A string which is stored without being interned into the atom table, for text payloads.
+declare type NonAtomicString = string;
 
 // This property is implemented by Dart side
 type DartImpl<T> = T;
@@ -17,4 +19,7 @@ type StaticMember<T> = T;
 type StaticMethod<T> = T;
 
 
-type DependentsOnLayout<T> = T;
\ No newline at end of file
+type DependentsOnLayout<T> = T;
+// The call is recorded into the display list of the executing context and replayed by Dart in batch.
+// Only valid inside DartImpl<> for members without return values.
+type Recordable<T> = T;
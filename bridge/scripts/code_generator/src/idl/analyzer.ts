@@ -150,6 +150,11 @@ function getParameterBaseType(type: ts.TypeNode, mode?: ParameterMode): Paramete
             mode.layoutDependent = true;
           }
           argument = typeReference.typeArguments![0] as unknown as ts.TypeNode;
+        } else if (identifier == 'Recordable') {
+          if (mode) {
+            mode.recordable = true;
+          }
+          argument = typeReference.typeArguments![0] as unknown as ts.TypeNode;
         }
       }
 
@@ -167,6 +172,8 @@ function getParameterBaseType(type: ts.TypeNode, mode?: ParameterMode): Paramete
       return getParameterBaseType(argument);
     } else if (identifier === 'LegacyNullToEmptyString') {
       return FunctionArgumentType.legacy_dom_string;
+    } else if (identifier === 'NonAtomicString') {
+      return FunctionArgumentType.non_atomic_string;
     }
 
     return identifier;
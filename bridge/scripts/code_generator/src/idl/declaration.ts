@@ -18,6 +18,8 @@ export enum FunctionArgumentType {
   js_array_proto_methods,
   // enable LegacyNullToEmpty attribute for dom_string
   legacy_dom_string,
+  // dom_string which is not interned into the atom table
+  non_atomic_string,
 }
 
 export class FunctionArguments {
@@ -33,6 +35,7 @@ export class ParameterMode {
   newObject?: boolean;
   dartImpl?: boolean;
   layoutDependent?: boolean;
+  recordable?: boolean;
   static?: boolean;
   staticMethod?: boolean;
 }
@@ -81,6 +81,9 @@ export function generateCoreTypeValue(type: ParameterType): string {
     case FunctionArgumentType.legacy_dom_string: {
       return 'AtomicString';
     }
+    case FunctionArgumentType.non_atomic_string: {
+      return 'String';
+    }
     case FunctionArgumentType.any: {
       return 'ScriptValue';
     }
@@ -116,7 +119,8 @@ export function generateRawTypeValue(type: ParameterType, is32Bit: boolean = fal
       return 'int64_t';
     }
     case FunctionArgumentType.dom_string:
-    case FunctionArgumentType.legacy_dom_string: {
+    case FunctionArgumentType.legacy_dom_string:
+    case FunctionArgumentType.non_atomic_string: {
       if (is32Bit) {
         return 'int64_t';
       }
@@ -264,6 +268,9 @@ export function generateIDLTypeConverter(type: ParameterType, isOptional?: boole
         // TODO: legacy is now allowed with nullable
         returnValue = 'IDLLegacyDOMString'
         break;
+      case FunctionArgumentType.non_atomic_string:
+        returnValue = 'IDLNonAtomicString';
+        break;
       default:
       case FunctionArgumentType.any:
         returnValue = `IDLAny`;
@@ -346,6 +353,9 @@ function generateDartImplCallCode(blob: IDLBlob, declare: FunctionDeclaration, i
   let returnValueAssignment = '';
 
   if (declare.returnType.value != FunctionArgumentType.void) {
+    if (declare.returnTypeMode?.recordable) {
+      throw new Error(`Recordable<T> method ${getClassName(blob)}.${declare.name} can not have return values.`);
+    }
     returnValueAssignment = 'auto&& native_value =';
   }
 
@@ -354,7 +364,8 @@ auto* self = toScriptWrappable<${getClassName(blob)}>(JS_IsUndefined(this_val) ?
 ${nativeArguments.length > 0 ? `NativeValue arguments[] = {
   ${nativeArguments.join(',\n')}
 }` : 'NativeValue* arguments = nullptr;'};
-${returnValueAssignment}self->InvokeBindingMethod(binding_call_methods::k${declare.name}, ${nativeArguments.length}, arguments, FlushUICommandReason::kDependentsOnElement${isLayoutIndependent ? '| FlushUICommandReason::kDependentsOnLayout' : ''}, exception_state);
+${declare.returnTypeMode?.recordable ? `self->RecordBindingMethod(binding_call_methods::k${declare.name}, ${nativeArguments.length}, arguments, exception_state);` :
+  `${returnValueAssignment}self->InvokeBindingMethod(binding_call_methods::k${declare.name}, ${nativeArguments.length}, arguments, FlushUICommandReason::kDependentsOnElement${isLayoutIndependent ? '| FlushUICommandReason::kDependentsOnLayout' : ''}, exception_state);`}
 ${returnValueAssignment.length > 0 ? `return Converter<${generateIDLTypeConverter(declare.returnType)}>::ToValue(NativeValueConverter<${generateNativeValueTypeConverter(declare.returnType)}>::FromNativeValue(native_value))` : ''};
   `.trim();
 }
@@ -537,7 +548,7 @@ function generateFunctionBody(blob: IDLBlob, declare: FunctionDeclaration, optio
   ExecutingContext* context = ExecutingContext::From(ctx);
   if (!context->IsContextValid()) return JS_NULL;
 
-  context->dartIsolateContext()->profiler()->StartTrackSteps("${getClassName(blob)}::${declare.name}");
+  TraceScope trace_scope(context->dartIsolateContext()->profiler(), WEBF_TRACE_LABEL("${getClassName(blob)}::${declare.name}"));
 
   MemberMutationScope scope{context};
   ${returnValueInit}
@@ -546,8 +557,6 @@ function generateFunctionBody(blob: IDLBlob, declare: FunctionDeclaration, optio
 ${addIndent(callBody, 4)}
   } while (false);
 
-   context->dartIsolateContext()->profiler()->FinishTrackSteps();
-
   if (UNLIKELY(exception_state.HasException())) {
     return exception_state.ToQuickJS();
   }
@@ -701,10 +710,16 @@ const WrapperTypeInfo& ${className}::wrapper_type_info_ = QJS${className}::wrapp
     return '';
   });
 
+  const content = contents.join('\n');
+  // Labels of the tracepoints above, their names are registered for the exported traces.
+  const traceLabels = _.uniq((content.match(/WEBF_TRACE_LABEL\("[^"]*"\)/g) || [])
+    .map(tracepoint => tracepoint.slice('WEBF_TRACE_LABEL('.length, -1)));
+
   return _.template(baseTemplate)({
-    content: contents.join('\n'),
+    content,
     className,
     blob: blob,
+    traceLabels,
     ...options
   }).split('\n').filter(str => {
     return str.trim().length > 0;
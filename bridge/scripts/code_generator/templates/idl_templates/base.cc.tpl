@@ -24,6 +24,7 @@
 #include "core/dom/static_node_list.h"
 #include "core/html/html_all_collection.h"
 #include "defined_properties.h"
+#include "foundation/trace_event.h"
 
 namespace webf {
 
@@ -32,6 +33,12 @@ namespace webf {
 <% } %>
 <%= content %>
 
+<% if (traceLabels.length > 0) { %>
+static TraceLabelRegistrar trace_label_registrar {
+  <%= traceLabels.join(',\n') %>
+};
+<% } %>
+
 <% if (globalFunctionInstallList.length > 0 || classPropsInstallList.length > 0 || classMethodsInstallList.length > 0 || constructorInstallList.length > 0) { %>
 void QJS<%= className %>::Install(ExecutingContext* context) {
   <% if (globalFunctionInstallList.length > 0) { %> InstallGlobalFunctions(context); <% } %>
@@ -10,13 +10,12 @@ JSValue QJS<%= className %>::ConstructorCallback(JSContext* ctx, JSValue func_ob
     ExceptionState exception_state;
     ExecutingContext* context = ExecutingContext::From(ctx);
     if (!context->IsContextValid()) return false;
-    context->dartIsolateContext()->profiler()->StartTrackSteps("QJS<%= className %>::PropertyCheckerCallback");
+    TraceScope trace_scope(context->dartIsolateContext()->profiler(), WEBF_TRACE_LABEL("QJS<%= className %>::PropertyCheckerCallback"));
     auto* wrapper_type_info = DOMTokenList::GetStaticWrapperTypeInfo();
     MemberMutationScope scope{context};
     JSValue prototype = context->contextData()->prototypeForType(wrapper_type_info);
     if (JS_HasProperty(ctx, prototype, key)) return true;
     bool result = self->NamedPropertyQuery(AtomicString(ctx, key), exception_state);
-    context->dartIsolateContext()->profiler()->FinishTrackSteps();
     if (UNLIKELY(exception_state.HasException())) {
       return false;
     }
@@ -28,7 +27,7 @@ JSValue QJS<%= className %>::ConstructorCallback(JSContext* ctx, JSValue func_ob
     ExecutingContext* context = ExecutingContext::From(ctx);
     if (!context->IsContextValid()) return 0;
     MemberMutationScope scope{context};
-    context->dartIsolateContext()->profiler()->StartTrackSteps("QJS<%= className %>::PropertyEnumerateCallback");
+    TraceScope trace_scope(context->dartIsolateContext()->profiler(), WEBF_TRACE_LABEL("QJS<%= className %>::PropertyEnumerateCallback"));
     std::vector<AtomicString> props;
     self->NamedPropertyEnumerator(props, exception_state);
     auto size = props.size() == 0 ? 1 : props.size();
@@ -40,7 +39,6 @@ JSValue QJS<%= className %>::ConstructorCallback(JSContext* ctx, JSValue func_ob
 
     *plen = props.size();
     *ptab = tabs;
-    context->dartIsolateContext()->profiler()->FinishTrackSteps();
     return 0;
   }
 
@@ -54,9 +52,8 @@ JSValue QJS<%= className %>::ConstructorCallback(JSContext* ctx, JSValue func_ob
     if (index >= self->length()) {
       return JS_UNDEFINED;
     }
-    context->dartIsolateContext()->profiler()->StartTrackSteps("QJS<%= className %>::IndexedPropertyGetterCallback");
+    TraceScope trace_scope(context->dartIsolateContext()->profiler(), WEBF_TRACE_LABEL("QJS<%= className %>::IndexedPropertyGetterCallback"));
     <%= generateCoreTypeValue(object.indexedProp.type) %> result = self->item(index, exception_state);
-    context->dartIsolateContext()->profiler()->FinishTrackSteps();
     if (UNLIKELY(exception_state.HasException())) {
       return exception_state.ToQuickJS();
     }
@@ -69,10 +66,9 @@ JSValue QJS<%= className %>::ConstructorCallback(JSContext* ctx, JSValue func_ob
     ExceptionState exception_state;
     ExecutingContext* context = ExecutingContext::From(ctx);
     if (!context->IsContextValid()) return JS_NULL;
-    context->dartIsolateContext()->profiler()->StartTrackSteps("QJS<%= className %>::StringPropertyGetterCallback");
+    TraceScope trace_scope(context->dartIsolateContext()->profiler(), WEBF_TRACE_LABEL("QJS<%= className %>::StringPropertyGetterCallback"));
     MemberMutationScope scope{context};
     ${generateCoreTypeValue(object.indexedProp.type)} result = self->item(AtomicString(ctx, key), exception_state);
-    context->dartIsolateContext()->profiler()->FinishTrackSteps();
     if (UNLIKELY(exception_state.HasException())) {
       return exception_state.ToQuickJS();
     }
@@ -91,9 +87,8 @@ JSValue QJS<%= className %>::ConstructorCallback(JSContext* ctx, JSValue func_ob
     if (UNLIKELY(exception_state.HasException())) {
       return false;
     }
-    context->dartIsolateContext()->profiler()->StartTrackSteps("QJS<%= className %>::IndexedPropertySetterCallback");
+    TraceScope trace_scope(context->dartIsolateContext()->profiler(), WEBF_TRACE_LABEL("QJS<%= className %>::IndexedPropertySetterCallback"));
     bool success = self->SetItem(index, v, exception_state);
-    context->dartIsolateContext()->profiler()->FinishTrackSteps();
     if (UNLIKELY(exception_state.HasException())) {
       return false;
     }
@@ -110,9 +105,8 @@ JSValue QJS<%= className %>::ConstructorCallback(JSContext* ctx, JSValue func_ob
     if (UNLIKELY(exception_state.HasException())) {
       return false;
     }
-    context->dartIsolateContext()->profiler()->StartTrackSteps("QJS<%= className %>::StringPropertySetterCallback");
+    TraceScope trace_scope(context->dartIsolateContext()->profiler(), WEBF_TRACE_LABEL("QJS<%= className %>::StringPropertySetterCallback"));
     bool success = self->SetItem(AtomicString(ctx, key), v, exception_state);
-    context->dartIsolateContext()->profiler()->FinishTrackSteps();
     if (UNLIKELY(exception_state.HasException())) {
       return false;
     }
@@ -128,9 +122,8 @@ JSValue QJS<%= className %>::ConstructorCallback(JSContext* ctx, JSValue func_ob
       if (UNLIKELY(exception_state.HasException())) {
         return false;
       }
-      context->dartIsolateContext()->profiler()->StartTrackSteps("QJS<%= className %>::StringPropertyDeleterCallback");
+      TraceScope trace_scope(context->dartIsolateContext()->profiler(), WEBF_TRACE_LABEL("QJS<%= className %>::StringPropertyDeleterCallback"));
       bool success = self->DeleteItem(AtomicString(ctx, key), exception_state);
-      context->dartIsolateContext()->profiler()->FinishTrackSteps();
       if (UNLIKELY(exception_state.HasException())) {
         return false;
       }
@@ -183,7 +176,7 @@ static JSValue <%= prop.name %>AttributeGetCallback(JSContext* ctx, JSValueConst
   ExecutingContext* context = ExecutingContext::From(ctx);
   if (!context->IsContextValid()) return JS_NULL;
   MemberMutationScope scope{context};
-  context->dartIsolateContext()->profiler()->StartTrackSteps("<%= className %>::<%= prop.name %>");
+  TraceScope trace_scope(context->dartIsolateContext()->profiler(), WEBF_TRACE_LABEL("<%= className %>::<%= prop.name %>"));
 
   <% if (prop.typeMode && prop.typeMode.dartImpl) { %>
   ExceptionState exception_state;
@@ -193,23 +186,18 @@ static JSValue <%= prop.name %>AttributeGetCallback(JSContext* ctx, JSValueConst
   typename <%= generateNativeValueTypeConverter(prop.type) %>::ImplType v = NativeValueConverter<<%= generateNativeValueTypeConverter(prop.type) %>>::FromNativeValue(<%= blob.filename %>->GetBindingProperty(binding_call_methods::k<%= prop.name %>, FlushUICommandReason::kDependentsOnElement  <%= prop.typeMode.layoutDependent ? '| FlushUICommandReason::kDependentsOnLayout' : '' %>, exception_state));
   <% } %>
   if (UNLIKELY(exception_state.HasException())) {
-    context->dartIsolateContext()->profiler()->FinishTrackSteps();
     return exception_state.ToQuickJS();
   }
   auto result = Converter<<%= generateIDLTypeConverter(prop.type, prop.optional) %>>::ToValue(ctx, v);
-  context->dartIsolateContext()->profiler()->FinishTrackSteps();
   return result;
   <% } else if (prop.typeMode && prop.typeMode.static) { %>
   auto result = Converter<<%= generateIDLTypeConverter(prop.type, prop.optional) %>>::ToValue(ctx, <%= className %>::<%= prop.name %>);
-  context->dartIsolateContext()->profiler()->FinishTrackSteps();
   return result;
   <% } else if (prop.typeMode && prop.typeMode.staticMethod) { %>
   auto result = Converter<<%= generateIDLTypeConverter(prop.type, prop.optional) %>>::ToValue(ctx, <%= className %>::<%= prop.name %>());
-  context->dartIsolateContext()->profiler()->FinishTrackSteps();
   return result;
   <% } else { %>
   auto result = Converter<<%= generateIDLTypeConverter(prop.type, prop.optional) %>>::ToValue(ctx, <%= blob.filename %>-><%= prop.name %>());
-  context->dartIsolateContext()->profiler()->FinishTrackSteps();
   return result;
   <% } %>
 
@@ -226,7 +214,9 @@ static JSValue <%= prop.name %>AttributeSetCallback(JSContext* ctx, JSValueConst
   if (exception_state.HasException()) {
     return exception_state.ToQuickJS();
   }
-  <% if (prop.typeMode && prop.typeMode.dartImpl) { %>
+  <% if (prop.typeMode && prop.typeMode.dartImpl && prop.typeMode.recordable) { %>
+  <%= blob.filename %>->RecordBindingProperty(binding_call_methods::k<%= prop.name %>, NativeValueConverter<<%= generateNativeValueTypeConverter(prop.type) %>>::ToNativeValue(<% if (isDOMStringType(prop.type)) { %>ctx, <% } %>v),exception_state);
+  <% } else if (prop.typeMode && prop.typeMode.dartImpl) { %>
   <%= blob.filename %>->SetBindingProperty(binding_call_methods::k<%= prop.name %>, NativeValueConverter<<%= generateNativeValueTypeConverter(prop.type) %>>::ToNativeValue(<% if (isDOMStringType(prop.type)) { %>ctx, <% } %>v),exception_state);
   <% } else {%>
   <%= blob.filename %>->set<%= prop.name[0].toUpperCase() + prop.name.slice(1) %>(v, exception_state);
@@ -0,0 +1,160 @@
+// Generated from template:
+//   code_generator/src/json/templates/css_property_names.cc.tpl
+// and input files:
+//   <%= template_path %>
+
+#include "<%= name %>.h"
+
+<%
+// Minimal perfect hash over both spellings of every property, built with the hash-and-displace method:
+// keys are first grouped into buckets by hash(0, key), then each bucket is given a seed (or a direct slot for
+// single key buckets) so that every key of the table ends up in its own slot.
+function kebabCase(name) {
+  return name.replace(/[A-Z]/g, c => '-' + c.toLowerCase());
+}
+function hash(seed, key) {
+  let h = seed === 0 ? 0x811c9dc5 : seed;
+  for (let i = 0; i < key.length; i++) {
+    h = Math.imul(h ^ key.charCodeAt(i), 0x01000193) >>> 0;
+  }
+  return h;
+}
+
+let keys = [];
+let seen = new Set();
+data.forEach((name, index) => {
+  [name, kebabCase(name)].forEach(key => {
+    if (seen.has(key)) return;
+    seen.add(key);
+    keys.push({ key: key, id: index + 1 });
+  });
+});
+
+let size = keys.length;
+let buckets = [];
+for (let i = 0; i < size; i++) buckets.push([]);
+keys.forEach(entry => buckets[hash(0, entry.key) % size].push(entry));
+buckets.sort((a, b) => b.length - a.length);
+
+let seeds = new Array(size).fill(0);
+let slots = new Array(size).fill(null);
+let bucketIndex = 0;
+for (; bucketIndex < buckets.length && buckets[bucketIndex].length > 1; bucketIndex++) {
+  let bucket = buckets[bucketIndex];
+  let seed = 1;
+  let placed = [];
+  for (let item = 0; item < bucket.length;) {
+    let slot = hash(seed, bucket[item].key) % size;
+    if (slots[slot] !== null || placed.indexOf(slot) >= 0) {
+      seed++;
+      item = 0;
+      placed = [];
+    } else {
+      placed.push(slot);
+      item++;
+    }
+  }
+  seeds[hash(0, bucket[0].key) % size] = seed;
+  placed.forEach((slot, i) => { slots[slot] = bucket[i]; });
+}
+
+let freeSlots = [];
+slots.forEach((entry, slot) => { if (entry === null) freeSlots.push(slot); });
+for (; bucketIndex < buckets.length && buckets[bucketIndex].length == 1; bucketIndex++) {
+  let slot = freeSlots.pop();
+  seeds[hash(0, buckets[bucketIndex][0].key) % size] = -slot - 1;
+  slots[slot] = buckets[bucketIndex][0];
+}
+%>
+
+namespace webf {
+namespace <%= name %> {
+
+namespace {
+
+struct PropertySlot {
+  const char* name;
+  uint8_t length;
+  CSSPropertyID id;
+};
+
+constexpr uint32_t kTableSize = <%= size %>;
+
+const int32_t kSeeds[kTableSize] = {
+<% _.forEach(_.chunk(seeds, 16), function(chunk) { %>
+  <%= chunk.join(', ') %>,
+<% }) %>
+};
+
+const PropertySlot kSlots[kTableSize] = {
+<% _.forEach(slots, function(entry) { %>
+  {"<%= entry.key %>", <%= entry.key.length %>, static_cast<CSSPropertyID>(<%= entry.id %>)},
+<% }) %>
+};
+
+const char* const kCamelCaseNames[kCSSPropertyIDCount + 1] = {
+  "",
+<% _.forEach(data, function(name) { %>
+  "<%= name %>",
+<% }) %>
+  nullptr,
+};
+
+const char* const kKebabCaseNames[kCSSPropertyIDCount] = {
+  "",
+<% _.forEach(data, function(name) { %>
+  "<%= kebabCase(name) %>",
+<% }) %>
+};
+
+template <typename CharType>
+inline uint32_t Hash(uint32_t seed, const CharType* name, size_t length) {
+  uint32_t hash = seed == 0 ? 0x811c9dc5 : seed;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ static_cast<uint32_t>(name[i])) * 0x01000193;
+  }
+  return hash;
+}
+
+template <typename CharType>
+CSSPropertyID Lookup(const CharType* name, size_t length) {
+  if (length == 0 || length > UINT8_MAX)
+    return CSSPropertyID::kInvalid;
+
+  int32_t seed = kSeeds[Hash(0, name, length) % kTableSize];
+  uint32_t slot = seed < 0 ? static_cast<uint32_t>(-seed - 1) : Hash(static_cast<uint32_t>(seed), name, length) % kTableSize;
+
+  const PropertySlot& entry = kSlots[slot];
+  if (entry.length != length)
+    return CSSPropertyID::kInvalid;
+  for (size_t i = 0; i < length; i++) {
+    if (static_cast<uint32_t>(entry.name[i]) != static_cast<uint32_t>(name[i]))
+      return CSSPropertyID::kInvalid;
+  }
+  return entry.id;
+}
+
+}  // namespace
+
+CSSPropertyID LookupCSSPropertyID(const char* name, size_t length) {
+  return Lookup(reinterpret_cast<const unsigned char*>(name), length);
+}
+
+CSSPropertyID LookupCSSPropertyID(const char16_t* name, size_t length) {
+  return Lookup(name, length);
+}
+
+const char* GetCamelCaseName(CSSPropertyID id) {
+  return kCamelCaseNames[static_cast<uint16_t>(id)];
+}
+
+const char* GetKebabCaseName(CSSPropertyID id) {
+  return kKebabCaseNames[static_cast<uint16_t>(id)];
+}
+
+const char* const* GetCamelCaseNames() {
+  return kCamelCaseNames;
+}
+
+}
+} // webf
@@ -0,0 +1,40 @@
+// Generated from template:
+//   code_generator/src/json/templates/css_property_names.h.tpl
+// and input files:
+//   <%= template_path %>
+
+#ifndef <%= _.snakeCase(name).toUpperCase() %>_H_
+#define <%= _.snakeCase(name).toUpperCase() %>_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace webf {
+
+enum class CSSPropertyID : uint16_t {
+  kInvalid = 0,
+<% _.forEach(data, function(name, index) { %>
+  k<%= _.upperFirst(name) %> = <%= index + 1 %>,
+<% }) %>
+};
+
+constexpr unsigned kCSSPropertyIDCount = <%= data.length + 1 %>;
+
+namespace <%= name %> {
+
+// Accepts both the camelCase name used by CSSStyleDeclaration and the kebab-case name used in CSS text.
+// Returns CSSPropertyID::kInvalid for custom properties and unknown names.
+CSSPropertyID LookupCSSPropertyID(const char* name, size_t length);
+CSSPropertyID LookupCSSPropertyID(const char16_t* name, size_t length);
+
+const char* GetCamelCaseName(CSSPropertyID id);
+const char* GetKebabCaseName(CSSPropertyID id);
+
+// camelCase names indexed by CSSPropertyID, terminated by nullptr.
+const char* const* GetCamelCaseNames();
+
+}
+
+} // webf
+
+#endif  // #define <%= _.snakeCase(name).toUpperCase() %>
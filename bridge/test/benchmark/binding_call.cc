@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include <benchmark/benchmark.h>
+#include "webf_test_env.h"
+
+using namespace webf;
+
+// Calls cheap DOM bindings in a tight loop, what dominates is the cost every binding call pays, such as opening its
+// MemberMutationScope.
+static void RunBindingLoop(benchmark::State& state, const char* loop_body) {
+  static auto env = TEST_init();
+  auto context = env->page()->executingContext();
+  std::string setup =
+      "var benchmarkParent = document.createElement('div');"
+      "var benchmarkElement = document.createElement('div');"
+      "benchmarkElement.setAttribute('id', 'target');"
+      "benchmarkParent.appendChild(benchmarkElement);";
+  context->EvaluateJavaScript(setup.c_str(), setup.size(), "internal://", 0);
+
+  std::string code = std::string("(() => { let result; for (let i = 0; i < 10000; i++) { ") + loop_body + " } })();";
+  for (auto _ : state) {
+    context->EvaluateJavaScript(code.c_str(), code.size(), "internal://", 0);
+  }
+  state.SetItemsProcessed(state.iterations() * 10000);
+}
+
+static void ElementGetAttribute(benchmark::State& state) {
+  RunBindingLoop(state, "result = benchmarkElement.getAttribute('id');");
+}
+
+static void NodeParentNode(benchmark::State& state) {
+  RunBindingLoop(state, "result = benchmarkElement.parentNode;");
+}
+
+BENCHMARK(ElementGetAttribute)->Threads(1);
+BENCHMARK(NodeParentNode)->Threads(1);
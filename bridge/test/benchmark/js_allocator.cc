@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include <benchmark/benchmark.h>
+#include <quickjs/quickjs.h>
+#include <cstring>
+
+// Compares the QuickJS slab allocator (state.range(0) == 1) with the malloc of the build on workloads dominated by
+// small objects, shapes and strings. The malloc of the build is mimalloc, or the system allocator when configured
+// with -DUSE_SYSTEM_MALLOC=1. The slab allocator is only compiled in with -DENABLE_SLAB_ALLOC=ON, the runs with it
+// are skipped otherwise.
+static void RunAllocationLoop(benchmark::State& state, const char* code) {
+  JSRuntime* runtime = JS_NewRuntime();
+  if (!JS_EnableSlabAllocator(runtime, state.range(0) != 0) && state.range(0) != 0) {
+    JS_FreeRuntime(runtime);
+    state.SkipWithError("built without ENABLE_SLAB_ALLOC");
+    return;
+  }
+  JSContext* context = JS_NewContext(runtime);
+  for (auto _ : state) {
+    JSValue result = JS_Eval(context, code, strlen(code), "internal://", JS_EVAL_TYPE_GLOBAL);
+    JS_FreeValue(context, result);
+  }
+  JSMemoryUsage usage;
+  JS_ComputeMemoryUsage(runtime, &usage);
+  state.counters["malloc_size"] = usage.malloc_size;
+  JS_FreeContext(context);
+  JS_FreeRuntime(runtime);
+}
+
+static void AllocateObjects(benchmark::State& state) {
+  RunAllocationLoop(state,
+                    "(() => { let keep = []; for (let i = 0; i < 100000; i++) {"
+                    " const o = { x: i, y: i + 1, z: { w: i } }; if ((i & 63) == 0) keep.push(o); } })();");
+}
+
+static void AllocateShapes(benchmark::State& state) {
+  RunAllocationLoop(state,
+                    "(() => { for (let i = 0; i < 20000; i++) {"
+                    " const o = {}; o['a' + (i & 7)] = 1; o.b = 2; o.c = 3; o.d = 4; } })();");
+}
+
+static void AllocateStrings(benchmark::State& state) {
+  RunAllocationLoop(state, "(() => { let n = 0; for (let i = 0; i < 100000; i++) n += ('k' + i).length; })();");
+}
+
+BENCHMARK(AllocateObjects)->Arg(0)->Arg(1);
+BENCHMARK(AllocateShapes)->Arg(0)->Arg(1);
+BENCHMARK(AllocateStrings)->Arg(0)->Arg(1);
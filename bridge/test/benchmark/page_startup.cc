@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include <benchmark/benchmark.h>
+#include "webf_bridge.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+// Time from creating a page to the end of its first script, the polyfill and the plugins are evaluated in between.
+static void PageTimeToFirstScript(benchmark::State& state) {
+  auto dart_methods = TEST_getMockDartMethods(nullptr);
+  void* dart_isolate_context = initDartIsolateContextSync(0, dart_methods.data(), dart_methods.size(), false);
+  std::string plugin = "globalThis.__benchmark_plugin__ = { version: 1, items: [1, 2, 3].map(i => i * 2) };";
+  registerPluginCode(plugin.c_str(), static_cast<int32_t>(plugin.size()), "vm://benchmark_plugin.js");
+
+  const char* code = "document.body.appendChild(document.createElement('div'));";
+  double page_id = -10000;
+  for (auto _ : state) {
+    auto* page = static_cast<WebFPage*>(allocateNewPageSync(page_id, dart_isolate_context));
+    page->evaluateScript(code, strlen(code), "vm://", 0);
+
+    state.PauseTiming();
+    disposePageSync(page_id, dart_isolate_context, page);
+    state.ResumeTiming();
+  }
+
+  delete static_cast<DartIsolateContext*>(dart_isolate_context);
+}
+
+BENCHMARK(PageTimeToFirstScript)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include <benchmark/benchmark.h>
+#include "webf_test_env.h"
+
+using namespace webf;
+
+// Builds a tree of 10000 nodes with |build_tree| and reads the markup returned by |serialize| in the loop.
+static void RunSerializeLoop(benchmark::State& state, const char* build_tree, const char* serialize) {
+  static auto env = TEST_init();
+  auto context = env->page()->executingContext();
+  context->EvaluateJavaScript(build_tree, strlen(build_tree), "internal://", 0);
+
+  std::string code = std::string("(() => { return ") + serialize + ".length; })();";
+  for (auto _ : state) {
+    context->EvaluateJavaScript(code.c_str(), code.size(), "internal://", 0);
+  }
+  state.SetItemsProcessed(state.iterations() * 10000);
+}
+
+static void SerializeWideTree(benchmark::State& state) {
+  RunSerializeLoop(state,
+                   "globalThis.tree = document.createElement('ul');"
+                   "for (let i = 0; i < 5000; i++) {"
+                   "  const li = document.createElement('li');"
+                   "  li.setAttribute('id', 'item-' + i);"
+                   "  li.appendChild(document.createTextNode('item & ' + i));"
+                   "  tree.appendChild(li);"
+                   "}",
+                   "tree.outerHTML");
+}
+
+static void SerializeDeepTree(benchmark::State& state) {
+  RunSerializeLoop(state,
+                   "globalThis.deepTree = document.createElement('div');"
+                   "let parent = deepTree;"
+                   "for (let i = 0; i < 5000; i++) {"
+                   "  const child = document.createElement('div');"
+                   "  child.appendChild(document.createTextNode('' + i));"
+                   "  parent.appendChild(child);"
+                   "  parent = child;"
+                   "}",
+                   "deepTree.innerHTML");
+}
+
+BENCHMARK(SerializeWideTree)->Threads(1);
+BENCHMARK(SerializeDeepTree)->Threads(1);
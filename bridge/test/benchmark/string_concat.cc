@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include <benchmark/benchmark.h>
+#include "webf_test_env.h"
+
+using namespace webf;
+
+// Builds strings by repeated concatenation, the way templating and serialization code does, which copies the whole
+// string on every step unless the engine can append in place.
+static void RunConcatLoop(benchmark::State& state, const char* loop_body) {
+  static auto env = TEST_init();
+  auto context = env->page()->executingContext();
+
+  std::string code = std::string("(() => { let result = ''; for (let i = 0; i < 10000; i++) { ") + loop_body +
+                     " } return result.length; })();";
+  for (auto _ : state) {
+    context->EvaluateJavaScript(code.c_str(), code.size(), "internal://", 0);
+  }
+  state.SetItemsProcessed(state.iterations() * 10000);
+}
+
+static void StringAppendShort(benchmark::State& state) {
+  RunConcatLoop(state, "result += 'ab';");
+}
+
+static void StringAppendMarkup(benchmark::State& state) {
+  RunConcatLoop(state, "result = result + '<li id=\"item-' + i + '\">' + i + '</li>';");
+}
+
+// Appends to a string which is then read, so every step flattens it.
+static void StringAppendAndRead(benchmark::State& state) {
+  RunConcatLoop(state, "result += 'ab'; if (result.charCodeAt(i) < 0) break;");
+}
+
+BENCHMARK(StringAppendShort)->Threads(1);
+BENCHMARK(StringAppendMarkup)->Threads(1);
+BENCHMARK(StringAppendAndRead)->Threads(1);
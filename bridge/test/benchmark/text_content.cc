@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include <benchmark/benchmark.h>
+#include "webf_test_env.h"
+
+using namespace webf;
+
+static void RunTextLoop(benchmark::State& state, const char* setup, const char* loop_body, int items) {
+  static auto env = TEST_init();
+  auto context = env->page()->executingContext();
+  context->EvaluateJavaScript(setup, strlen(setup), "internal://", 0);
+
+  std::string code = std::string("(() => { let length = 0; ") + loop_body + " return length; })();";
+  for (auto _ : state) {
+    context->EvaluateJavaScript(code.c_str(), code.size(), "internal://", 0);
+  }
+  state.SetItemsProcessed(state.iterations() * items);
+}
+
+// Reads the text of a list of 200 long messages.
+static void TextContentRead(benchmark::State& state) {
+  RunTextLoop(state,
+              "globalThis.messages = document.createElement('ul');"
+              "for (let i = 0; i < 200; i++) {"
+              "  const li = document.createElement('li');"
+              "  li.appendChild(document.createTextNode('message ' + i + ': ' + 'lorem ipsum '.repeat(20)));"
+              "  messages.appendChild(li);"
+              "}",
+              "for (let i = 0; i < 100; i++) length += messages.textContent.length;", 100);
+}
+
+// Replaces the data of a text node with unique strings, such as a chat message or a JSON payload.
+static void TextSetUniqueData(benchmark::State& state) {
+  RunTextLoop(state,
+              "globalThis.textNode = document.createTextNode('');"
+              "globalThis.round = 0;",
+              "round++;"
+              "for (let i = 0; i < 1000; i++) {"
+              "  textNode.data = JSON.stringify({ round, i, body: 'lorem ipsum '.repeat(16) });"
+              "  length += textNode.length;"
+              "}",
+              1000);
+}
+
+BENCHMARK(TextContentRead)->Threads(1);
+BENCHMARK(TextSetUniqueData)->Threads(1);
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "foundation/ui_command_ring_buffer.h"
+#include "webf_test_env.h"
+
+using namespace webf;
+
+// Emulates the dedicated thread mode: the benchmark thread acts as the JS thread and publishes segments of
+// |state.range(0)| commands, while a second thread acts as the Dart UI thread and consumes them.
+// ui_stall_ns_avg / ui_stall_ns_max report how long the consumer spends inside each read, which is the time the UI
+// thread would be stalled by the JS thread.
+static void UICommandRingBufferThroughput(benchmark::State& state) {
+  static auto env = TEST_init();
+  auto* context = env->page()->executingContext();
+  UICommandRingBuffer ring_buffer(context);
+
+  const int64_t commands_per_segment = state.range(0);
+  std::atomic<bool> running{true};
+  int64_t consumed_commands = 0;
+  int64_t consumed_segments = 0;
+  int64_t total_stall_ns = 0;
+  int64_t max_stall_ns = 0;
+
+  std::thread consumer([&]() {
+    while (running.load(std::memory_order_acquire) || !ring_buffer.Empty()) {
+      auto start = std::chrono::steady_clock::now();
+      UICommandBuffer* segment = ring_buffer.Front();
+      if (segment != nullptr) {
+        consumed_commands += segment->size();
+        consumed_segments++;
+        ring_buffer.Pop();
+      }
+      int64_t stall_ns =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+      if (segment != nullptr) {
+        total_stall_ns += stall_ns;
+        max_stall_ns = std::max(max_stall_ns, stall_ns);
+      }
+    }
+  });
+
+  auto segment = std::make_unique<UICommandBuffer>(context);
+  for (auto _ : state) {
+    for (int64_t i = 0; i < commands_per_segment; i++) {
+      segment->addCommand(UICommand::kSetStyle, nullptr, nullptr, nullptr);
+    }
+    // The real producer keeps the commands in reserve when the ring is full, the benchmark simply retries.
+    while (!ring_buffer.Publish(segment)) {
+    }
+  }
+
+  running.store(false, std::memory_order_release);
+  consumer.join();
+
+  state.SetItemsProcessed(consumed_commands);
+  state.counters["ui_stall_ns_avg"] =
+      benchmark::Counter(consumed_segments > 0 ? static_cast<double>(total_stall_ns) / consumed_segments : 0);
+  state.counters["ui_stall_ns_max"] = benchmark::Counter(static_cast<double>(max_stall_ns));
+  state.counters["overflow"] = benchmark::Counter(static_cast<double>(ring_buffer.overflow_count()));
+}
+
+BENCHMARK(UICommandRingBufferThroughput)->Arg(16)->Arg(256)->Arg(2048)->UseRealTime();
@@ -17,24 +17,37 @@ list(APPEND WEBF_UNIT_TEST_SOURCEURCE
   ./test/webf_test_env.cc
   ./test/webf_test_env.h
   ./bindings/qjs/atomic_string_test.cc
+  ./bindings/qjs/dom_string_test.cc
   ./bindings/qjs/script_value_test.cc
   ./bindings/qjs/qjs_engine_patch_test.cc
+  ./bindings/qjs/code_cache_test.cc
   ./core/dom/events/custom_event_test.cc
   ./core/executing_context_test.cc
   ./core/frame/console_test.cc
   ./core/frame/module_manager_test.cc
   ./core/dom/events/event_target_test.cc
+  ./core/dom/events/event_coalescer_test.cc
   ./core/dom/document_test.cc
   ./core/dom/legacy/element_attribute_test.cc
   ./core/dom/node_test.cc
   ./core/html/html_collection_test.cc
   ./core/dom/element_test.cc
+  ./core/dom/selector_query_test.cc
+  ./core/dom/markup_serializer_test.cc
+  ./core/dom/geometry_cache_test.cc
   ./core/frame/dom_timer_test.cc
   ./core/frame/window_test.cc
   ./core/css/inline_css_style_declaration_test.cc
   ./core/html/html_element_test.cc
+  ./core/html/parser/html_parser_test.cc
+  ./core/html/canvas/canvas_display_list_test.cc
   ./core/html/custom/widget_element_test.cc
   ./core/timing/performance_test.cc
+  ./foundation/ui_command_coalescer_test.cc
+  ./foundation/trace_event_test.cc
+  ./foundation/ui_command_ring_buffer_test.cc
+  ./multiple_threading/dart_work_queue_test.cc
+  ./multiple_threading/looper_test.cc
 )
 
 ### webf_unit_test executable
@@ -82,6 +95,13 @@ add_executable(webf_benchmark
   ./test/webf_test_env.cc
   ./test/webf_test_env.h
   ./test/benchmark/create_element.cc
+  ./test/benchmark/ui_command_ring_buffer.cc
+  ./test/benchmark/binding_call.cc
+  ./test/benchmark/page_startup.cc
+  ./test/benchmark/string_concat.cc
+  ./test/benchmark/js_allocator.cc
+  ./test/benchmark/serialize_html.cc
+  ./test/benchmark/text_content.cc
 )
 target_include_directories(webf_benchmark PUBLIC
   ./third_party/googletest/googletest/include
@@ -227,6 +227,22 @@ std::unique_ptr<WebFTestEnv> TEST_init() {
   return TEST_init(nullptr);
 }
 
+std::string TEST_collectConsoleMessages(const char* setup,
+                                        const std::function<void(ExecutingContext* context, std::string& logs)>& task) {
+  static std::string logs;
+  logs.clear();
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logs += message + " ";
+  };
+  auto env = TEST_init();
+  auto* context = env->page()->executingContext();
+  env->page()->evaluateScript(setup, strlen(setup), "internal://", 0);
+
+  MemberMutationScope scope{context};
+  task(context, logs);
+  return logs;
+}
+
 std::unique_ptr<webf::WebFPage> TEST_allocateNewPage(OnJSError onJsError) {
   auto mockedDartMethods = TEST_getMockDartMethods(onJsError);
   auto dart_isolate_context = std::unique_ptr<DartIsolateContext>(
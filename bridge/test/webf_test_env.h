@@ -6,7 +6,9 @@
 #ifndef BRIDGE_TEST_WEBF_TEST_ENV_H_
 #define BRIDGE_TEST_WEBF_TEST_ENV_H_
 
+#include <functional>
 #include <memory>
+#include <string>
 #include "bindings/qjs/cppgc/mutation_scope.h"
 #include "core/dart_methods.h"
 #include "core/executing_context.h"
@@ -41,6 +43,10 @@ std::unique_ptr<WebFTestEnv> TEST_init(OnJSError onJsError);
 std::unique_ptr<WebFTestEnv> TEST_init();
 std::unique_ptr<WebFPage> TEST_allocateNewPage(OnJSError onJsError);
 void TEST_runLoop(ExecutingContext* context);
+// Evaluates |setup| in a new environment, then runs |task| in a member mutation scope. Returns the console messages
+// logged meanwhile, each one followed by a space, along with what |task| appended to them.
+std::string TEST_collectConsoleMessages(const char* setup,
+                                        const std::function<void(ExecutingContext* context, std::string& logs)>& task);
 std::vector<uint64_t> TEST_getMockDartMethods(OnJSError onJSError);
 void TEST_mockTestEnvDartMethods(void* testContext, OnJSError onJSError);
 void TEST_registerEventTargetDisposedCallback(int32_t context_unique_id, TEST_OnEventTargetDisposed callback);
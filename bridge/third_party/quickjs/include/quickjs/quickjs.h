@@ -86,6 +86,7 @@ enum {
   JS_TAG_BIG_FLOAT = -9,
   JS_TAG_SYMBOL = -8,
   JS_TAG_STRING = -7,
+  JS_TAG_STRING_ROPE = -6,       /* string built by concatenations, flattened on demand */
   JS_TAG_MODULE = -3,            /* used internally */
   JS_TAG_FUNCTION_BYTECODE = -2, /* used internally */
   JS_TAG_OBJECT = -1,
@@ -368,6 +369,58 @@ void JS_SetRuntimeOpaque(JSRuntime *rt, void *opaque);
 typedef void JS_MarkFunc(JSRuntime *rt, JSGCObjectHeader *gp);
 void JS_MarkValue(JSRuntime *rt, JSValueConst val, JS_MarkFunc *mark_func);
 void JS_RunGC(JSRuntime *rt);
+
+typedef enum {
+  JS_GC_PHASE_NONE,
+  JS_GC_PHASE_DECREF,
+  JS_GC_PHASE_REMOVE_CYCLES,
+} JSGCPhaseEnum;
+
+/* JS_GC_PHASE_REMOVE_CYCLES while the objects of garbage cycles are
+   freed, e.g. in their class finalizers */
+JSGCPhaseEnum JS_GetEnginePhase(JSRuntime *rt);
+
+/* Cycle collection in bounded slices. A slice runs the same cycle
+   detection as JS_RunGC() on at most 'budget' GC objects: the next
+   ones not visited by the current pass over the heap, and the objects
+   they reference. Cycles larger than a slice are left to JS_RunGC().
+   Return TRUE if more slices are needed to complete the pass. A new
+   pass only starts once the heap grew since the previous one, with a
+   collection of the objects created since the previous collection. */
+JS_BOOL JS_RunGCSlice(JSRuntime *rt, int budget);
+/* The collections triggered by allocations only visit the objects
+   created since the previous one, and run JS_RunGC() once the heap
+   doubled since the previous full collection. When enabled, they also
+   run a slice of 'slice_budget' of the other objects. */
+void JS_SetGCIncremental(JSRuntime *rt, JS_BOOL enable, int slice_budget);
+/* Allocate the blocks of at most 256 bytes from 64 KB pages owned by
+   the runtime, with a free list per size class. Return FALSE if the
+   slab allocator was not compiled in (CONFIG_SLAB_ALLOC). When compiled
+   in, it is enabled by default in the runtimes created by
+   JS_NewRuntime(). */
+JS_BOOL JS_EnableSlabAllocator(JSRuntime *rt, JS_BOOL enable);
+
+#define JS_GC_PAUSE_BUCKET_COUNT 16
+
+typedef struct JSGCStats {
+  int64_t full_count;
+  int64_t slice_count;
+  int64_t pass_count; /* completed passes of slices */
+  int64_t freed_count; /* objects freed as part of cycles */
+  int64_t full_max_pause_us;
+  int64_t slice_max_pause_us;
+  int64_t total_pause_us;
+  /* bucket 0 counts the pauses shorter than 1 us, bucket i the pauses
+     from 2^(i-1) to 2^i us, the last bucket all the longer ones */
+  int64_t full_pause_histogram[JS_GC_PAUSE_BUCKET_COUNT];
+  int64_t slice_pause_histogram[JS_GC_PAUSE_BUCKET_COUNT];
+  /* collections of the objects created since the previous one */
+  int64_t young_count;
+  int64_t young_max_pause_us;
+  int64_t young_pause_histogram[JS_GC_PAUSE_BUCKET_COUNT];
+} JSGCStats;
+
+void JS_GetGCStats(JSRuntime *rt, JSGCStats *s);
 JS_BOOL JS_IsLiveObject(JSRuntime *rt, JSValueConst obj);
 
 JSContext *JS_NewContext(JSRuntime *rt);
@@ -437,6 +490,11 @@ typedef struct JSMemoryUsage {
 
 void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s);
 void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt);
+/* Dump the state and the hit and miss counts of the inline caches of a
+   bytecode function and of the functions it defines. A property access
+   is megamorphic once its inline cache saw more shapes than it keeps:
+   it then uses a cache shared by the runtime. */
+void JS_DumpInlineCacheStats(FILE *fp, JSContext *ctx, JSValueConst func_obj);
 
 /* atom support */
 #define JS_ATOM_NULL 0
@@ -469,6 +527,9 @@ void JS_FreeAtom(JSContext *ctx, JSAtom v);
 void JS_FreeAtomRT(JSRuntime *rt, JSAtom v);
 JSValue JS_AtomToValue(JSContext *ctx, JSAtom atom);
 JSValue JS_AtomToString(JSContext *ctx, JSAtom atom);
+/* the string of an atom which is not a tagged integer, kept as long as
+   the atom */
+struct JSString *JS_GetAtomString(JSRuntime *rt, JSAtom atom);
 const char *JS_AtomToCString(JSContext *ctx, JSAtom atom);
 JSAtom JS_ValueToAtom(JSContext *ctx, JSValueConst val);
 
@@ -637,9 +698,10 @@ static inline JS_BOOL JS_IsUninitialized(JSValueConst v)
   return js_unlikely(JS_VALUE_GET_TAG(v) == JS_TAG_UNINITIALIZED);
 }
 
+/* also TRUE for ropes, use JS_ToString() or JS_ToCString() to read the characters */
 static inline JS_BOOL JS_IsString(JSValueConst v)
 {
-  return JS_VALUE_GET_TAG(v) == JS_TAG_STRING;
+  return JS_VALUE_GET_TAG(v) == JS_TAG_STRING || JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE;
 }
 
 static inline JS_BOOL JS_IsSymbol(JSValueConst v)
@@ -715,6 +777,10 @@ int JS_ToInt64Ext(JSContext *ctx, int64_t *pres, JSValueConst val);
 
 JSValue JS_NewStringLen(JSContext *ctx, const char *str1, size_t len1);
 JSValue JS_NewString(JSContext *ctx, const char *str);
+/* strings of the 8 bit (latin1) or the 16 bit characters of 'buf',
+   without UTF-8 decoding */
+JSValue JS_NewOneByteString(JSContext *ctx, const uint8_t *buf, uint32_t len);
+JSValue JS_NewTwoByteString(JSContext *ctx, const uint16_t *buf, uint32_t len);
 JSValue JS_NewAtomString(JSContext *ctx, const char *str);
 JSValue JS_ToString(JSContext *ctx, JSValueConst val);
 JSValue JS_ToPropertyKey(JSContext *ctx, JSValueConst val);
@@ -869,6 +935,10 @@ uint8_t* JS_WriteObject2(JSContext* ctx, size_t* psize, JSValueConst obj, int fl
 #define JS_READ_OBJ_SAB       (1 << 2) /* allow SharedArrayBuffer */
 #define JS_READ_OBJ_REFERENCE (1 << 3) /* allow object references */
 JSValue JS_ReadObject(JSContext* ctx, const uint8_t* buf, size_t buf_len, int flags);
+/* Bytecode written by JS_WriteObject() can only be read by a build
+   returning the same value: it changes with the bytecode format, the
+   opcodes and the predefined atoms */
+uint32_t JS_GetBytecodeVersion(void);
 /* instantiate and evaluate a bytecode function. Only used when
   reading a script or module with JS_ReadObject() */
 JSValue JS_EvalFunction(JSContext* ctx, JSValue fun_obj);
@@ -235,6 +235,7 @@ redo:
       JS_FreeValue(ctx, val);
       break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
       val = JS_StringToBigIntErr(ctx, val);
       if (JS_IsException(val))
         return NULL;
@@ -1519,10 +1520,10 @@ no_inline __exception int js_add_slow(JSContext *ctx, JSValue *sp)
     /* try to call an overloaded operator */
     if ((tag1 == JS_TAG_OBJECT &&
          (tag2 != JS_TAG_NULL && tag2 != JS_TAG_UNDEFINED &&
-          tag2 != JS_TAG_STRING)) ||
+          !JS_IsString(op2))) ||
         (tag2 == JS_TAG_OBJECT &&
          (tag1 != JS_TAG_NULL && tag1 != JS_TAG_UNDEFINED &&
-          tag1 != JS_TAG_STRING))) {
+          !JS_IsString(op1)))) {
       ret = js_call_binary_op_fallback(ctx, &res, op1, op2, OP_add,
                                        FALSE, HINT_NONE);
       if (ret != 0) {
@@ -1552,7 +1553,7 @@ no_inline __exception int js_add_slow(JSContext *ctx, JSValue *sp)
     tag2 = JS_VALUE_GET_NORM_TAG(op2);
   }
 
-  if (tag1 == JS_TAG_STRING || tag2 == JS_TAG_STRING) {
+  if (JS_IsString(op1) || JS_IsString(op2)) {
     sp[-2] = JS_ConcatString(ctx, op1, op2);
     if (JS_IsException(sp[-2]))
       goto exception;
@@ -1835,6 +1836,16 @@ no_inline int js_relational_slow(JSContext *ctx, JSValue *sp,
     JS_FreeValue(ctx, op1);
     goto exception;
   }
+  op1 = js_flatten_string_free(ctx, op1);
+  if (JS_IsException(op1)) {
+    JS_FreeValue(ctx, op2);
+    goto exception;
+  }
+  op2 = js_flatten_string_free(ctx, op2);
+  if (JS_IsException(op2)) {
+    JS_FreeValue(ctx, op1);
+    goto exception;
+  }
   tag1 = JS_VALUE_GET_NORM_TAG(op1);
   tag2 = JS_VALUE_GET_NORM_TAG(op2);
 
@@ -1969,6 +1980,16 @@ no_inline __exception int js_eq_slow(JSContext *ctx, JSValue *sp,
   op1 = sp[-2];
   op2 = sp[-1];
 redo:
+  op1 = js_flatten_string_free(ctx, op1);
+  if (JS_IsException(op1)) {
+    JS_FreeValue(ctx, op2);
+    goto exception;
+  }
+  op2 = js_flatten_string_free(ctx, op2);
+  if (JS_IsException(op2)) {
+    JS_FreeValue(ctx, op1);
+    goto exception;
+  }
   tag1 = JS_VALUE_GET_NORM_TAG(op1);
   tag2 = JS_VALUE_GET_NORM_TAG(op2);
   if (tag_is_number(tag1) && tag_is_number(tag2)) {
@@ -2352,7 +2373,7 @@ no_inline __exception int js_add_slow(JSContext *ctx, JSValue *sp)
     }
     tag1 = JS_VALUE_GET_TAG(op1);
     tag2 = JS_VALUE_GET_TAG(op2);
-    if (tag1 == JS_TAG_STRING || tag2 == JS_TAG_STRING) {
+    if (JS_IsString(op1) || JS_IsString(op2)) {
       sp[-2] = JS_ConcatString(ctx, op1, op2);
       if (JS_IsException(sp[-2]))
         goto exception;
@@ -2447,6 +2468,16 @@ no_inline int js_relational_slow(JSContext *ctx, JSValue *sp,
     JS_FreeValue(ctx, op1);
     goto exception;
   }
+  op1 = js_flatten_string_free(ctx, op1);
+  if (JS_IsException(op1)) {
+    JS_FreeValue(ctx, op2);
+    goto exception;
+  }
+  op2 = js_flatten_string_free(ctx, op2);
+  if (JS_IsException(op2)) {
+    JS_FreeValue(ctx, op1);
+    goto exception;
+  }
   if (JS_VALUE_GET_TAG(op1) == JS_TAG_STRING &&
       JS_VALUE_GET_TAG(op2) == JS_TAG_STRING) {
     JSString *p1, *p2;
@@ -2512,6 +2543,16 @@ no_inline __exception int js_eq_slow(JSContext *ctx, JSValue *sp,
   op1 = sp[-2];
   op2 = sp[-1];
 redo:
+  op1 = js_flatten_string_free(ctx, op1);
+  if (JS_IsException(op1)) {
+    JS_FreeValue(ctx, op2);
+    goto exception;
+  }
+  op2 = js_flatten_string_free(ctx, op2);
+  if (JS_IsException(op2)) {
+    JS_FreeValue(ctx, op1);
+    goto exception;
+  }
   tag1 = JS_VALUE_GET_NORM_TAG(op1);
   tag2 = JS_VALUE_GET_NORM_TAG(op2);
   if (tag1 == tag2 ||
@@ -2956,6 +2997,7 @@ redo:
         break;
       goto redo;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
       val = JS_StringToBigIntErr(ctx, val);
       break;
     case JS_TAG_OBJECT:
@@ -3510,6 +3552,7 @@ JSValue js_bigfloat_constructor(JSContext *ctx,
           break;
         goto redo;
       case JS_TAG_STRING:
+      case JS_TAG_STRING_ROPE:
       {
         const char *str, *p;
         size_t len;
@@ -4188,6 +4231,7 @@ redo:
         break;
       goto redo;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
     {
       const char *str, *p;
       size_t len;
@@ -362,6 +362,7 @@ JSValue js_json_check(JSContext *ctx, JSONStringifyContext *jsc,
       if (JS_IsFunction(ctx, val))
         break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
     case JS_TAG_INT:
     case JS_TAG_FLOAT64:
 #ifdef CONFIG_BIGNUM
@@ -543,6 +544,7 @@ int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
       JS_FreeValue(ctx, prop);
       return 0;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
       val = JS_ToQuotedStringFree(ctx, val);
       if (JS_IsException(val))
         goto exception;
@@ -672,7 +674,11 @@ JSValue JS_JSONStringify(JSContext *ctx, JSValueConst obj,
       goto exception;
     jsc->gap = JS_NewStringLen(ctx, "          ", n);
   } else if (JS_IsString(space)) {
-    JSString *p = JS_VALUE_GET_STRING(space);
+    JSString *p;
+    space = js_flatten_string_free(ctx, space);
+    if (JS_IsException(space))
+      goto exception;
+    p = JS_VALUE_GET_STRING(space);
     jsc->gap = js_sub_string(ctx, p, 0, min_int(p->len, 10));
   } else {
     jsc->gap = JS_DupValue(ctx, jsc->empty);
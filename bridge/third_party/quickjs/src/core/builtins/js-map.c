@@ -193,6 +193,9 @@ uint32_t map_hash_key(JSContext *ctx, JSValueConst key)
     case JS_TAG_STRING:
       h = hash_string(JS_VALUE_GET_STRING(key), 0);
       break;
+    case JS_TAG_STRING_ROPE:
+      h = js_string_value_hash(key, 0);
+      break;
     case JS_TAG_OBJECT:
     case JS_TAG_SYMBOL:
       h = (uintptr_t)JS_VALUE_GET_PTR(key) * 3163;
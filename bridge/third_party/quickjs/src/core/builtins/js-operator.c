@@ -76,14 +76,17 @@ BOOL js_strict_eq2(JSContext* ctx, JSValue op1, JSValue op2, JSStrictEqModeEnum
     case JS_TAG_UNDEFINED:
       res = (tag1 == tag2);
       break;
-    case JS_TAG_STRING: {
+    case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE: {
       JSString *p1, *p2;
-      if (tag1 != tag2) {
-        res = FALSE;
-      } else {
+      if (tag1 == JS_TAG_STRING && tag2 == JS_TAG_STRING) {
         p1 = JS_VALUE_GET_STRING(op1);
         p2 = JS_VALUE_GET_STRING(op2);
         res = (js_string_compare(ctx, p1, p2) == 0);
+      } else if (tag2 == JS_TAG_STRING || tag2 == JS_TAG_STRING_ROPE) {
+        res = js_string_value_equal(op1, op2);
+      } else {
+        res = FALSE;
       }
     } break;
     case JS_TAG_SYMBOL: {
@@ -304,6 +307,7 @@ __exception int js_operator_typeof(JSContext* ctx, JSValueConst op1) {
       atom = JS_ATOM_boolean;
       break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
       atom = JS_ATOM_string;
       break;
     case JS_TAG_OBJECT: {
@@ -149,6 +149,8 @@ JSValue js_string_constructor(JSContext* ctx, JSValueConst new_target, int argc,
 JSValue js_thisStringValue(JSContext* ctx, JSValueConst this_val) {
   if (JS_VALUE_GET_TAG(this_val) == JS_TAG_STRING)
     return JS_DupValue(ctx, this_val);
+  if (JS_VALUE_GET_TAG(this_val) == JS_TAG_STRING_ROPE)
+    return JS_ToString(ctx, this_val);
 
   if (JS_VALUE_GET_TAG(this_val) == JS_TAG_OBJECT) {
     JSObject* p = JS_VALUE_GET_OBJ(this_val);
@@ -649,8 +651,10 @@ JSValue js_string___GetSubstitution(JSContext* ctx, JSValueConst this_val, int a
   if (!JS_IsString(rep) || !JS_IsString(str))
     return JS_ThrowTypeError(ctx, "not a string");
 
-  sp = JS_VALUE_GET_STRING(str);
-  rp = JS_VALUE_GET_STRING(rep);
+  sp = js_get_string(ctx, str);
+  rp = js_get_string(ctx, rep);
+  if (!sp || !rp)
+    return JS_EXCEPTION;
 
   string_buffer_init(ctx, b, 0);
 
@@ -820,6 +820,13 @@ static int JS_WriteObjectRec(BCWriterState* s, JSValueConst obj) {
       bc_put_u8(s, BC_TAG_STRING);
       JS_WriteString(s, p);
     } break;
+    case JS_TAG_STRING_ROPE: {
+      JSString* p = js_rope_get_string(s->ctx, obj);
+      if (!p)
+        goto fail;
+      bc_put_u8(s, BC_TAG_STRING);
+      JS_WriteString(s, p);
+    } break;
     case JS_TAG_FUNCTION_BYTECODE:
       if (!s->allow_bytecode)
         goto invalid_tag;
@@ -2146,6 +2153,11 @@ static void bc_reader_free(BCReaderState* s) {
   js_free(s->ctx, s->objects);
 }
 
+uint32_t JS_GetBytecodeVersion(void) {
+  /* the predefined atoms and the opcodes are written as indexes */
+  return BC_VERSION | ((uint32_t)OP_COUNT << 8) | ((uint32_t)JS_ATOM_END << 20);
+}
+
 JSValue JS_ReadObject(JSContext* ctx, const uint8_t* buf, size_t buf_len, int flags) {
   BCReaderState ss, *s = &ss;
   JSValue obj;
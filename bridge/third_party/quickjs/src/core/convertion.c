@@ -265,7 +265,8 @@ redo:
       if (JS_IsException(val))
         return JS_EXCEPTION;
       goto redo;
-    case JS_TAG_STRING: {
+    case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE: {
       const char* str;
       const char* p;
       size_t len;
@@ -727,8 +728,9 @@ int JS_ToBoolFree(JSContext* ctx, JSValue val) {
       return JS_VALUE_GET_INT(val);
     case JS_TAG_EXCEPTION:
       return -1;
-    case JS_TAG_STRING: {
-      BOOL ret = JS_VALUE_GET_STRING(val)->len != 0;
+    case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE: {
+      BOOL ret = js_string_value_len(val) != 0;
       JS_FreeValue(ctx, val);
       return ret;
     }
@@ -1532,6 +1534,12 @@ JSValue JS_ToStringInternal(JSContext* ctx, JSValueConst val, BOOL is_ToProperty
   switch (tag) {
     case JS_TAG_STRING:
       return JS_DupValue(ctx, val);
+    case JS_TAG_STRING_ROPE: {
+      JSString* p = js_rope_get_string(ctx, val);
+      if (!p)
+        return JS_EXCEPTION;
+      return JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, p));
+    }
     case JS_TAG_INT:
       snprintf(buf, sizeof(buf), "%d", JS_VALUE_GET_INT(val));
       str = buf;
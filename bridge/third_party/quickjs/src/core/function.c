@@ -1942,7 +1942,7 @@ restart:
             goto add_loc_slow;
           *pv = JS_NewInt32(ctx, r);
           sp--;
-        } else if (JS_VALUE_GET_TAG(*pv) == JS_TAG_STRING) {
+        } else if (JS_IsString(*pv)) {
           JSValue op1;
           op1 = sp[-1];
           sp--;
@@ -28,6 +28,7 @@
 #include "builtins/js-map.h"
 #include "builtins/js-proxy.h"
 #include "bytecode.h"
+#include "ic.h"
 #include "malloc.h"
 #include "module.h"
 #include "object.h"
@@ -235,6 +236,13 @@ __maybe_unused void JS_DumpValueShort(JSRuntime* rt, JSValueConst val) {
       p = JS_VALUE_GET_STRING(val);
       JS_DumpString(rt, p);
     } break;
+    case JS_TAG_STRING_ROPE: {
+      JSStringRope* r = JS_VALUE_GET_STRING_ROPE(val);
+      if (r->str)
+        JS_DumpString(rt, r->str);
+      else
+        printf("[rope %u]", (unsigned)r->len);
+    } break;
     case JS_TAG_FUNCTION_BYTECODE: {
       JSFunctionBytecode* b = JS_VALUE_GET_PTR(val);
       char buf[ATOM_GET_STR_BUF_SIZE];
@@ -473,6 +481,9 @@ void __JS_FreeValueRT(JSRuntime* rt, JSValue v) {
         js_free_rt(rt, p);
       }
     } break;
+    case JS_TAG_STRING_ROPE:
+      js_free_rope_rt(rt, JS_VALUE_GET_STRING_ROPE(v));
+      break;
     case JS_TAG_OBJECT:
     case JS_TAG_FUNCTION_BYTECODE: {
       JSGCObjectHeader* p = JS_VALUE_GET_PTR(v);
@@ -482,6 +493,11 @@ void __JS_FreeValueRT(JSRuntime* rt, JSValue v) {
         if (rt->gc_phase == JS_GC_PHASE_NONE) {
           free_zero_refcount(rt);
         }
+      } else if (!(p->mark & 1)) {
+        /* only referenced by the cycles being freed, which happens
+           when a GC slice did not look at it: free it with them */
+        list_del(&p->link);
+        list_add_tail(&p->link, &rt->tmp_obj_list);
       }
     } break;
     case JS_TAG_MODULE:
@@ -517,9 +533,25 @@ void __JS_FreeValue(JSContext* ctx, JSValue v) {
 /* garbage collection */
 
 void add_gc_object(JSRuntime* rt, JSGCObjectHeader* h, JSGCObjectTypeEnum type) {
-  h->mark = 0;
+  /* new objects are left to the next pass of GC slices */
+  h->mark = rt->gc_pass_active ? rt->gc_pass_epoch << 1 : 0;
   h->gc_obj_type = type;
-  list_add_tail(&h->link, &rt->gc_obj_list);
+  list_add_tail(&h->link, &rt->gc_young_obj_list);
+}
+
+/* move all the elements of 'from' at the end of 'to' */
+static void gc_list_splice_tail(struct list_head* from, struct list_head* to) {
+  if (list_empty(from))
+    return;
+  from->next->prev = to->prev;
+  to->prev->next = from->next;
+  from->prev->next = to;
+  to->prev = from->prev;
+  init_list_head(from);
+}
+
+void js_gc_promote_young(JSRuntime* rt) {
+  gc_list_splice_tail(&rt->gc_young_obj_list, &rt->gc_obj_list);
 }
 
 void JS_MarkValue(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func) {
@@ -703,7 +735,7 @@ void gc_decref(JSRuntime* rt) {
      tmp_obj_list */
   list_for_each_safe(el, el1, &rt->gc_obj_list) {
     p = list_entry(el, JSGCObjectHeader, link);
-    assert(p->mark == 0);
+    assert((p->mark & 1) == 0);
     mark_children(rt, p, gc_decref_child);
     p->mark = 1;
     if (p->ref_count == 0) {
@@ -776,6 +808,7 @@ void gc_free_cycles(JSRuntime* rt) {
         JS_DumpGCObject(rt, p);
 #endif
         free_gc_object(rt, p);
+        rt->gc_stats.freed_count++;
         break;
       default:
         list_del(&p->link);
@@ -794,10 +827,46 @@ void gc_free_cycles(JSRuntime* rt) {
   init_list_head(&rt->gc_zero_ref_count_list);
 }
 
+static int64_t gc_time_us(void) {
+#if defined(_WIN32)
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+static void gc_record_pause(JSRuntime* rt, int64_t* histogram, int64_t* max_pause, int64_t pause) {
+  int i;
+
+  for (i = 0; i < JS_GC_PAUSE_BUCKET_COUNT - 1 && pause >= ((int64_t)1 << i); i++)
+    continue;
+  histogram[i]++;
+  if (pause > *max_pause)
+    *max_pause = pause;
+  rt->gc_stats.total_pause_us += pause;
+}
+
 void JS_RunGC(JSRuntime* rt) {
+  int64_t start;
+
   /* Turn off the GC running for some special reasons. */
   if (rt->gc_off) return;
 
+  start = gc_time_us();
+  /* the megamorphic inline cache keeps shapes and their prototypes
+     alive */
+  free_ic_megamorphic_cache(rt);
+  js_gc_promote_young(rt);
+  /* the marks are reset: a pass of GC slices would start over */
+  if (rt->gc_pass_active) {
+    rt->gc_pass_active = FALSE;
+    rt->gc_pass_threshold = 0;
+  }
+
   /* decrement the reference of the children of each object. mark =
      1 after this pass. */
   gc_decref(rt);
@@ -807,6 +876,199 @@ void JS_RunGC(JSRuntime* rt) {
 
   /* free the GC objects in a cycle */
   gc_free_cycles(rt);
+
+  rt->gc_full_threshold = rt->malloc_state.malloc_size * 2;
+  rt->gc_stats.full_count++;
+  gc_record_pause(rt, rt->gc_stats.full_pause_histogram, &rt->gc_stats.full_max_pause_us, gc_time_us() - start);
+}
+
+/* GC slices: the cycle detection of JS_RunGC() restricted to the
+   objects of the slice, which have bit 0 of their mark set. The
+   references from the other objects are counted as external ones, so
+   only the cycles contained in the slice are freed. The slice is built
+   from the objects not visited by the current pass, at the head of
+   gc_obj_list, and the objects they reference. The visited ones are
+   moved at the end of gc_obj_list with the pass epoch in their mark.
+
+   The young collection runs the same detection on the objects created
+   since the previous collection, in gc_young_obj_list. No write
+   barrier is needed: the references from the old objects to the young
+   ones are part of their reference count. */
+
+static void gc_slice_add_child(JSRuntime* rt, JSGCObjectHeader* p) {
+  if (!(p->mark & 1) && rt->gc_slice_budget > 0) {
+    list_del(&p->link);
+    list_add_tail(&p->link, &rt->gc_slice_obj_list);
+    p->mark = 1;
+    rt->gc_slice_budget--;
+  }
+}
+
+static void gc_slice_decref_child(JSRuntime* rt, JSGCObjectHeader* p) {
+  if (p->mark & 1) {
+    assert(p->ref_count > 0);
+    p->ref_count--;
+  }
+}
+
+static void gc_slice_scan_incref_child(JSRuntime* rt, JSGCObjectHeader* p) {
+  if (p->mark & 1) {
+    p->ref_count++;
+    if (p->ref_count == 1) {
+      /* ref_count was 0: remove from tmp_obj_list and add at the
+         end of the slice */
+      list_del(&p->link);
+      list_add_tail(&p->link, &rt->gc_slice_obj_list);
+    }
+  }
+}
+
+static void gc_slice_scan_incref_child2(JSRuntime* rt, JSGCObjectHeader* p) {
+  if (p->mark & 1)
+    p->ref_count++;
+}
+
+/* free the cycles contained in gc_slice_obj_list, the other objects of
+   the slice are moved at the end of gc_obj_list */
+static void gc_collect_slice_cycles(JSRuntime* rt) {
+  struct list_head *el, *el1;
+  JSGCObjectHeader* p;
+  int survivor_mark = rt->gc_pass_active ? rt->gc_pass_epoch << 1 : 0;
+
+  rt->gc_phase = JS_GC_PHASE_DECREF;
+  list_for_each(el, &rt->gc_slice_obj_list) {
+    p = list_entry(el, JSGCObjectHeader, link);
+    mark_children(rt, p, gc_slice_decref_child);
+  }
+  init_list_head(&rt->tmp_obj_list);
+  list_for_each_safe(el, el1, &rt->gc_slice_obj_list) {
+    p = list_entry(el, JSGCObjectHeader, link);
+    if (p->ref_count == 0) {
+      list_del(&p->link);
+      list_add_tail(&p->link, &rt->tmp_obj_list);
+    }
+  }
+
+  list_for_each(el, &rt->gc_slice_obj_list) {
+    p = list_entry(el, JSGCObjectHeader, link);
+    assert(p->ref_count > 0);
+    mark_children(rt, p, gc_slice_scan_incref_child);
+  }
+  list_for_each(el, &rt->tmp_obj_list) {
+    p = list_entry(el, JSGCObjectHeader, link);
+    mark_children(rt, p, gc_slice_scan_incref_child2);
+  }
+  rt->gc_phase = JS_GC_PHASE_NONE;
+
+  list_for_each_safe(el, el1, &rt->gc_slice_obj_list) {
+    p = list_entry(el, JSGCObjectHeader, link);
+    p->mark = survivor_mark;
+    list_del(&p->link);
+    list_add_tail(&p->link, &rt->gc_obj_list);
+  }
+
+  gc_free_cycles(rt);
+}
+
+/* return TRUE if the pass is complete */
+static BOOL gc_slice_collect(JSRuntime* rt, int budget) {
+  struct list_head *el, *cur;
+  BOOL pass_done = FALSE;
+
+  init_list_head(&rt->gc_slice_obj_list);
+  rt->gc_slice_budget = budget;
+  cur = &rt->gc_slice_obj_list;
+  while (rt->gc_slice_budget > 0) {
+    if (cur->next == &rt->gc_slice_obj_list) {
+      /* all the objects reachable from the slice were added: continue
+         with the next object not visited by this pass */
+      el = rt->gc_obj_list.next;
+      if (el == &rt->gc_obj_list ||
+          (list_entry(el, JSGCObjectHeader, link)->mark >> 1) == rt->gc_pass_epoch) {
+        pass_done = TRUE;
+        break;
+      }
+      gc_slice_add_child(rt, list_entry(el, JSGCObjectHeader, link));
+    }
+    cur = cur->next;
+    mark_children(rt, list_entry(cur, JSGCObjectHeader, link), gc_slice_add_child);
+  }
+
+  gc_collect_slice_cycles(rt);
+  return pass_done;
+}
+
+static void gc_collect_young(JSRuntime* rt) {
+  struct list_head* el;
+  int64_t start;
+
+  if (rt->gc_off || rt->gc_phase != JS_GC_PHASE_NONE || list_empty(&rt->gc_young_obj_list))
+    return;
+
+  start = gc_time_us();
+  list_for_each(el, &rt->gc_young_obj_list) {
+    list_entry(el, JSGCObjectHeader, link)->mark = 1;
+  }
+  init_list_head(&rt->gc_slice_obj_list);
+  /* the survivors are moved to gc_obj_list */
+  gc_list_splice_tail(&rt->gc_young_obj_list, &rt->gc_slice_obj_list);
+  gc_collect_slice_cycles(rt);
+
+  rt->gc_stats.young_count++;
+  gc_record_pause(rt, rt->gc_stats.young_pause_histogram, &rt->gc_stats.young_max_pause_us, gc_time_us() - start);
+}
+
+static BOOL gc_run_slice(JSRuntime* rt, int budget, BOOL force_pass) {
+  int64_t start;
+
+  if (rt->gc_off || rt->gc_phase != JS_GC_PHASE_NONE)
+    return FALSE;
+  if (!rt->gc_pass_active) {
+    if (!force_pass && rt->malloc_state.malloc_size < rt->gc_pass_threshold)
+      return FALSE;
+    /* the pass visits the survivors too */
+    gc_collect_young(rt);
+    rt->gc_pass_epoch = rt->gc_pass_epoch % 7 + 1;
+    rt->gc_pass_active = TRUE;
+  }
+
+  start = gc_time_us();
+  if (gc_slice_collect(rt, max_int(budget, 1))) {
+    rt->gc_pass_active = FALSE;
+    rt->gc_pass_threshold = rt->malloc_state.malloc_size + (rt->malloc_state.malloc_size >> 3);
+    rt->gc_stats.pass_count++;
+  }
+  rt->gc_stats.slice_count++;
+  gc_record_pause(rt, rt->gc_stats.slice_pause_histogram, &rt->gc_stats.slice_max_pause_us, gc_time_us() - start);
+  return rt->gc_pass_active;
+}
+
+BOOL JS_RunGCSlice(JSRuntime* rt, int budget) {
+  return gc_run_slice(rt, budget, FALSE);
+}
+
+/* called by js_trigger_gc(): most of the garbage is made of young
+   objects, the old ones are only all scanned once the heap doubled */
+void js_gc_step(JSRuntime* rt) {
+  gc_collect_young(rt);
+  if (rt->malloc_state.malloc_size >= rt->gc_full_threshold) {
+    JS_RunGC(rt);
+  } else if (rt->gc_incremental) {
+    gc_run_slice(rt, rt->gc_incremental_budget, TRUE);
+  }
+}
+
+void JS_SetGCIncremental(JSRuntime* rt, BOOL enable, int slice_budget) {
+  rt->gc_incremental = enable;
+  rt->gc_incremental_budget = slice_budget;
+}
+
+void JS_GetGCStats(JSRuntime* rt, JSGCStats* s) {
+  *s = rt->gc_stats;
+}
+
+JSGCPhaseEnum JS_GetEnginePhase(JSRuntime* rt) {
+  return rt->gc_phase;
 }
 
 void JS_TurnOffGC(JSRuntime *rt) {
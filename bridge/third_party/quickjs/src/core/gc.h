@@ -87,6 +87,10 @@ void gc_scan_incref_child(JSRuntime* rt, JSGCObjectHeader* p);
 void gc_scan_incref_child2(JSRuntime* rt, JSGCObjectHeader* p);
 void gc_scan(JSRuntime* rt);
 void gc_free_cycles(JSRuntime* rt);
+/* collect the young objects, then run a GC slice, or JS_RunGC() once
+   the heap doubled since the last one */
+void js_gc_step(JSRuntime* rt);
+void js_gc_promote_young(JSRuntime* rt);
 
     void free_var_ref(JSRuntime* rt, JSVarRef* var_ref);
 void free_object(JSRuntime* rt, JSObject* p);
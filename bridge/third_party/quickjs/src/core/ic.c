@@ -24,6 +24,7 @@
  */
 
 #include "ic.h"
+#include "string.h"
 
 static force_inline uint32_t get_index_hash(JSAtom atom, int hash_bits) {
   return (atom * 0x9e370001) >> (32 - hash_bits);
@@ -134,6 +135,112 @@ int free_ic(InlineCache *ic) {
   return 0;
 }
 
+static force_inline uint32_t get_megamorphic_hash(JSShape *shape, JSAtom atom) {
+  uint32_t h = (uint32_t)((uintptr_t)shape >> 4) ^ (atom * 0x9e370001);
+  return (h * 0x9e3779b1) >> (32 - IC_MEGAMORPHIC_CACHE_BITS);
+}
+
+/* TRUE if the lookup of 'atom' in 'p' only depends on its shape */
+static BOOL ic_is_shape_lookup(JSRuntime *rt, JSObject *p, JSAtom atom) {
+  if (!p->shape->is_hashed)
+    return FALSE;
+  if (!p->is_exotic)
+    return TRUE;
+  if (p->fast_array)
+    return p->class_id == JS_CLASS_ARRAY && !__JS_AtomIsTaggedInt(atom);
+  return rt->class_array[p->class_id].exotic == NULL;
+}
+
+static void free_ic_megamorphic_item(JSRuntime *rt, InlineCacheMegamorphicItem *mi) {
+  uint32_t i;
+  js_free_shape_null(rt, mi->shape);
+  for (i = 0; i < mi->depth; i++)
+    js_free_shape(rt, mi->proto_shapes[i]);
+  mi->shape = NULL;
+  mi->depth = 0;
+}
+
+void free_ic_megamorphic_cache(JSRuntime *rt) {
+  InlineCacheMegamorphicItem *cache = rt->ic_megamorphic_cache;
+  uint32_t i;
+  if (!cache)
+    return;
+  /* freeing the shapes may free objects which are not visible in the
+     cache anymore */
+  rt->ic_megamorphic_cache = NULL;
+  for (i = 0; i < (1 << IC_MEGAMORPHIC_CACHE_BITS); i++)
+    free_ic_megamorphic_item(rt, cache + i);
+  js_free_rt(rt, cache);
+}
+
+uint32_t get_ic_megamorphic_prop_offset(JSRuntime *rt, JSShape *shape, JSAtom atom,
+                                        BOOL is_set, JSObject **prototype) {
+  InlineCacheMegamorphicItem *mi;
+  JSObject *p;
+  uint32_t i;
+  if (!rt->ic_megamorphic_cache)
+    goto miss;
+  mi = rt->ic_megamorphic_cache + get_megamorphic_hash(shape, atom);
+  if (mi->shape != shape || mi->atom != atom)
+    goto miss;
+  /* the item may have been added by a get site */
+  if (is_set && !mi->writable)
+    goto miss;
+  /* the shapes held by the cache are not modified, so only the
+     prototypes up to the one holding the property can differ */
+  p = NULL;
+  for (i = 0; i < mi->depth; i++) {
+    p = i == 0 ? shape->proto : p->shape->proto;
+    if (p->shape != mi->proto_shapes[i])
+      goto miss;
+  }
+  *prototype = p;
+  return mi->prop_offset;
+miss:
+  *prototype = NULL;
+  return INLINE_CACHE_MISS;
+}
+
+static void add_ic_megamorphic_slot(JSRuntime *rt, JSAtom atom, JSObject *object,
+                                    uint32_t prop_offset, JSObject *prototype) {
+  JSShape *proto_shapes[IC_MEGAMORPHIC_PROTO_DEPTH];
+  InlineCacheMegamorphicItem *mi;
+  uint32_t i, depth;
+  JSObject *p;
+
+  depth = 0;
+  if (prototype) {
+    /* the objects before the prototype holding the property must not
+       have a lookup of their own */
+    if (!ic_is_shape_lookup(rt, object, atom))
+      return;
+    for (p = object->shape->proto; p != prototype; p = p->shape->proto) {
+      if (!p || depth == IC_MEGAMORPHIC_PROTO_DEPTH - 1 || !ic_is_shape_lookup(rt, p, atom))
+        return;
+      proto_shapes[depth++] = p->shape;
+    }
+    proto_shapes[depth++] = prototype->shape;
+  }
+  if (!rt->ic_megamorphic_cache) {
+    rt->ic_megamorphic_cache = js_mallocz_rt(rt, sizeof(InlineCacheMegamorphicItem) << IC_MEGAMORPHIC_CACHE_BITS);
+    if (!rt->ic_megamorphic_cache)
+      return;
+  }
+  mi = rt->ic_megamorphic_cache + get_megamorphic_hash(object->shape, atom);
+  free_ic_megamorphic_item(rt, mi);
+  /* the atom is a property of one of the shapes, so it is not freed
+     before the item */
+  mi->shape = js_dup_shape(object->shape);
+  mi->atom = atom;
+  mi->prop_offset = prop_offset;
+  mi->depth = depth;
+  mi->writable = !prototype &&
+      (get_shape_prop(object->shape)[prop_offset].flags &
+       (JS_PROP_TMASK | JS_PROP_WRITABLE | JS_PROP_LENGTH)) == JS_PROP_WRITABLE;
+  for (i = 0; i < depth; i++)
+    mi->proto_shapes[i] = js_dup_shape(proto_shapes[i]);
+}
+
 #if _MSC_VER
 void add_ic_slot(InlineCacheUpdate *icu, JSAtom atom, JSObject *object,
                      uint32_t prop_offset, JSObject* prototype)
@@ -142,7 +249,7 @@ force_inline void add_ic_slot(InlineCacheUpdate *icu, JSAtom atom, JSObject *obj
                               uint32_t prop_offset, JSObject* prototype)
 #endif
 {
-  int32_t i;
+  int32_t i, empty;
   uint32_t h;
   InlineCacheHashSlot *ch;
   InlineCacheRingSlot *cr;
@@ -169,6 +276,7 @@ force_inline void add_ic_slot(InlineCacheUpdate *icu, JSAtom atom, JSObject *obj
     }
 
   assert(cr != NULL);
+  empty = -1;
   i = cr->index;
   for (;;) {
     ci = cr->buffer + i;
@@ -176,14 +284,23 @@ force_inline void add_ic_slot(InlineCacheUpdate *icu, JSAtom atom, JSObject *obj
       ci->prop_offset = prop_offset;
       goto end;
     }
+    if (!ci->shape && empty < 0)
+      empty = i;
 
     i = (i + 1) % IC_CACHE_ITEM_CAPACITY;
     if (unlikely(i == cr->index)) {
-      cr->index = (cr->index + 1) % IC_CACHE_ITEM_CAPACITY;
       break;
     }
   }
 
+  if (cr->megamorphic || empty < 0) {
+    /* the ring is kept: its shapes are still the most frequent ones */
+    cr->megamorphic = TRUE;
+    add_ic_megamorphic_slot(rt, atom, object, prop_offset, prototype);
+    goto end;
+  }
+  cr->index = empty;
+
   ci = cr->buffer + cr->index;
   sh = ci->shape;
   if (ci->watchpoint_ref)
@@ -314,4 +431,56 @@ int ic_free_shape_proto_watchpoints(JSRuntime *rt, JSShape *shape) {
     p = p->shape->proto;
   }
   return 0;
-}
\ No newline at end of file
+}
+static void dump_ic_stats(FILE *fp, JSRuntime *rt, JSFunctionBytecode *b) {
+  char buf[ATOM_GET_STR_BUF_SIZE];
+  InlineCacheRingSlot *cr;
+  const char *state;
+  uint32_t i, j, shape_count;
+
+  fprintf(fp, "%s", b->func_name ? JS_AtomGetStrRT(rt, buf, sizeof(buf), b->func_name) : "<anonymous>");
+  if (b->has_debug)
+    fprintf(fp, " (%s:%d)", JS_AtomGetStrRT(rt, buf, sizeof(buf), b->debug.filename), b->debug.line_num);
+  fprintf(fp, "\n");
+  for (i = 0; b->ic && i < b->ic->count; i++) {
+    cr = b->ic->cache + i;
+    shape_count = 0;
+    for (j = 0; j < IC_CACHE_ITEM_CAPACITY; j++) {
+      if (cr->buffer[j].shape)
+        shape_count++;
+    }
+    if (cr->megamorphic)
+      state = "megamorphic";
+    else if (shape_count > 1)
+      state = "polymorphic";
+    else if (shape_count == 1)
+      state = "monomorphic";
+    else
+      state = "uninitialized";
+    fprintf(fp, "  %-24s %-13s %2u shapes %10u hits %10u misses\n",
+            JS_AtomGetStrRT(rt, buf, sizeof(buf), cr->atom), state, shape_count,
+            cr->hit_count, cr->miss_count);
+  }
+  /* the nested functions */
+  for (i = 0; i < b->cpool_count; i++) {
+    if (JS_VALUE_GET_TAG(b->cpool[i]) == JS_TAG_FUNCTION_BYTECODE)
+      dump_ic_stats(fp, rt, JS_VALUE_GET_PTR(b->cpool[i]));
+  }
+}
+
+void JS_DumpInlineCacheStats(FILE *fp, JSContext *ctx, JSValueConst func_obj) {
+  JSObject *p;
+
+  switch (JS_VALUE_GET_TAG(func_obj)) {
+    case JS_TAG_FUNCTION_BYTECODE:
+      dump_ic_stats(fp, ctx->rt, JS_VALUE_GET_PTR(func_obj));
+      break;
+    case JS_TAG_OBJECT:
+      p = JS_VALUE_GET_OBJ(func_obj);
+      if (p->class_id == JS_CLASS_BYTECODE_FUNCTION)
+        dump_ic_stats(fp, ctx->rt, p->u.func.function_bytecode);
+      break;
+    default:
+      break;
+  }
+}
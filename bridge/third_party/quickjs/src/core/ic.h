@@ -37,8 +37,14 @@ int free_ic(InlineCache *ic);
 void add_ic_slot(InlineCacheUpdate *icu, JSAtom atom, JSObject *object,
                      uint32_t prop_offset, JSObject* prototype);
 uint32_t add_ic_slot1(InlineCache *ic, JSAtom atom);
+uint32_t get_ic_megamorphic_prop_offset(JSRuntime *rt, JSShape *shape, JSAtom atom,
+                                        BOOL is_set, JSObject **prototype);
+void free_ic_megamorphic_cache(JSRuntime *rt);
+/* 'is_set' is TRUE for the set sites, which may only store into own
+   writable data properties */
 force_inline uint32_t get_ic_prop_offset(const InlineCacheUpdate *icu,
-                                        JSShape *shape, JSObject **prototype) {
+                                        JSShape *shape, BOOL is_set,
+                                        JSObject **prototype) {
   uint32_t i, cache_offset = icu->offset;
   InlineCache *ic = icu->ic;
   InlineCacheRingSlot *cr;
@@ -50,6 +56,7 @@ force_inline uint32_t get_ic_prop_offset(const InlineCacheUpdate *icu,
     buffer = cr->buffer + i;
     if (likely(buffer->shape == shape)) {
       cr->index = i;
+      cr->hit_count++;
       *prototype = buffer->proto;
       return buffer->prop_offset;
     }
@@ -60,6 +67,14 @@ force_inline uint32_t get_ic_prop_offset(const InlineCacheUpdate *icu,
     }
   }
 
+  if (unlikely(cr->megamorphic)) {
+    i = get_ic_megamorphic_prop_offset(ic->ctx->rt, shape, cr->atom, is_set, prototype);
+    if (i != INLINE_CACHE_MISS) {
+      cr->hit_count++;
+      return i;
+    }
+  }
+  cr->miss_count++;
   *prototype = NULL;
   return INLINE_CACHE_MISS;
 }
@@ -26,6 +26,14 @@
 #include "quickjs/cutils.h"
 #include "malloc.h"
 #include "exception.h"
+#include "gc.h"
+#include "slab.h"
+
+/* the objects allocated meanwhile are collected together while they
+   are still in the CPU caches, whatever the size of the heap */
+#ifndef JS_GC_YOUNG_SIZE
+#define JS_GC_YOUNG_SIZE (1024 * 1024)
+#endif
 
 void js_trigger_gc(JSRuntime* rt, size_t size) {
   BOOL force_gc;
@@ -38,8 +46,11 @@ void js_trigger_gc(JSRuntime* rt, size_t size) {
 #ifdef DUMP_GC
     printf("GC: size=%" PRIu64 "\n", (uint64_t)rt->malloc_state.malloc_size);
 #endif
-    JS_RunGC(rt);
-    rt->malloc_gc_threshold = rt->malloc_state.malloc_size + (rt->malloc_state.malloc_size >> 1);
+    size_t growth;
+    js_gc_step(rt);
+    /* bounded pauses with GC slices, so collect more often */
+    growth = rt->malloc_state.malloc_size >> (rt->gc_incremental ? 3 : 1);
+    rt->malloc_gc_threshold = rt->malloc_state.malloc_size + (growth < JS_GC_YOUNG_SIZE ? growth : JS_GC_YOUNG_SIZE);
   }
 }
 
@@ -68,19 +79,89 @@ size_t js_malloc_usable_size_unknown(const void* ptr) {
   return 0;
 }
 
+#ifdef CONFIG_SLAB_ALLOC
+/* the small blocks are taken from the slab pages of the runtime, whose
+   accounting is exact without malloc_usable_size() */
+static void* js_slab_malloc_rt(JSRuntime* rt, size_t size) {
+  JSMallocState* s = &rt->malloc_state;
+  size_t block_size = js_slab_block_size(size);
+  void* ptr;
+
+  if (unlikely(s->malloc_size + block_size > s->malloc_limit))
+    return NULL;
+  ptr = js_slab_alloc(rt, size);
+  if (!ptr)
+    return NULL;
+  s->malloc_count++;
+  s->malloc_size += block_size;
+  return ptr;
+}
+
+static void js_slab_free_rt(JSRuntime* rt, JSSlabPage* page, void* ptr) {
+  JSMallocState* s = &rt->malloc_state;
+
+  s->malloc_count--;
+  s->malloc_size -= page->block_size;
+  js_slab_free(rt, page, ptr);
+}
+#endif
+
 void* js_malloc_rt(JSRuntime* rt, size_t size) {
+#ifdef CONFIG_SLAB_ALLOC
+  if (rt->slab.enabled && size - 1 < JS_SLAB_MAX_SIZE)
+    return js_slab_malloc_rt(rt, size);
+#endif
   return rt->mf.js_malloc(&rt->malloc_state, size);
 }
 
 void js_free_rt(JSRuntime* rt, void* ptr) {
+#ifdef CONFIG_SLAB_ALLOC
+  JSSlabPage* page = js_slab_find_page(rt, ptr);
+  if (page) {
+    js_slab_free_rt(rt, page, ptr);
+    return;
+  }
+#endif
   rt->mf.js_free(&rt->malloc_state, ptr);
 }
 
 void* js_realloc_rt(JSRuntime* rt, void* ptr, size_t size) {
+#ifdef CONFIG_SLAB_ALLOC
+  JSSlabPage* page;
+  void* new_ptr;
+  size_t old_size;
+
+  if (!ptr) {
+    if (rt->slab.enabled && size - 1 < JS_SLAB_MAX_SIZE)
+      return js_slab_malloc_rt(rt, size);
+    return rt->mf.js_realloc(&rt->malloc_state, ptr, size);
+  }
+  page = js_slab_find_page(rt, ptr);
+  if (page) {
+    if (size == 0) {
+      js_slab_free_rt(rt, page, ptr);
+      return NULL;
+    }
+    old_size = page->block_size;
+    if (rt->slab.enabled && js_slab_block_size(size) == old_size)
+      return ptr;
+    new_ptr = js_malloc_rt(rt, size);
+    if (!new_ptr)
+      return NULL;
+    memcpy(new_ptr, ptr, old_size < size ? old_size : size);
+    js_slab_free_rt(rt, page, ptr);
+    return new_ptr;
+  }
+#endif
   return rt->mf.js_realloc(&rt->malloc_state, ptr, size);
 }
 
 size_t js_malloc_usable_size_rt(JSRuntime* rt, const void* ptr) {
+#ifdef CONFIG_SLAB_ALLOC
+  JSSlabPage* page = js_slab_find_page(rt, ptr);
+  if (page)
+    return page->block_size;
+#endif
   return rt->mf.js_malloc_usable_size(ptr);
 }
 
@@ -25,6 +25,7 @@
 
 #include "memory.h"
 #include "function.h"
+#include "gc.h"
 #include "runtime.h"
 #include "shape.h"
 #include "string.h"
@@ -106,6 +107,17 @@ static void compute_value_size(JSValueConst val, JSMemoryUsage_helper *hp)
     case JS_TAG_STRING:
       compute_jsstring_size(JS_VALUE_GET_STRING(val), hp);
       break;
+    case JS_TAG_STRING_ROPE: {
+      JSStringRope* r = JS_VALUE_GET_STRING_ROPE(val);
+      double s_ref_count = r->header.ref_count;
+      hp->str_count += 1 / s_ref_count;
+      hp->str_size += sizeof(*r) / s_ref_count;
+      if (r->buffer)
+        hp->str_size += (sizeof(*r->buffer) + (r->buffer->size << r->buffer->is_wide_char)) /
+                        (s_ref_count * r->buffer->ref_count);
+      else
+        compute_jsstring_size(r->str, hp);
+    } break;
 #ifdef CONFIG_BIGNUM
     case JS_TAG_BIG_INT:
     case JS_TAG_BIG_FLOAT:
@@ -178,6 +190,8 @@ void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s)
     }
   }
 
+  /* the young objects are old ones for the next collections */
+  js_gc_promote_young(rt);
   list_for_each(el, &rt->gc_obj_list) {
     JSGCObjectHeader *gp = list_entry(el, JSGCObjectHeader, link);
     JSObject *p;
@@ -451,6 +465,7 @@ void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt)
       int obj_classes[JS_CLASS_INIT_COUNT + 1] = { 0 };
       int class_id;
       struct list_head *el;
+      js_gc_promote_young(rt);
       list_for_each(el, &rt->gc_obj_list) {
         JSGCObjectHeader *gp = list_entry(el, JSGCObjectHeader, link);
         JSObject *p;
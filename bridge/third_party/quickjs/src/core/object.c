@@ -422,6 +422,18 @@ JSValue JS_GetPropertyInternal(JSContext *ctx, JSValueConst obj,
         }
       }
       break;
+      case JS_TAG_STRING_ROPE:
+      {
+        JSString *p1;
+        if (prop == JS_ATOM_length)
+          return JS_NewInt32(ctx, JS_VALUE_GET_STRING_ROPE(obj)->len);
+        if (!__JS_AtomIsTaggedInt(prop))
+          break;
+        p1 = js_rope_get_string(ctx, obj);
+        if (!p1)
+          return JS_EXCEPTION;
+        return JS_GetPropertyInternal(ctx, JS_MKPTR(JS_TAG_STRING, p1), prop, this_obj, icu, throw_ref_error);
+      }
       default:
         break;
     }
@@ -556,7 +568,7 @@ force_inline JSValue JS_GetPropertyInternalWithIC(JSContext *ctx, JSValueConst o
   if (unlikely(tag != JS_TAG_OBJECT))
     goto slow_path;
   p = JS_VALUE_GET_OBJ(obj);
-  offset = get_ic_prop_offset(icu, p->shape, &proto);
+  offset = get_ic_prop_offset(icu, p->shape, FALSE, &proto);
   if (likely(offset != INLINE_CACHE_MISS)) {
     if (proto)
       p = proto;
@@ -2000,7 +2012,7 @@ force_inline int JS_SetPropertyInternalWithIC(JSContext* ctx, JSValueConst this_
   if (unlikely(tag != JS_TAG_OBJECT))
     goto slow_path;
   p = JS_VALUE_GET_OBJ(this_obj);
-  offset = get_ic_prop_offset(icu, p->shape, &proto);
+  offset = get_ic_prop_offset(icu, p->shape, TRUE, &proto);
   if (likely(offset != INLINE_CACHE_MISS)) {
     if (proto)
       goto slow_path;
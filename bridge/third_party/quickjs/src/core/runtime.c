@@ -33,6 +33,7 @@
 #include "exception.h"
 #include "function.h"
 #include "malloc.h"
+#include "slab.h"
 #include "string.h"
 
 #if CONFIG_BIGNUM
@@ -51,6 +52,7 @@
 #include "builtins/js-symbol.h"
 #include "convertion.h"
 #include "gc.h"
+#include "ic.h"
 #include "module.h"
 #include "object.h"
 #include "parser.h"
@@ -393,6 +395,7 @@ JSValueConst JS_GetPrototypePrimitive(JSContext* ctx, JSValueConst val) {
       val = ctx->class_proto[JS_CLASS_BOOLEAN];
       break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
       val = ctx->class_proto[JS_CLASS_STRING];
       break;
     case JS_TAG_SYMBOL:
@@ -1127,7 +1130,7 @@ const char* get_func_name(JSContext* ctx, JSValueConst func) {
   if ((prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL)
     return NULL;
   val = pr->u.value;
-  if (JS_VALUE_GET_TAG(val) != JS_TAG_STRING)
+  if (!JS_IsString(val))
     return NULL;
   return JS_ToCString(ctx, val);
 }
@@ -2601,6 +2604,7 @@ void JS_FreeRuntime(JSRuntime* rt) {
   }
   init_list_head(&rt->job_list);
 
+  free_ic_megamorphic_cache(rt);
   JS_RunGC(rt);
 
 #ifdef DUMP_LEAKS
@@ -2643,6 +2647,7 @@ void JS_FreeRuntime(JSRuntime* rt) {
   }
 #endif
   assert(list_empty(&rt->gc_obj_list));
+  assert(list_empty(&rt->gc_young_obj_list));
 
   /* free the classes */
   for (i = 0; i < rt->class_count; i++) {
@@ -2758,6 +2763,12 @@ void JS_FreeRuntime(JSRuntime* rt) {
     if (rt->rt_info)
       printf("\n");
   }
+#endif
+#ifdef CONFIG_SLAB_ALLOC
+  /* the blocks still allocated from the slab pages are leaks */
+  js_slab_free_all(rt);
+#endif
+#ifdef DUMP_LEAKS
   {
     JSMallocState* s = &rt->malloc_state;
     if (s->malloc_count > 1) {
@@ -2853,6 +2864,8 @@ void JS_FreeContext(JSContext* ctx) {
   if (--ctx->header.ref_count > 0)
     return;
   assert(ctx->header.ref_count == 0);
+  /* the cache may hold the prototypes of the context */
+  free_ic_megamorphic_cache(rt);
 
 #ifdef DUMP_ATOMS
   JS_DumpAtoms(ctx->rt);
@@ -2866,6 +2879,7 @@ void JS_FreeContext(JSContext* ctx) {
     JSGCObjectHeader* p;
     printf("JSObjects: {\n");
     JS_DumpObjectHeader(ctx->rt);
+    js_gc_promote_young(rt);
     list_for_each(el, &rt->gc_obj_list) {
       p = list_entry(el, JSGCObjectHeader, link);
       JS_DumpGCObject(rt, p);
@@ -3014,6 +3028,9 @@ JSRuntime* JS_NewRuntime2(const JSMallocFunctions* mf, void* opaque) {
   }
   rt->malloc_state = ms;
   rt->malloc_gc_threshold = 2 * 1024 * 1024; // 2 MB as a start
+#ifdef CONFIG_SLAB_ALLOC
+  js_slab_init(rt);
+#endif
   rt->gc_off = FALSE;
 
 #ifdef CONFIG_BIGNUM
@@ -3025,6 +3042,7 @@ JSRuntime* JS_NewRuntime2(const JSMallocFunctions* mf, void* opaque) {
 
   init_list_head(&rt->context_list);
   init_list_head(&rt->gc_obj_list);
+  init_list_head(&rt->gc_young_obj_list);
   init_list_head(&rt->gc_zero_ref_count_list);
   rt->gc_phase = JS_GC_PHASE_NONE;
 
@@ -3091,7 +3109,21 @@ static const JSMallocFunctions def_malloc_funcs = {
 };
 
 JSRuntime* JS_NewRuntime(void) {
-  return JS_NewRuntime2(&def_malloc_funcs, NULL);
+  JSRuntime* rt = JS_NewRuntime2(&def_malloc_funcs, NULL);
+  /* the slab pages are not taken from custom allocators */
+  if (rt)
+    JS_EnableSlabAllocator(rt, TRUE);
+  return rt;
+}
+
+JS_BOOL JS_EnableSlabAllocator(JSRuntime* rt, JS_BOOL enable) {
+#ifdef CONFIG_SLAB_ALLOC
+  /* the blocks allocated before remain valid */
+  rt->slab.enabled = enable;
+  return TRUE;
+#else
+  return FALSE;
+#endif
 }
 
 /* the indirection is needed to make 'eval' optional */
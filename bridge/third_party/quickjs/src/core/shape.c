@@ -215,6 +215,7 @@ no_inline int resize_properties(JSContext* ctx, JSShape** psh, JSObject* p, uint
   JSShapeProperty* pr;
   void* sh_alloc;
   intptr_t h;
+  struct list_head* link_prev;
 
   sh = *psh;
   new_size = max_int(count, sh->prop_size * 3 / 2);
@@ -238,10 +239,12 @@ no_inline int resize_properties(JSContext* ctx, JSShape** psh, JSObject* p, uint
     if (!sh_alloc)
       return -1;
     sh = get_shape_from_alloc(sh_alloc, new_hash_size);
+    /* keep the GC list and the position of the shape */
+    link_prev = old_sh->header.link.prev;
     list_del(&old_sh->header.link);
     /* copy all the fields and the properties */
     memcpy(sh, old_sh, sizeof(JSShape) + sizeof(sh->prop[0]) * old_sh->prop_count);
-    list_add_tail(&sh->header.link, &ctx->rt->gc_obj_list);
+    list_add(&sh->header.link, link_prev);
     new_hash_mask = new_hash_size - 1;
     sh->prop_hash_mask = new_hash_mask;
     memset(prop_hash_end(sh) - new_hash_size, 0, sizeof(prop_hash_end(sh)[0]) * new_hash_size);
@@ -255,15 +258,16 @@ no_inline int resize_properties(JSContext* ctx, JSShape** psh, JSObject* p, uint
     js_free(ctx, get_alloc_from_shape(old_sh));
   } else {
     /* only resize the properties */
+    link_prev = sh->header.link.prev;
     list_del(&sh->header.link);
     sh_alloc = js_realloc(ctx, get_alloc_from_shape(sh), get_shape_size(new_hash_size, new_size));
     if (unlikely(!sh_alloc)) {
       /* insert again in the GC list */
-      list_add_tail(&sh->header.link, &ctx->rt->gc_obj_list);
+      list_add(&sh->header.link, link_prev);
       return -1;
     }
     sh = get_shape_from_alloc(sh_alloc, new_hash_size);
-    list_add_tail(&sh->header.link, &ctx->rt->gc_obj_list);
+    list_add(&sh->header.link, link_prev);
   }
   *psh = sh;
   sh->prop_size = new_size;
@@ -278,6 +282,7 @@ int compact_properties(JSContext* ctx, JSObject* p) {
   uint32_t new_hash_size, i, j, new_hash_mask, new_size;
   JSShapeProperty *old_pr, *pr;
   JSProperty *prop, *new_prop;
+  struct list_head* link_prev;
 
   sh = p->shape;
   assert(!sh->is_hashed);
@@ -296,9 +301,10 @@ int compact_properties(JSContext* ctx, JSObject* p) {
   if (!sh_alloc)
     return -1;
   sh = get_shape_from_alloc(sh_alloc, new_hash_size);
+  link_prev = old_sh->header.link.prev;
   list_del(&old_sh->header.link);
   memcpy(sh, old_sh, sizeof(JSShape));
-  list_add_tail(&sh->header.link, &ctx->rt->gc_obj_list);
+  list_add(&sh->header.link, link_prev);
 
   memset(prop_hash_end(sh) - new_hash_size, 0, sizeof(prop_hash_end(sh)[0]) * new_hash_size);
 
@@ -449,6 +455,7 @@ __maybe_unused void JS_DumpShapes(JSRuntime* rt) {
     }
   }
   /* dump non-hashed shapes */
+  js_gc_promote_young(rt);
   list_for_each(el, &rt->gc_obj_list) {
     gp = list_entry(el, JSGCObjectHeader, link);
     if (gp->gc_obj_type == JS_GC_OBJ_TYPE_JS_OBJECT) {
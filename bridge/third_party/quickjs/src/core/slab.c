@@ -0,0 +1,239 @@
+/*
+ * QuickJS Javascript Engine
+ *
+ * Copyright (c) 2017-2021 Fabrice Bellard
+ * Copyright (c) 2017-2021 Charlie Gordon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "slab.h"
+#include <stdlib.h>
+#include <string.h>
+#include "malloc.h"
+
+#ifdef CONFIG_SLAB_ALLOC
+
+/* the blocks follow the page header */
+#define JS_SLAB_HEADER_SIZE ((sizeof(JSSlabPage) + 15) & ~15)
+
+static void* js_slab_page_alloc(void) {
+#if ENABLE_MI_MALLOC
+  return mi_malloc_aligned(JS_SLAB_PAGE_SIZE, JS_SLAB_PAGE_SIZE);
+#elif defined(_WIN32)
+  return _aligned_malloc(JS_SLAB_PAGE_SIZE, JS_SLAB_PAGE_SIZE);
+#else
+  void* ptr;
+  if (posix_memalign(&ptr, JS_SLAB_PAGE_SIZE, JS_SLAB_PAGE_SIZE) != 0)
+    return NULL;
+  return ptr;
+#endif
+}
+
+static void js_slab_page_free(void* ptr) {
+#if ENABLE_MI_MALLOC
+  mi_free(ptr);
+#elif defined(_WIN32)
+  _aligned_free(ptr);
+#else
+  free(ptr);
+#endif
+}
+
+/* like the pages, the page hash table is not counted in the malloc
+   state, which only counts the blocks */
+static void* js_slab_sys_malloc(size_t size) {
+#if ENABLE_MI_MALLOC
+  return mi_malloc(size);
+#else
+  return malloc(size);
+#endif
+}
+
+static void js_slab_sys_free(void* ptr) {
+#if ENABLE_MI_MALLOC
+  mi_free(ptr);
+#else
+  free(ptr);
+#endif
+}
+
+void js_slab_init(JSRuntime* rt) {
+  memset(&rt->slab, 0, sizeof(rt->slab));
+}
+
+void js_slab_free_all(JSRuntime* rt) {
+  JSSlabAllocator* sa = &rt->slab;
+  int i;
+
+  if (!sa->page_hash)
+    return;
+  for (i = 0; i < (1 << sa->page_hash_bits); i++) {
+    if (sa->page_hash[i])
+      js_slab_page_free(sa->page_hash[i]);
+  }
+  js_slab_sys_free(sa->page_hash);
+  js_slab_init(rt);
+}
+
+static int js_slab_resize_hash(JSRuntime* rt, int hash_bits) {
+  JSSlabAllocator* sa = &rt->slab;
+  JSSlabPage **new_hash, *p;
+  uint32_t i, h, mask;
+
+  new_hash = js_slab_sys_malloc(sizeof(new_hash[0]) << hash_bits);
+  if (!new_hash)
+    return -1;
+  memset(new_hash, 0, sizeof(new_hash[0]) << hash_bits);
+  mask = (1 << hash_bits) - 1;
+  if (sa->page_hash) {
+    for (i = 0; i < (1 << sa->page_hash_bits); i++) {
+      p = sa->page_hash[i];
+      if (!p)
+        continue;
+      for (h = js_slab_page_hash((uintptr_t)p, hash_bits); new_hash[h]; h = (h + 1) & mask)
+        continue;
+      new_hash[h] = p;
+    }
+    js_slab_sys_free(sa->page_hash);
+  }
+  sa->page_hash = new_hash;
+  sa->page_hash_bits = hash_bits;
+  return 0;
+}
+
+static int js_slab_add_page(JSRuntime* rt, JSSlabPage* page) {
+  JSSlabAllocator* sa = &rt->slab;
+  uint32_t h, mask;
+
+  /* the load factor is kept under 1/2 */
+  if (!sa->page_hash || (sa->page_count + 1) * 2 > (1 << sa->page_hash_bits)) {
+    if (js_slab_resize_hash(rt, sa->page_hash ? sa->page_hash_bits + 1 : 6))
+      return -1;
+  }
+  mask = (1 << sa->page_hash_bits) - 1;
+  for (h = js_slab_page_hash((uintptr_t)page, sa->page_hash_bits); sa->page_hash[h]; h = (h + 1) & mask)
+    continue;
+  sa->page_hash[h] = page;
+  sa->page_count++;
+  return 0;
+}
+
+static void js_slab_remove_page(JSRuntime* rt, JSSlabPage* page) {
+  JSSlabAllocator* sa = &rt->slab;
+  uint32_t i, j, k, mask;
+
+  mask = (1 << sa->page_hash_bits) - 1;
+  for (i = js_slab_page_hash((uintptr_t)page, sa->page_hash_bits); sa->page_hash[i] != page; i = (i + 1) & mask)
+    continue;
+  /* move back the following pages of the probe sequence */
+  sa->page_hash[i] = NULL;
+  for (j = (i + 1) & mask; sa->page_hash[j]; j = (j + 1) & mask) {
+    k = js_slab_page_hash((uintptr_t)sa->page_hash[j], sa->page_hash_bits);
+    if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+      continue;
+    sa->page_hash[i] = sa->page_hash[j];
+    sa->page_hash[j] = NULL;
+    i = j;
+  }
+  sa->page_count--;
+}
+
+static void js_slab_link_page(JSSlabAllocator* sa, JSSlabPage* page) {
+  JSSlabPage** head = &sa->free_pages[page->class_index];
+
+  page->prev = NULL;
+  page->next = *head;
+  if (*head)
+    (*head)->prev = page;
+  *head = page;
+}
+
+static void js_slab_unlink_page(JSSlabAllocator* sa, JSSlabPage* page) {
+  if (page->prev)
+    page->prev->next = page->next;
+  else
+    sa->free_pages[page->class_index] = page->next;
+  if (page->next)
+    page->next->prev = page->prev;
+  page->prev = page->next = NULL;
+}
+
+static JSSlabPage* js_slab_new_page(JSRuntime* rt, int class_index) {
+  JSSlabPage* page;
+
+  page = js_slab_page_alloc();
+  if (!page)
+    return NULL;
+  if (js_slab_add_page(rt, page)) {
+    js_slab_page_free(page);
+    return NULL;
+  }
+  page->free_list = NULL;
+  page->block_size = (class_index + 1) * 16;
+  page->bump_offset = JS_SLAB_HEADER_SIZE;
+  page->used_count = 0;
+  page->capacity = (JS_SLAB_PAGE_SIZE - JS_SLAB_HEADER_SIZE) / page->block_size;
+  page->class_index = class_index;
+  js_slab_link_page(&rt->slab, page);
+  return page;
+}
+
+void* js_slab_alloc(JSRuntime* rt, size_t size) {
+  JSSlabAllocator* sa = &rt->slab;
+  int class_index = (size - 1) >> 4;
+  JSSlabPage* page;
+  void* ptr;
+
+  page = sa->free_pages[class_index];
+  if (unlikely(!page)) {
+    page = js_slab_new_page(rt, class_index);
+    if (!page)
+      return NULL;
+  }
+  if (page->free_list) {
+    ptr = page->free_list;
+    page->free_list = *(void**)ptr;
+  } else {
+    /* the blocks are only written once they are allocated */
+    ptr = (uint8_t*)page + page->bump_offset;
+    page->bump_offset += page->block_size;
+  }
+  if (++page->used_count == page->capacity)
+    js_slab_unlink_page(sa, page);
+  return ptr;
+}
+
+void js_slab_free(JSRuntime* rt, JSSlabPage* page, void* ptr) {
+  JSSlabAllocator* sa = &rt->slab;
+
+  *(void**)ptr = page->free_list;
+  page->free_list = ptr;
+  if (page->used_count-- == page->capacity) {
+    js_slab_link_page(sa, page);
+  } else if (page->used_count == 0 && (page->prev || page->next)) {
+    /* one empty page per class is kept, so that a block allocated and
+       freed repeatedly does not allocate a page each time */
+    js_slab_unlink_page(sa, page);
+    js_slab_remove_page(rt, page);
+    js_slab_page_free(page);
+  }
+}
+
+#endif
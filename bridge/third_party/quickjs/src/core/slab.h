@@ -0,0 +1,78 @@
+/*
+ * QuickJS Javascript Engine
+ *
+ * Copyright (c) 2017-2021 Fabrice Bellard
+ * Copyright (c) 2017-2021 Charlie Gordon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef QUICKJS_SLAB_H
+#define QUICKJS_SLAB_H
+
+#include "quickjs/quickjs.h"
+#include "types.h"
+
+#ifdef CONFIG_SLAB_ALLOC
+
+struct JSSlabPage {
+  JSSlabPage *prev, *next; /* in the free_pages list of its class */
+  void* free_list;         /* blocks freed in this page */
+  uint32_t bump_offset;    /* blocks from this offset were never used */
+  uint32_t block_size;
+  uint16_t used_count;
+  uint16_t capacity;
+  uint8_t class_index;
+};
+
+void js_slab_init(JSRuntime* rt);
+void js_slab_free_all(JSRuntime* rt);
+/* 'size' is between 1 and JS_SLAB_MAX_SIZE */
+void* js_slab_alloc(JSRuntime* rt, size_t size);
+void js_slab_free(JSRuntime* rt, JSSlabPage* page, void* ptr);
+
+static inline size_t js_slab_block_size(size_t size) {
+  return (size + 15) & ~(size_t)15;
+}
+
+static inline uint32_t js_slab_page_hash(uintptr_t page, int hash_bits) {
+  return (uint32_t)(((uint64_t)(page / JS_SLAB_PAGE_SIZE) * 0x9e3779b97f4a7c15ULL) >> (64 - hash_bits));
+}
+
+/* return the page containing 'ptr', or NULL if it was not allocated by
+   js_slab_alloc() */
+static inline JSSlabPage* js_slab_find_page(JSRuntime* rt, const void* ptr) {
+  JSSlabAllocator* sa = &rt->slab;
+  uintptr_t page = (uintptr_t)ptr & ~(uintptr_t)(JS_SLAB_PAGE_SIZE - 1);
+  uint32_t mask, h;
+  JSSlabPage* p;
+
+  if (sa->page_count == 0)
+    return NULL;
+  mask = (1 << sa->page_hash_bits) - 1;
+  for (h = js_slab_page_hash(page, sa->page_hash_bits);; h = (h + 1) & mask) {
+    p = sa->page_hash[h];
+    if (!p || (uintptr_t)p == page)
+      return p;
+  }
+}
+
+#endif
+
+#endif
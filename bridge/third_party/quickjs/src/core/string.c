@@ -724,6 +724,10 @@ JSValue JS_AtomToString(JSContext* ctx, JSAtom atom) {
   return __JS_AtomToValue(ctx, atom, TRUE);
 }
 
+JSString* JS_GetAtomString(JSRuntime* rt, JSAtom atom) {
+  return rt->atom_array[atom];
+}
+
 /* val must be a symbol */
 JSAtom js_symbol_to_atom(JSContext *ctx, JSValue val)
 {
@@ -1335,6 +1339,14 @@ JSValue js_new_string16(JSContext* ctx, const uint16_t* buf, int len) {
   return JS_MKPTR(JS_TAG_STRING, str);
 }
 
+JSValue JS_NewOneByteString(JSContext* ctx, const uint8_t* buf, uint32_t len) {
+  return js_new_string8(ctx, buf, len);
+}
+
+JSValue JS_NewTwoByteString(JSContext* ctx, const uint16_t* buf, uint32_t len) {
+  return js_new_string16(ctx, buf, len);
+}
+
 JSValue js_new_string_char(JSContext* ctx, uint16_t c) {
   if (c < 0x100) {
     uint8_t ch8 = c;
@@ -1583,33 +1595,278 @@ void JS_FreeCString(JSContext* ctx, const char* ptr) {
   JS_FreeValue(ctx, JS_MKPTR(JS_TAG_STRING, p));
 }
 
+static void js_rope_buffer_free(JSRuntime* rt, JSRopeBuffer* b) {
+  if (--b->ref_count == 0)
+    js_free_rt(rt, b);
+}
+
+static JSRopeBuffer* js_rope_buffer_new(JSContext* ctx, uint32_t size, int is_wide_char) {
+  JSRopeBuffer* b;
+
+  b = js_malloc(ctx, sizeof(JSRopeBuffer) + (size << is_wide_char));
+  if (!b)
+    return NULL;
+  b->ref_count = 1;
+  b->len = 0;
+  b->size = size;
+  b->is_wide_char = is_wide_char;
+  return b;
+}
+
+/* append the characters [from, to) of 'p' */
+static void js_rope_buffer_write(JSRopeBuffer* b, const JSString* p, uint32_t from, uint32_t to) {
+  uint32_t len = to - from;
+
+  if (b->is_wide_char) {
+    copy_str16(b->u.str16 + b->len, p, from, len);
+  } else {
+    memcpy(b->u.str8 + b->len, p->u.str8 + from, len);
+  }
+  b->len += len;
+}
+
+static void js_rope_buffer_write_rope(JSRopeBuffer* b, const JSStringRope* r) {
+  const JSRopeBuffer* b1 = r->buffer;
+  uint32_t i;
+
+  if (!b1) {
+    js_rope_buffer_write(b, r->str, 0, r->len);
+  } else if (b->is_wide_char == b1->is_wide_char) {
+    memcpy(b->u.str8 + (b->len << b->is_wide_char), b1->u.str8, r->len << b1->is_wide_char);
+    b->len += r->len;
+  } else {
+    /* only an 8 bit buffer is copied to a 16 bit one */
+    for (i = 0; i < r->len; i++)
+      b->u.str16[b->len + i] = b1->u.str8[i];
+    b->len += r->len;
+  }
+}
+
+void js_free_rope_rt(JSRuntime* rt, JSStringRope* r) {
+  if (r->buffer)
+    js_rope_buffer_free(rt, r->buffer);
+  if (r->str)
+    JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_STRING, r->str));
+  js_free_rt(rt, r);
+}
+
+JSString* js_rope_get_string(JSContext* ctx, JSValueConst val) {
+  JSStringRope* r = JS_VALUE_GET_STRING_ROPE(val);
+  JSRopeBuffer* b = r->buffer;
+  JSString* p;
+
+  if (r->str)
+    return r->str;
+  p = js_alloc_string(ctx, r->len, b->is_wide_char);
+  if (!p)
+    return NULL;
+  if (b->is_wide_char) {
+    memcpy(p->u.str16, b->u.str16, r->len << 1);
+  } else {
+    memcpy(p->u.str8, b->u.str8, r->len);
+    p->u.str8[r->len] = '\0';
+  }
+  /* the flat copy replaces the buffer, so that a long string is not
+     kept twice. Appending to the rope again copies it to a new buffer */
+  r->str = p;
+  r->buffer = NULL;
+  js_rope_buffer_free(ctx->rt, b);
+  return p;
+}
+
+JSValue js_flatten_string_free(JSContext* ctx, JSValue val) {
+  JSString* p;
+
+  if (JS_VALUE_GET_TAG(val) != JS_TAG_STRING_ROPE)
+    return val;
+  p = js_rope_get_string(ctx, val);
+  if (p)
+    JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, p));
+  JS_FreeValue(ctx, val);
+  return p ? JS_MKPTR(JS_TAG_STRING, p) : JS_EXCEPTION;
+}
+
+static const uint8_t* js_string_value_chars(JSValueConst v, int* is_wide_char) {
+  const JSString* p;
+
+  if (JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE) {
+    const JSStringRope* r = JS_VALUE_GET_STRING_ROPE(v);
+    if (r->buffer) {
+      *is_wide_char = r->buffer->is_wide_char;
+      return r->buffer->u.str8;
+    }
+    p = r->str;
+  } else {
+    p = JS_VALUE_GET_STRING(v);
+  }
+  *is_wide_char = p->is_wide_char;
+  return p->u.str8;
+}
+
+BOOL js_string_value_equal(JSValueConst op1, JSValueConst op2) {
+  const uint8_t *s1, *s2;
+  int is_wide_char1, is_wide_char2;
+  uint32_t len;
+
+  len = js_string_value_len(op1);
+  if (len != js_string_value_len(op2))
+    return FALSE;
+  s1 = js_string_value_chars(op1, &is_wide_char1);
+  s2 = js_string_value_chars(op2, &is_wide_char2);
+  if (is_wide_char1 == is_wide_char2)
+    return memcmp(s1, s2, len << is_wide_char1) == 0;
+  if (is_wide_char1)
+    return memcmp16_8((const uint16_t*)s1, s2, len) == 0;
+  return memcmp16_8((const uint16_t*)s2, s1, len) == 0;
+}
+
+uint32_t js_string_value_hash(JSValueConst v, uint32_t h) {
+  const uint8_t* s;
+  int is_wide_char;
+
+  s = js_string_value_chars(v, &is_wide_char);
+  if (is_wide_char)
+    return hash_string16((const uint16_t*)s, js_string_value_len(v), h);
+  return hash_string8(s, js_string_value_len(v), h);
+}
+
+/* 'b' is freed */
+static JSValue js_new_rope(JSContext* ctx, JSRopeBuffer* b, uint32_t len) {
+  JSStringRope* r;
+
+  r = js_malloc(ctx, sizeof(JSStringRope));
+  if (!r) {
+    js_rope_buffer_free(ctx->rt, b);
+    return JS_EXCEPTION;
+  }
+  r->header.ref_count = 1;
+  r->len = len;
+  r->buffer = b;
+  r->str = NULL;
+  return JS_MKPTR(JS_TAG_STRING_ROPE, r);
+}
+
+/* op1 and op2 are non empty strings or ropes, the result is a
+   rope. op1 and op2 are freed. */
+static JSValue js_concat_rope(JSContext* ctx, JSValue op1, JSValue op2) {
+  JSStringRope* r1 = NULL;
+  JSRopeBuffer* b;
+  JSString* p2;
+  uint32_t len1, len2, len, size;
+  int is_wide_char;
+
+  len1 = js_string_value_len(op1);
+  len2 = js_string_value_len(op2);
+  len = len1 + len2;
+  if (len > JS_STRING_LEN_MAX) {
+    JS_ThrowInternalError(ctx, "string too long");
+    goto fail;
+  }
+  /* XXX: prepending copies the rope at the right */
+  op2 = js_flatten_string_free(ctx, op2);
+  if (JS_IsException(op2))
+    goto fail;
+  p2 = JS_VALUE_GET_STRING(op2);
+
+  if (JS_VALUE_GET_TAG(op1) == JS_TAG_STRING_ROPE) {
+    r1 = JS_VALUE_GET_STRING_ROPE(op1);
+    b = r1->buffer;
+    if (b && b->len == len1 && (b->is_wide_char || !p2->is_wide_char)) {
+      /* op1 ends the buffer: append in place, the shorter ropes
+         sharing it do not see the new characters */
+      if (len > b->size) {
+        if (b->ref_count != 1)
+          goto copy;
+        size = min_uint32(max_uint32(len, b->size + b->size / 2), JS_STRING_LEN_MAX);
+        b = js_realloc(ctx, b, sizeof(JSRopeBuffer) + (size << b->is_wide_char));
+        if (!b)
+          goto fail;
+        b->size = size;
+        r1->buffer = b;
+      }
+      js_rope_buffer_write(b, p2, 0, len2);
+      JS_FreeValue(ctx, op2);
+      if (r1->header.ref_count == 1) {
+        r1->len = len;
+        return op1;
+      }
+      b->ref_count++;
+      JS_FreeValue(ctx, op1);
+      return js_new_rope(ctx, b, len);
+    }
+  }
+
+copy:
+  is_wide_char = p2->is_wide_char;
+  if (!r1)
+    is_wide_char |= JS_VALUE_GET_STRING(op1)->is_wide_char;
+  else if (r1->buffer)
+    is_wide_char |= r1->buffer->is_wide_char;
+  else
+    is_wide_char |= r1->str->is_wide_char;
+  /* room to append as much again */
+  size = min_uint32(max_uint32(len * 2, JS_ROPE_MIN_LEN), JS_STRING_LEN_MAX);
+  b = js_rope_buffer_new(ctx, size, is_wide_char);
+  if (!b)
+    goto fail;
+  if (r1)
+    js_rope_buffer_write_rope(b, r1);
+  else
+    js_rope_buffer_write(b, JS_VALUE_GET_STRING(op1), 0, len1);
+  js_rope_buffer_write(b, p2, 0, len2);
+  JS_FreeValue(ctx, op1);
+  JS_FreeValue(ctx, op2);
+  return js_new_rope(ctx, b, len);
+
+fail:
+  JS_FreeValue(ctx, op1);
+  JS_FreeValue(ctx, op2);
+  return JS_EXCEPTION;
+}
+
 /* op1 and op2 are converted to strings. For convience, op1 or op2 =
    JS_EXCEPTION are accepted and return JS_EXCEPTION.  */
 JSValue JS_ConcatString(JSContext* ctx, JSValue op1, JSValue op2) {
   JSValue ret;
   JSString *p1, *p2;
 
-  if (unlikely(JS_VALUE_GET_TAG(op1) != JS_TAG_STRING)) {
+  if (unlikely(!JS_IsString(op1))) {
     op1 = JS_ToStringFree(ctx, op1);
     if (JS_IsException(op1)) {
       JS_FreeValue(ctx, op2);
       return JS_EXCEPTION;
     }
   }
-  if (unlikely(JS_VALUE_GET_TAG(op2) != JS_TAG_STRING)) {
+  if (unlikely(!JS_IsString(op2))) {
     op2 = JS_ToStringFree(ctx, op2);
     if (JS_IsException(op2)) {
       JS_FreeValue(ctx, op1);
       return JS_EXCEPTION;
     }
   }
+
+  if (js_string_value_len(op2) == 0) {
+    JS_FreeValue(ctx, op2);
+    return op1;
+  }
+  if (js_string_value_len(op1) == 0) {
+    JS_FreeValue(ctx, op1);
+    return op2;
+  }
+  /* long results are built as ropes, so that appending to them again
+     does not copy them */
+  if (JS_VALUE_GET_TAG(op1) == JS_TAG_STRING_ROPE ||
+      js_string_value_len(op1) + js_string_value_len(op2) >= JS_ROPE_MIN_LEN) {
+    return js_concat_rope(ctx, op1, op2);
+  }
+  op2 = js_flatten_string_free(ctx, op2);
+  if (JS_IsException(op2)) {
+    JS_FreeValue(ctx, op1);
+    return JS_EXCEPTION;
+  }
   p1 = JS_VALUE_GET_STRING(op1);
   p2 = JS_VALUE_GET_STRING(op2);
 
-  /* XXX: could also check if p1 is empty */
-  if (p2->len == 0) {
-    goto ret_op1;
-  }
   if (p1->header.ref_count == 1 && p1->is_wide_char == p2->is_wide_char && js_malloc_usable_size(ctx, p1) >= sizeof(*p1) + ((p1->len + p2->len) << p2->is_wide_char) + 1 - p1->is_wide_char) {
     /* Concatenate in place in available space at the end of p1 */
     if (p1->is_wide_char) {
@@ -1620,7 +1877,6 @@ JSValue JS_ConcatString(JSContext* ctx, JSValue op1, JSValue op2) {
       p1->len += p2->len;
       p1->u.str8[p1->len] = '\0';
     }
-  ret_op1:
     JS_FreeValue(ctx, op2);
     return op1;
   }
@@ -1628,4 +1884,4 @@ JSValue JS_ConcatString(JSContext* ctx, JSValue op1, JSValue op2) {
   JS_FreeValue(ctx, op1);
   JS_FreeValue(ctx, op2);
   return ret;
-}
\ No newline at end of file
+}
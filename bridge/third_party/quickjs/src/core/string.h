@@ -233,6 +233,34 @@ JSValue JS_ConcatString3(JSContext* ctx, const char* str1, JSValue str2, const c
    JS_EXCEPTION are accepted and return JS_EXCEPTION.  */
 JSValue JS_ConcatString(JSContext* ctx, JSValue op1, JSValue op2);
 
+/* concatenations at least this long are built as ropes */
+#define JS_ROPE_MIN_LEN 256
+
+#define JS_VALUE_GET_STRING_ROPE(v) ((JSStringRope*)JS_VALUE_GET_PTR(v))
+
+/* 'v' is a string or a rope */
+static inline uint32_t js_string_value_len(JSValueConst v) {
+  if (JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE)
+    return JS_VALUE_GET_STRING_ROPE(v)->len;
+  return JS_VALUE_GET_STRING(v)->len;
+}
+/* return the characters of the rope 'val', flattened on the first
+   call. Return NULL if error. */
+JSString* js_rope_get_string(JSContext* ctx, JSValueConst val);
+/* return 'val' as a JSString if it is a rope. 'val' is freed. */
+JSValue js_flatten_string_free(JSContext* ctx, JSValue val);
+void js_free_rope_rt(JSRuntime* rt, JSStringRope* r);
+/* 'op1' and 'op2' are strings or ropes, compared without flattening them */
+BOOL js_string_value_equal(JSValueConst op1, JSValueConst op2);
+/* same as hash_string() for a string or a rope */
+uint32_t js_string_value_hash(JSValueConst v, uint32_t h);
+/* 'v' is a string or a rope. Return NULL if error. */
+static inline JSString* js_get_string(JSContext* ctx, JSValueConst v) {
+  if (JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE)
+    return js_rope_get_string(ctx, v);
+  return JS_VALUE_GET_STRING(v);
+}
+
 /* return a string atom containing name concatenated with str1 */
 JSAtom js_atom_concat_str(JSContext* ctx, JSAtom name, const char* str1);
 JSAtom js_atom_concat_num(JSContext* ctx, JSAtom name, uint32_t n);
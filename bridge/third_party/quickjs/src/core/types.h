@@ -134,12 +134,6 @@ typedef struct JSShape JSShape;
 typedef struct JSString JSString;
 typedef struct JSString JSAtomStruct;
 
-typedef enum {
-    JS_GC_PHASE_NONE,
-    JS_GC_PHASE_DECREF,
-    JS_GC_PHASE_REMOVE_CYCLES,
-} JSGCPhaseEnum;
-
 typedef enum OPCodeEnum OPCodeEnum;
 
 #ifdef CONFIG_BIGNUM
@@ -162,6 +156,26 @@ typedef struct {
 } JSNumericOperations;
 #endif
 
+#ifdef CONFIG_SLAB_ALLOC
+#define JS_SLAB_PAGE_SIZE (64 * 1024)
+#define JS_SLAB_MAX_SIZE 256
+#define JS_SLAB_CLASS_COUNT (JS_SLAB_MAX_SIZE / 16)
+
+typedef struct JSSlabPage JSSlabPage;
+
+/* the small blocks are allocated from pages of blocks of the same size
+   class, owned by the runtime and so by a single thread */
+typedef struct JSSlabAllocator {
+    BOOL enabled; /* new blocks are allocated from the pages */
+    JSSlabPage *free_pages[JS_SLAB_CLASS_COUNT]; /* pages with free blocks */
+    /* open addressing hash table of the pages, to find the page of a
+       block */
+    JSSlabPage **page_hash;
+    int page_hash_bits;
+    int page_count;
+} JSSlabAllocator;
+#endif
+
 typedef enum {
     JS_RUNTIME_STATE_INIT,
     JS_RUNTIME_STATE_RUNNING,
@@ -188,6 +202,9 @@ struct JSRuntime {
     /* list of JSGCObjectHeader.link. List of allocated GC objects (used
        by the garbage collector) */
     struct list_head gc_obj_list;
+    /* GC objects created since the last collection, they are moved to
+       gc_obj_list once they survived one */
+    struct list_head gc_young_obj_list;
     /* list of JSGCObjectHeader.link. Used during JS_FreeValueRT() */
     struct list_head gc_zero_ref_count_list;
     struct list_head tmp_obj_list; /* used during GC */
@@ -229,6 +246,9 @@ struct JSRuntime {
     int shape_hash_size;
     int shape_hash_count; /* number of hashed shapes */
     JSShape **shape_hash;
+    /* inline cache of the megamorphic property accesses, allocated on
+       first use and cleared by JS_RunGC() */
+    struct InlineCacheMegamorphicItem *ic_megamorphic_cache;
 #ifdef CONFIG_BIGNUM
     bf_context_t bf_ctx;
     JSNumericOperations bigint_ops;
@@ -238,6 +258,22 @@ struct JSRuntime {
 #endif
     void *user_opaque;
     JSRuntimeState state;
+
+    /* incremental cycle collection, see JS_RunGCSlice() */
+    BOOL gc_incremental : 8;
+    BOOL gc_pass_active : 8; /* a pass over all the GC objects is in progress */
+    uint8_t gc_pass_epoch; /* 1 to 7, objects visited by the current pass
+                              have it in the upper bits of their mark */
+    int gc_slice_budget; /* objects which can still join the current slice */
+    int gc_incremental_budget; /* slice size used by js_trigger_gc() */
+    size_t gc_full_threshold; /* malloc_size which forces a full GC */
+    size_t gc_pass_threshold; /* malloc_size which starts a new pass */
+    struct list_head gc_slice_obj_list; /* used during a GC slice */
+    JSGCStats gc_stats;
+#ifdef CONFIG_SLAB_ALLOC
+    /* last, so that CONFIG_SLAB_ALLOC does not move the other fields */
+    JSSlabAllocator slab;
+#endif
 };
 
 struct JSClass {
@@ -284,7 +320,8 @@ typedef enum {
 struct JSGCObjectHeader {
     int ref_count; /* must come first, 32-bit */
     JSGCObjectTypeEnum gc_obj_type : 4;
-    uint8_t mark : 4; /* used by the GC */
+    uint8_t mark : 4; /* used by the GC, bit 0 during a collection and
+                         the pass epoch of GC slices in bits 1 to 3 */
     uint8_t dummy1; /* not used by the GC */
     uint16_t dummy2; /* not used by the GC */
     struct list_head link;
@@ -442,6 +479,31 @@ struct JSString {
     } u;
 };
 
+/* Characters shared by the ropes concatenated from each other. */
+typedef struct JSRopeBuffer {
+    int ref_count;
+    uint32_t len; /* number of characters written */
+    uint32_t size; /* capacity in characters */
+    uint8_t is_wide_char;
+    union {
+        uint8_t str8[0];
+        uint16_t str16[0];
+    } u;
+} JSRopeBuffer;
+
+/* JS_TAG_STRING_ROPE: the string of the first 'len' characters of
+   'buffer'. Appending to the rope which ends the buffer writes in
+   place, so 's += x' in a loop does not copy 's' again. The
+   characters are copied to a JSString the first time they are read
+   (indexing, conversion to an atom or a C string...), 'str' keeps it
+   for the next reads and the rope drops its reference to 'buffer'. */
+typedef struct JSStringRope {
+    JSRefCountHeader header; /* must come first, 32-bit */
+    uint32_t len;
+    JSRopeBuffer *buffer; /* NULL once flattened */
+    JSString *str; /* NULL until flattened */
+} JSStringRope;
+
 typedef struct JSClosureVar {
     uint8_t is_local : 1;
     uint8_t is_arg : 1;
@@ -517,6 +579,9 @@ typedef struct JSVarDef {
 #define PC2COLUMN_OP_FIRST 1
 #define PC2COLUMN_DIFF_PC_MAX ((255 - PC2COLUMN_OP_FIRST) / PC2COLUMN_RANGE)
 #define IC_CACHE_ITEM_CAPACITY 4
+/* the sites which overflow their ring use a cache shared by the runtime */
+#define IC_MEGAMORPHIC_CACHE_BITS 10
+#define IC_MEGAMORPHIC_PROTO_DEPTH 8
 
 typedef enum JSFunctionKindEnum {
     JS_FUNC_NORMAL = 0,
@@ -547,8 +612,24 @@ typedef struct InlineCacheRingSlot {
     JSAtom atom;
     InlineCacheRingItem buffer[IC_CACHE_ITEM_CAPACITY];
     uint8_t index;
+    uint8_t megamorphic : 1; /* the ring overflowed */
+    uint32_t hit_count;
+    uint32_t miss_count;
 } InlineCacheRingSlot;
 
+/* 'atom' is found at 'prop_offset' in 'shape', or in the prototype
+   reached through the 'depth' prototypes whose shapes are
+   'proto_shapes'. The get sites fill the cache with any data property,
+   the set sites only use the items which are 'writable' */
+typedef struct InlineCacheMegamorphicItem {
+    JSShape *shape;
+    JSAtom atom;
+    uint32_t prop_offset;
+    uint32_t depth : 31;
+    uint32_t writable : 1; /* own writable data property */
+    JSShape *proto_shapes[IC_MEGAMORPHIC_PROTO_DEPTH];
+} InlineCacheMegamorphicItem;
+
 typedef struct InlineCacheHashSlot {
     JSAtom atom;
     uint32_t index;
@@ -4,10 +4,13 @@
 
 #include "include/webf_bridge.h"
 #include <core/binding_object.h>
+#include <algorithm>
 
+#include "bindings/qjs/code_cache.h"
 #include "core/dart_isolate_context.h"
 #include "core/html/parser/html_parser.h"
 #include "core/page.h"
+#include "css_property_names.h"
 #include "foundation/native_type.h"
 #include "include/dart_api.h"
 #include "multiple_threading/dispatcher.h"
@@ -200,12 +203,86 @@ void parseHTML(void* page_,
       length, profile_id, persistent_handle, result_callback);
 }
 
+void parseHTMLBegin(void* page_) {
+#if ENABLE_LOG
+  WEBF_LOG(VERBOSE) << "[Dart] parseHTMLBeginWrapper call" << std::endl;
+#endif
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  page->executingContext()->dartIsolateContext()->dispatcher()->PostToJs(
+      page->isDedicated(), static_cast<int32_t>(page->contextId()), webf::WebFPage::ParseHTMLBeginInternal, page_);
+}
+
+void parseHTMLChunk(void* page_,
+                    char* code,
+                    int32_t length,
+                    int64_t profile_id,
+                    Dart_Handle dart_handle,
+                    ParseHTMLCallback result_callback) {
+#if ENABLE_LOG
+  WEBF_LOG(VERBOSE) << "[Dart] parseHTMLChunkWrapper call" << std::endl;
+#endif
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  Dart_PersistentHandle persistent_handle = Dart_NewPersistentHandle_DL(dart_handle);
+  page->executingContext()->dartIsolateContext()->dispatcher()->PostToJs(
+      page->isDedicated(), static_cast<int32_t>(page->contextId()), webf::WebFPage::ParseHTMLChunkInternal, page_, code,
+      length, profile_id, persistent_handle, result_callback);
+}
+
+void parseHTMLEnd(void* page_, int64_t profile_id, Dart_Handle dart_handle, ParseHTMLCallback result_callback) {
+#if ENABLE_LOG
+  WEBF_LOG(VERBOSE) << "[Dart] parseHTMLEndWrapper call" << std::endl;
+#endif
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  Dart_PersistentHandle persistent_handle = Dart_NewPersistentHandle_DL(dart_handle);
+  page->executingContext()->dartIsolateContext()->dispatcher()->PostToJs(
+      page->isDedicated(), static_cast<int32_t>(page->contextId()), webf::WebFPage::ParseHTMLEndInternal, page_,
+      profile_id, persistent_handle, result_callback);
+}
+
 void registerPluginByteCode(uint8_t* bytes, int32_t length, const char* pluginName) {
   webf::ExecutingContext::plugin_byte_code[pluginName] = webf::NativeByteCode{bytes, length};
 }
 
 void registerPluginCode(const char* code, int32_t length, const char* pluginName) {
-  webf::ExecutingContext::plugin_string_code[pluginName] = std::string(code, length);
+  webf::ExecutingContext::RegisterPluginCode(pluginName, std::string(code, length));
+}
+
+void setCodeCacheDirectory(const char* directory, int64_t max_bytes) {
+  webf::CodeCache::Shared()->Configure(directory != nullptr ? directory : "", max_bytes);
+}
+
+void getCodeCacheStats(int64_t* stats) {
+  webf::CodeCache::Stats code_cache_stats = webf::CodeCache::Shared()->stats();
+  stats[0] = code_cache_stats.hits;
+  stats[1] = code_cache_stats.misses;
+  stats[2] = code_cache_stats.rejected;
+  stats[3] = code_cache_stats.stores;
+  stats[4] = code_cache_stats.evictions;
+  stats[5] = code_cache_stats.total_bytes;
+}
+
+void getGCStats(void* page_, int64_t* stats) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  page->dartIsolateContext()->dispatcher()->PostToJsSync(
+      page->isDedicated(), static_cast<int32_t>(page->contextId()),
+      [](bool cancel, webf::WebFPage* page, int64_t* stats) {
+        JSGCStats gc_stats;
+        JS_GetGCStats(JS_GetRuntime(page->executingContext()->ctx()), &gc_stats);
+        stats[0] = gc_stats.full_count;
+        stats[1] = gc_stats.slice_count;
+        stats[2] = gc_stats.pass_count;
+        stats[3] = gc_stats.freed_count;
+        stats[4] = gc_stats.full_max_pause_us;
+        stats[5] = gc_stats.slice_max_pause_us;
+        stats[6] = gc_stats.total_pause_us;
+        std::copy_n(gc_stats.full_pause_histogram, JS_GC_PAUSE_BUCKET_COUNT, stats + 7);
+        std::copy_n(gc_stats.slice_pause_histogram, JS_GC_PAUSE_BUCKET_COUNT, stats + 7 + JS_GC_PAUSE_BUCKET_COUNT);
+        int64_t* young_stats = stats + 7 + JS_GC_PAUSE_BUCKET_COUNT * 2;
+        young_stats[0] = gc_stats.young_count;
+        young_stats[1] = gc_stats.young_max_pause_us;
+        std::copy_n(gc_stats.young_pause_histogram, JS_GC_PAUSE_BUCKET_COUNT, young_stats + 2);
+      },
+      page, stats);
 }
 
 static WebFInfo* webfInfo{nullptr};
@@ -295,6 +372,10 @@ void clearUICommandItems(void* page_) {
   page->executingContext()->uiCommandBuffer()->clear();
 }
 
+const char* const* getCSSPropertyNames() {
+  return webf::css_property_names::GetCamelCaseNames();
+}
+
 // Callbacks when dart context object was finalized by Dart GC.
 static void finalize_dart_context(void* peer) {
   WEBF_LOG(VERBOSE) << "[Dispatcher]: BEGIN FINALIZE DART CONTEXT: ";
@@ -323,9 +404,30 @@ int8_t isJSThreadBlocked(void* dart_isolate_context_, double context_id) {
   return dart_isolate_context->dispatcher()->IsThreadBlocked(thread_group_id) ? 1 : 0;
 }
 
+void pauseJSThreadTimers(void* dart_isolate_context_, double context_id) {
+  auto* dart_isolate_context = static_cast<webf::DartIsolateContext*>(dart_isolate_context_);
+  auto thread_group_id = static_cast<int32_t>(context_id);
+  if (!dart_isolate_context->dispatcher()->IsThreadGroupExist(thread_group_id))
+    return;
+  dart_isolate_context->dispatcher()->looper(thread_group_id)->PauseTimers();
+}
+
+void resumeJSThreadTimers(void* dart_isolate_context_, double context_id) {
+  auto* dart_isolate_context = static_cast<webf::DartIsolateContext*>(dart_isolate_context_);
+  auto thread_group_id = static_cast<int32_t>(context_id);
+  if (!dart_isolate_context->dispatcher()->IsThreadGroupExist(thread_group_id))
+    return;
+  dart_isolate_context->dispatcher()->looper(thread_group_id)->ResumeTimers();
+}
+
 // run in the dart isolate thread
 void executeNativeCallback(DartWork* work_ptr) {
   auto dart_work = *(work_ptr);
   dart_work(false);
   delete work_ptr;
 }
+
+// run in the dart isolate thread
+void executeNativeCallbacks(void* dispatcher) {
+  static_cast<webf::multi_threading::Dispatcher*>(dispatcher)->DrainDartWorks();
+}
@@ -102,12 +102,22 @@ class _DispatchEventResultContext {
 }
 
 Future<void> _dispatchEventToNative(Event event, bool isCapture) async {
-  Pointer<NativeBindingObject>? pointer = event.currentTarget?.pointer;
+  // The listeners of every target in the path already ran at the native side.
+  if (event.dispatchedAlongNativePath) return;
+
   double? contextId = event.target?.contextId;
   WebFController? controller = WebFController.getControllerOfJSContextId(contextId);
 
   if (controller == null || controller.view.disposed) return;
 
+  // Let the native side run the capturing and bubbling phases for the whole path in one call, unless the target has
+  // no native binding object.
+  Pointer<NativeBindingObject>? targetPointer = event.target?.pointer;
+  bool alongPath = targetPointer != null &&
+      targetPointer.ref.invokeBindingMethodFromDart != nullptr &&
+      !isBindingObjectDisposed(targetPointer);
+  Pointer<NativeBindingObject>? pointer = alongPath ? targetPointer : event.currentTarget?.pointer;
+
   if (contextId != null &&
       pointer != null &&
       pointer.ref.invokeBindingMethodFromDart != nullptr &&
@@ -126,7 +136,8 @@ Future<void> _dispatchEventToNative(Event event, bool isCapture) async {
     DartInvokeBindingMethodsFromDart f = pointer.ref.invokeBindingMethodFromDart.asFunction();
 
     Pointer<RawEvent> rawEvent = event.toRaw().cast<RawEvent>();
-    List<dynamic> dispatchEventArguments = [event.type, rawEvent, isCapture];
+    List<dynamic> dispatchEventArguments = alongPath ? [event.type, rawEvent] : [event.type, rawEvent, isCapture];
+    event.dispatchedAlongNativePath = alongPath;
 
     Stopwatch? stopwatch;
     if (enableWebFCommandLog) {
@@ -134,7 +145,7 @@ Future<void> _dispatchEventToNative(Event event, bool isCapture) async {
     }
 
     Pointer<NativeValue> method = malloc.allocate(sizeOf<NativeValue>());
-    toNativeValue(method, 'dispatchEvent');
+    toNativeValue(method, alongPath ? 'dispatchEventAlongPath' : 'dispatchEvent');
     Pointer<NativeValue> allocatedNativeArguments = makeNativeValueArguments(bindingObject, dispatchEventArguments);
 
     _DispatchEventResultContext context = _DispatchEventResultContext(
@@ -189,3 +189,27 @@ class NativePerformanceEntryList extends Struct {
   @Int32()
   external int length;
 }
+
+class NativeSubtreeStream extends Struct {
+  external Pointer<NativeValue> nodes;
+
+  @Int64()
+  external int length;
+
+  external Pointer<NativeValue> names;
+
+  @Int64()
+  external int namesLength;
+}
+
+class NativeCanvasDisplayList extends Struct {
+  external Pointer<NativeValue> commands;
+
+  @Int64()
+  external int length;
+
+  external Pointer<NativeValue> names;
+
+  @Int64()
+  external int namesLength;
+}
@@ -76,6 +76,12 @@ class NativeWork extends Opaque {}
 
 final _executeNativeCallback = WebFDynamicLibrary.ref
     .lookupFunction<Void Function(Pointer<NativeWork>), void Function(Pointer<NativeWork>)>('executeNativeCallback');
+final _executeNativeCallbacks = WebFDynamicLibrary.ref
+    .lookupFunction<Void Function(Pointer<Void>), void Function(Pointer<Void>)>('executeNativeCallbacks');
+
+// The kinds of messages posted by the native dispatcher.
+const int _syncNativeWorkMessage = 1;
+const int _nativeWorkDoorbellMessage = 2;
 
 Completer? _working_completer;
 
@@ -99,7 +105,13 @@ FutureOr<void> waitingSyncTaskComplete(double contextId) async {
 void requestExecuteCallback(message) {
   try {
     final List<dynamic> data = message;
-    final bool isSync = data[0] == 1;
+    // Runs every work posted without waiting since the queue of the dispatcher was last drained.
+    if (data[0] == _nativeWorkDoorbellMessage) {
+      _executeNativeCallbacks(Pointer<Void>.fromAddress(data[1]));
+      return;
+    }
+
+    final bool isSync = data[0] == _syncNativeWorkMessage;
     if (isSync) {
       _working_completer = Completer();
     }
@@ -687,6 +699,9 @@ enum UICommandType {
   // perf optimize
   createSVGElement,
   createElementNS,
+  setStyleById,
+  canvasDisplayList,
+  insertSubtree,
   finishRecordingCommand,
 }
 
@@ -729,6 +744,24 @@ typedef DartClearUICommandItems = void Function(Pointer<Void>);
 final DartClearUICommandItems _clearUICommandItems =
     WebFDynamicLibrary.ref.lookup<NativeFunction<NativeClearUICommandItems>>('clearUICommandItems').asFunction();
 
+typedef NativeGetCSSPropertyNames = Pointer<Pointer<Utf8>> Function();
+typedef DartGetCSSPropertyNames = Pointer<Pointer<Utf8>> Function();
+
+final DartGetCSSPropertyNames _getCSSPropertyNames =
+    WebFDynamicLibrary.ref.lookup<NativeFunction<NativeGetCSSPropertyNames>>('getCSSPropertyNames').asFunction();
+
+List<String> _readCSSPropertyNames() {
+  Pointer<Pointer<Utf8>> names = _getCSSPropertyNames();
+  List<String> result = [];
+  for (int i = 0; names[i] != nullptr; i++) {
+    result.add(names[i].toDartString());
+  }
+  return result;
+}
+
+// camelCase property names indexed by the CSSPropertyID of the bridge, used by the setStyleById command.
+final List<String> cssPropertyNames = _readCSSPropertyNames();
+
 typedef NativeIsJSThreadBlocked = Int8 Function(Pointer<Void>, Double);
 typedef DartIsJSThreadBlocked = int Function(Pointer<Void>, double);
 
@@ -739,6 +772,94 @@ bool isJSThreadBlocked(double contextId) {
   return _isJSThreadBlocked(dartContext!.pointer, contextId) == 1;
 }
 
+typedef NativeJSThreadTimersControl = Void Function(Pointer<Void>, Double);
+typedef DartJSThreadTimersControl = void Function(Pointer<Void>, double);
+
+final DartJSThreadTimersControl _pauseJSThreadTimers = WebFDynamicLibrary.ref
+    .lookup<NativeFunction<NativeJSThreadTimersControl>>('pauseJSThreadTimers')
+    .asFunction();
+final DartJSThreadTimersControl _resumeJSThreadTimers = WebFDynamicLibrary.ref
+    .lookup<NativeFunction<NativeJSThreadTimersControl>>('resumeJSThreadTimers')
+    .asFunction();
+
+// Timers of pages running on a dedicated thread are fired by the JS thread itself.
+void pauseJSThreadTimers(double contextId) {
+  _pauseJSThreadTimers(dartContext!.pointer, contextId);
+}
+
+void resumeJSThreadTimers(double contextId) {
+  _resumeJSThreadTimers(dartContext!.pointer, contextId);
+}
+
+typedef NativeSetCodeCacheDirectory = Void Function(Pointer<Utf8> directory, Int64 maxBytes);
+typedef DartSetCodeCacheDirectory = void Function(Pointer<Utf8> directory, int maxBytes);
+
+final DartSetCodeCacheDirectory _setCodeCacheDirectory = WebFDynamicLibrary.ref
+    .lookup<NativeFunction<NativeSetCodeCacheDirectory>>('setCodeCacheDirectory')
+    .asFunction();
+
+// Keeps the bytecode of evaluated scripts under the existing [directory], up to [maxBytes], so they are not compiled
+// again in later runs. An empty directory disables the cache.
+void setCodeCacheDirectory(String directory, int maxBytes) {
+  Pointer<Utf8> nativeDirectory = directory.toNativeUtf8();
+  _setCodeCacheDirectory(nativeDirectory, maxBytes);
+  malloc.free(nativeDirectory);
+}
+
+typedef NativeGetCodeCacheStats = Void Function(Pointer<Int64> stats);
+typedef DartGetCodeCacheStats = void Function(Pointer<Int64> stats);
+
+final DartGetCodeCacheStats _getCodeCacheStats =
+    WebFDynamicLibrary.ref.lookup<NativeFunction<NativeGetCodeCacheStats>>('getCodeCacheStats').asFunction();
+
+Map<String, int> getCodeCacheStats() {
+  Pointer<Int64> stats = malloc.allocate(sizeOf<Int64>() * 6);
+  _getCodeCacheStats(stats);
+  Map<String, int> result = {
+    'hits': stats[0],
+    'misses': stats[1],
+    'rejected': stats[2],
+    'stores': stats[3],
+    'evictions': stats[4],
+    'totalBytes': stats[5],
+  };
+  malloc.free(stats);
+  return result;
+}
+
+typedef NativeGetGCStats = Void Function(Pointer<Void> page, Pointer<Int64> stats);
+typedef DartGetGCStats = void Function(Pointer<Void> page, Pointer<Int64> stats);
+
+final DartGetGCStats _getGCStats =
+    WebFDynamicLibrary.ref.lookup<NativeFunction<NativeGetGCStats>>('getGCStats').asFunction();
+
+// Must match JS_GC_PAUSE_BUCKET_COUNT of QuickJS.
+const int _gcPauseBucketCount = 16;
+
+// Garbage collection counters of the JS runtime running the page, pauses are in microseconds. Bucket 0 of the pause
+// histograms counts the pauses under 1us, bucket i the ones from 2^(i-1) to 2^i us, the last one all the longer ones.
+Map<String, dynamic> getGCStats(double contextId) {
+  assert(_allocatedPages.containsKey(contextId));
+  Pointer<Int64> stats = malloc.allocate(sizeOf<Int64>() * (9 + _gcPauseBucketCount * 3));
+  _getGCStats(_allocatedPages[contextId]!, stats);
+  Map<String, dynamic> result = {
+    'fullCollections': stats[0],
+    'slices': stats[1],
+    'passes': stats[2],
+    'freedObjects': stats[3],
+    'fullMaxPauseUs': stats[4],
+    'sliceMaxPauseUs': stats[5],
+    'totalPauseUs': stats[6],
+    'fullPauseHistogram': List<int>.generate(_gcPauseBucketCount, (i) => stats[7 + i]),
+    'slicePauseHistogram': List<int>.generate(_gcPauseBucketCount, (i) => stats[7 + _gcPauseBucketCount + i]),
+    'youngCollections': stats[7 + _gcPauseBucketCount * 2],
+    'youngMaxPauseUs': stats[8 + _gcPauseBucketCount * 2],
+    'youngPauseHistogram': List<int>.generate(_gcPauseBucketCount, (i) => stats[9 + _gcPauseBucketCount * 2 + i]),
+  };
+  malloc.free(stats);
+  return result;
+}
+
 void clearUICommand(double contextId) {
   assert(_allocatedPages.containsKey(contextId));
 
@@ -765,17 +886,36 @@ class _NativeCommandData {
 }
 
 _NativeCommandData readNativeUICommandMemory(double contextId) {
-  Pointer<Uint64> nativeCommandItemPointer = _getUICommandItems(_allocatedPages[contextId]!);
-  int flag = _getUICommandKindFlags(_allocatedPages[contextId]!);
-  int commandLength = _getUICommandItemSize(_allocatedPages[contextId]!);
+  Pointer<Void> page = _allocatedPages[contextId]!;
+  int flag = 0;
+  int commandLength = 0;
+  List<int>? rawMemory;
+
+  // In dedicated thread mode, the JS thread publishes commands as separate segments.
+  // Keep reading until all published segments are consumed.
+  while (true) {
+    Pointer<Uint64> nativeCommandItemPointer = _getUICommandItems(page);
+    int segmentFlag = _getUICommandKindFlags(page);
+    int segmentLength = _getUICommandItemSize(page);
+
+    if (segmentLength == 0 || nativeCommandItemPointer == nullptr) {
+      break;
+    }
 
-  if (commandLength == 0 || nativeCommandItemPointer == nullptr) {
-    return _NativeCommandData.empty();
+    Int64List segment = nativeCommandItemPointer.cast<Int64>().asTypedList(segmentLength * nativeCommandSize);
+    if (rawMemory == null) {
+      rawMemory = segment.toList(growable: true);
+    } else {
+      rawMemory.addAll(segment);
+    }
+    flag |= segmentFlag;
+    commandLength += segmentLength;
+    _clearUICommandItems(page);
   }
 
-  List<int> rawMemory =
-      nativeCommandItemPointer.cast<Int64>().asTypedList((commandLength) * nativeCommandSize).toList(growable: false);
-  _clearUICommandItems(_allocatedPages[contextId]!);
+  if (rawMemory == null) {
+    return _NativeCommandData.empty();
+  }
 
   return _NativeCommandData(flag, commandLength, rawMemory);
 }
@@ -82,6 +82,60 @@ List<UICommand> nativeUICommandToDart(List<int> rawMemory, int commandLength, do
   return results;
 }
 
+const int _subtreeElement = 0;
+const int _subtreeSVGElement = 1;
+const int _subtreeText = 2;
+
+// Create the nodes of a subtree built by the bridge, in tree order.
+// Every entry is [node, parent, header, ...arguments], the header holds the node kind with the index of its tag name
+// and argc. Elements come with pairs of attribute name index and value, text nodes with their data.
+void insertSubtree(WebFViewController view, Pointer<NativeSubtreeStream> stream) {
+  List<dynamic> names = List.generate(stream.ref.namesLength, (i) {
+    return fromNativeValue(view, stream.ref.names.elementAt(i));
+  });
+
+  Pointer<NativeValue> nodes = stream.ref.nodes;
+  int length = stream.ref.length;
+  int i = 0;
+  while (i < length) {
+    Pointer<NativeBindingObject> node = Pointer.fromAddress(nodes.elementAt(i).ref.u);
+    Pointer<NativeBindingObject> parent = Pointer.fromAddress(nodes.elementAt(i + 1).ref.u);
+    NativeValue header = nodes.elementAt(i + 2).ref;
+    int argc = header.uint32;
+    int kind = header.u & 3;
+    List<dynamic> values = List.generate(argc, (index) {
+      return fromNativeValue(view, nodes.elementAt(i + 3 + index));
+    });
+    i += 3 + argc;
+
+    try {
+      switch (kind) {
+        case _subtreeElement:
+          view.createElement(node, names[header.u >> 2]);
+          break;
+        case _subtreeSVGElement:
+          view.createElementNS(node, SVG_ELEMENT_URI, names[header.u >> 2]);
+          break;
+        case _subtreeText:
+          view.createTextNode(node, values[0]);
+          break;
+      }
+      if (kind != _subtreeText) {
+        for (int j = 0; j < argc; j += 2) {
+          view.setAttribute(node, names[values[j]], values[j + 1]);
+        }
+      }
+      view.insertAdjacentNode(parent, 'beforeend', node);
+    } catch (e, stack) {
+      print('$e\n$stack');
+    }
+  }
+
+  malloc.free(nodes);
+  malloc.free(stream.ref.names);
+  malloc.free(stream);
+}
+
 void execUICommands(WebFViewController view, List<UICommand> commands) {
   Map<int, bool> pendingStylePropertiesTargets = {};
 
@@ -94,6 +148,9 @@ void execUICommands(WebFViewController view, List<UICommand> commands) {
         case UICommandType.setStyle:
           printMsg = 'nativePtr: ${command.nativePtr} type: ${command.type} key: ${command.args} value: ${nativeStringToString(command.nativePtr2.cast<NativeString>())}';
           break;
+        case UICommandType.setStyleById:
+          printMsg = 'nativePtr: ${command.nativePtr} type: ${command.type} key: ${cssPropertyNames[command.nativePtr2.address]} value: ${command.args}';
+          break;
         case UICommandType.setAttribute:
           printMsg = 'nativePtr: ${command.nativePtr} type: ${command.type} key: ${nativeStringToString(command.nativePtr2.cast<NativeString>())} value: ${command.args}';
           break;
@@ -249,6 +306,16 @@ void execUICommands(WebFViewController view, List<UICommand> commands) {
             WebFProfiler.instance.finishTrackUICommandStep();
           }
           break;
+        case UICommandType.setStyleById:
+          if (enableWebFProfileTracking) {
+            WebFProfiler.instance.startTrackUICommandStep('FlushUICommand.setStyleById');
+          }
+          view.setInlineStyle(nativePtr, cssPropertyNames[command.nativePtr2.address], command.args);
+          pendingStylePropertiesTargets[nativePtr.address] = true;
+          if (enableWebFProfileTracking) {
+            WebFProfiler.instance.finishTrackUICommandStep();
+          }
+          break;
         case UICommandType.clearStyle:
           if (enableWebFProfileTracking) {
             WebFProfiler.instance.startTrackUICommandStep('FlushUICommand.clearStyle');
@@ -295,6 +362,28 @@ void execUICommands(WebFViewController view, List<UICommand> commands) {
             WebFProfiler.instance.startTrackUICommandStep('FlushUICommand.createSVGElement');
           }
           view.createElementNS(nativePtr.cast<NativeBindingObject>(), SVG_ELEMENT_URI, command.args);
+          if (enableWebFProfileTracking) {
+            WebFProfiler.instance.finishTrackUICommandStep();
+          }
+          break;
+        case UICommandType.canvasDisplayList:
+          if (enableWebFProfileTracking) {
+            WebFProfiler.instance.startTrackUICommandStep('FlushUICommand.canvasDisplayList');
+          }
+
+          replayCanvasDisplayList(view, command.nativePtr2.cast<NativeCanvasDisplayList>());
+
+          if (enableWebFProfileTracking) {
+            WebFProfiler.instance.finishTrackUICommandStep();
+          }
+          break;
+        case UICommandType.insertSubtree:
+          if (enableWebFProfileTracking) {
+            WebFProfiler.instance.startTrackUICommandStep('FlushUICommand.insertSubtree');
+          }
+
+          insertSubtree(view, command.nativePtr2.cast<NativeSubtreeStream>());
+
           if (enableWebFProfileTracking) {
             WebFProfiler.instance.finishTrackUICommandStep();
           }
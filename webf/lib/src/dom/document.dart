@@ -245,6 +245,8 @@ class Document extends ContainerNode {
     methods['getElementsByName'] = BindingObjectMethodSync(call: (args) => getElementsByName(args));
     methods['elementFromPoint'] = BindingObjectMethodSync(
         call: (args) => elementFromPoint(castToType<double>(args[0]), castToType<double>(args[1])));
+    methods['__prefetch_bounding_client_rects__'] =
+        BindingObjectMethodSync(call: (args) => prefetchBoundingClientRects(args));
     if (kDebugMode || kProfileMode) {
       methods['___clear_cookies__'] = BindingObjectMethodSync(call: (args) => debugClearCookies(args));
     }
@@ -323,6 +325,24 @@ class Document extends ContainerNode {
     return HitTestPoint(x, y);
   }
 
+  // Returns x, y, width and height of every element in a flat list, so the bridge can cache the
+  // bounding client rects of many elements after one layout flush.
+  List<double> prefetchBoundingClientRects(List<dynamic> elements) {
+    documentElement?.flushLayout();
+    List<double> result = List.filled(elements.length * 4, 0.0);
+    for (int i = 0; i < elements.length; i++) {
+      dynamic element = elements[i];
+      if (element is! Element) continue;
+      Rect? rect = element.boundingClientRectBounds;
+      if (rect == null) continue;
+      result[i * 4] = rect.left;
+      result[i * 4 + 1] = rect.top;
+      result[i * 4 + 2] = rect.width;
+      result[i * 4 + 3] = rect.height;
+    }
+    return result;
+  }
+
   Element? HitTestPoint(double x, double y) {
     HitTestResult hitTestResult = HitTestInDocument(x, y);
     Iterable<HitTestEntry> hitTestEntrys = hitTestResult.path;
@@ -1782,34 +1782,40 @@ abstract class Element extends ContainerNode with ElementBase, ElementEventMixin
   // The Element.getBoundingClientRect() method returns a DOMRect object providing information
   // about the size of an element and its position relative to the viewport.
   // https://drafts.csswg.org/cssom-view/#dom-element-getboundingclientrect
-  BoundingClientRect get boundingClientRect {
-    BoundingClientRect boundingClientRect = BoundingClientRect.zero(BindingContext(ownerView, ownerView.contextId, allocateNewBindingObject()));
-    if (isRendererAttached) {
-      flushLayout();
-      RenderBoxModel sizedBox = renderBoxModel!;
-      // Force flush layout.
-      if (!sizedBox.hasSize) {
-        sizedBox.markNeedsLayout();
-        sizedBox.owner!.flushLayout();
-      }
+  // The border box of the element relative to the viewport, null when it is not laid out.
+  Rect? get boundingClientRectBounds {
+    if (!isRendererAttached) return null;
 
-      if (sizedBox.hasSize) {
-        Offset offset = _getOffset(sizedBox, ancestor: ownerDocument.documentElement, excludeScrollOffset: true);
-        Size size = sizedBox.size;
-        boundingClientRect = BoundingClientRect(
-            context: BindingContext(ownerView, ownerView.contextId, allocateNewBindingObject()),
-            x: offset.dx,
-            y: offset.dy,
-            width: size.width,
-            height: size.height,
-            top: offset.dy,
-            right: offset.dx + size.width,
-            bottom: offset.dy + size.height,
-            left: offset.dx);
-      }
+    flushLayout();
+    RenderBoxModel sizedBox = renderBoxModel!;
+    // Force flush layout.
+    if (!sizedBox.hasSize) {
+      sizedBox.markNeedsLayout();
+      sizedBox.owner!.flushLayout();
     }
+    if (!sizedBox.hasSize) return null;
+
+    Offset offset = _getOffset(sizedBox, ancestor: ownerDocument.documentElement, excludeScrollOffset: true);
+    return offset & sizedBox.size;
+  }
 
-    return boundingClientRect;
+  BoundingClientRect get boundingClientRect {
+    BindingContext context = BindingContext(ownerView, ownerView.contextId, allocateNewBindingObject());
+    Rect? bounds = boundingClientRectBounds;
+    if (bounds == null) {
+      return BoundingClientRect.zero(context);
+    }
+
+    return BoundingClientRect(
+        context: context,
+        x: bounds.left,
+        y: bounds.top,
+        width: bounds.width,
+        height: bounds.height,
+        top: bounds.top,
+        right: bounds.right,
+        bottom: bounds.bottom,
+        left: bounds.left);
   }
 
   // The HTMLElement.offsetLeft read-only property returns the number of pixels that the upper left corner
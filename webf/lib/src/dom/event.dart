@@ -181,6 +181,8 @@ class Event {
   bool defaultPrevented = false;
   bool _immediateBubble = true;
   bool propagationStopped = false;
+  // Whether the native listeners of the whole event path were called by the first native handler reached.
+  bool dispatchedAlongNativePath = false;
 
   Pointer<Void> sharedJSProps = nullptr;
   int propLen = 0;
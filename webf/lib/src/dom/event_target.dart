@@ -70,6 +70,7 @@ abstract class EventTarget extends DynamicBindingObject {
     } else {
       event.target = this;
     }
+    event.dispatchedAlongNativePath = false;
 
     await _handlerCaptureEvent(event);
     await _dispatchEventInDOM(event);
@@ -382,3 +382,46 @@ void invokeBindingMethodFromNativeImpl(double contextId, int profileId, Pointer<
     WebFProfiler.instance.finishTrackBinding(profileId);
   }
 }
+
+// Replay the canvas calls recorded by the bridge, in the order they were recorded.
+// Every entry is [target, header, ...arguments], the header holds the index of the method or property name and argc.
+void replayCanvasDisplayList(WebFViewController view, Pointer<NativeCanvasDisplayList> displayList) {
+  List<dynamic> names = List.generate(displayList.ref.namesLength, (i) {
+    return fromNativeValue(view, displayList.ref.names.elementAt(i));
+  });
+
+  Pointer<NativeValue> commands = displayList.ref.commands;
+  int length = displayList.ref.length;
+  int i = 0;
+  while (i < length) {
+    Pointer<NativeBindingObject> target = Pointer.fromAddress(commands.elementAt(i).ref.u);
+    NativeValue header = commands.elementAt(i + 1).ref;
+    int argc = header.uint32;
+    String name = names[header.u >> 1];
+    bool isSetProperty = header.u & 1 == 1;
+    List<dynamic> values = List.generate(argc, (index) {
+      return fromNativeValue(view, commands.elementAt(i + 2 + index));
+    });
+    i += 2 + argc;
+
+    DynamicBindingObject? bindingObject = view.getBindingObject<DynamicBindingObject>(target);
+    if (bindingObject == null) continue;
+
+    try {
+      if (isSetProperty) {
+        bindingObject._properties[name]?.setter?.call(values[0]);
+      } else {
+        bindingObject._invokeBindingMethodSync(name, values);
+      }
+      if (enableWebFCommandLog) {
+        print('$bindingObject replayCanvasDisplayList ${isSetProperty ? 'property' : 'method'}: $name args: $values');
+      }
+    } catch (e, stack) {
+      print('$e\n$stack');
+    }
+  }
+
+  malloc.free(commands);
+  malloc.free(displayList.ref.names);
+  malloc.free(displayList);
+}
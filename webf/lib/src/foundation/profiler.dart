@@ -590,6 +590,8 @@ class WebFProfiler {
       'native_initialize': profileData['initialize'],
       'evaluate': _evaluateOp,
       'async_evaluate': profileData['async_evaluate'],
+      // Native tracepoints in the Chrome trace event format.
+      'traceEvents': profileData['traceEvents'],
       'frames': frameReport(),
     };
   }
@@ -1492,6 +1492,9 @@ class WebFController {
     if (_paused) return;
     _paused = true;
     module.pauseTimer();
+    if (runningThread is! FlutterUIThread) {
+      pauseJSThreadTimers(view.contextId);
+    }
     module.pauseAnimationFrame();
     view.stopAnimationsTimeLine();
   }
@@ -1507,6 +1510,9 @@ class WebFController {
     _paused = false;
     flushPendingCallbacks();
     module.resumeTimer();
+    if (runningThread is! FlutterUIThread) {
+      resumeJSThreadTimers(view.contextId);
+    }
     module.resumeAnimationFrame();
     view.resumeAnimationTimeline();
     SchedulerBinding.instance.scheduleFrame();